@@ -53,7 +53,7 @@ elseif(${MODE} STREQUAL "stderr")
     )
 elseif(${MODE} STREQUAL "file")
     execute_process(
-        COMMAND ${TEST_FILE}
+        COMMAND ${TEST_FILE} ${TEST_ARGS}
         RESULT_VARIABLE TEST_RESULT
     )
 endif()
@@ -86,6 +86,7 @@ class type_traits:
     RE_DESC     = r"(.*)desc_t.*"
     RE_PROPS    = r"(.*)properties_t.*"
     RE_FLAGS    = r"(.*)flags_t"
+    RE_INTEGER  = r"(const\s+)?(u?int(8|16|32|64|ptr)_t|size_t|int|unsigned)$"
 
     @staticmethod
     def base(name):
@@ -148,6 +149,13 @@ class type_traits:
         except:
             return False
 
+    @classmethod
+    def is_integer(cls, name):
+        try:
+            return True if re.match(cls.RE_INTEGER, name) else False
+        except:
+            return False
+
     @staticmethod
     def is_known(name, meta):
         try:
@@ -1007,6 +1015,73 @@ def get_table_name(namespace, tags, obj):
     name = name if len(name) > 0 else "Global"
     return name
 
+"""
+Private:
+    functions called on the hot path of typical applications, ordered by their
+    expected call frequency, with the enqueue, event and USM entries together
+"""
+_hot_functions = [
+    "$xEnqueueKernelLaunch",
+    "$xEnqueueEventsWait",
+    "$xEnqueueEventsWaitWithBarrier",
+    "$xEnqueueMemBufferRead",
+    "$xEnqueueMemBufferWrite",
+    "$xEnqueueMemBufferCopy",
+    "$xEnqueueMemBufferFill",
+    "$xEnqueueMemBufferMap",
+    "$xEnqueueMemUnmap",
+    "$xEnqueueUSMMemcpy",
+    "$xEnqueueUSMFill",
+    "$xEnqueueUSMPrefetch",
+    "$xEventWait",
+    "$xEventRelease",
+    "$xEventRetain",
+    "$xEventGetInfo",
+    "$xUSMHostAlloc",
+    "$xUSMDeviceAlloc",
+    "$xUSMSharedAlloc",
+    "$xUSMFree",
+    "$xKernelSetArgValue",
+    "$xKernelSetArgPointer",
+    "$xKernelSetArgMemObj",
+    "$xQueueFinish",
+]
+
+"""
+Public:
+    returns a list of the function objs on the hot path, in the order of the
+    entries of the loader's hot DDI table
+"""
+def get_hot_function_objs(specs, namespace, tags):
+    objs = {}
+    for obj in extract_objs(specs, r"function"):
+        objs[make_func_name(namespace, tags, obj)] = obj
+    names = [subt(namespace, tags, name) for name in _hot_functions]
+    return [objs[name] for name in names if name in objs]
+
+"""
+Public:
+    returns the name of the function's pointer in the loader's hot DDI table,
+    None if the function is not on the hot path
+"""
+def get_hot_pfn_name(namespace, tags, obj):
+    fname = make_func_name(namespace, tags, obj)
+    if fname not in [subt(namespace, tags, name) for name in _hot_functions]:
+        return None
+    return "pfn%s"%fname[len(tags['$x']):]
+
+"""
+Public:
+    returns the name of the first handle passed by value to the function,
+    None if there is none
+"""
+def get_first_handle_param(namespace, tags, obj):
+    for item in obj['params']:
+        if param_traits.is_input(item) and type_traits.is_handle(item['type']) \
+                and not type_traits.is_pointer(item['type']):
+            return subt(namespace, tags, item['name'])
+    return None
+
 """
 Public:
     returns a list of dict of each pfntables needed
@@ -1161,10 +1236,38 @@ Public:
 def get_loader_epilogue(namespace, tags, obj, meta):
     epilogue = []
 
+    # the handle whose reference is taken or dropped by a retain/release function,
+    # e.g., "hEvent" for "$xEventRelease" or "pPool" for "$xUSMPoolDestroy"
+    refcounted = None
+    is_retain = True if re.match(r"\w*Retain$", obj['name']) else False
+    if is_retain or re.match(r"\w*(Release|Destroy)$", obj['name']):
+        handles = [item for item in _filter_param_list(obj['params'], ["[in]"])
+                   if type_traits.is_class_handle(item['type'], meta) and not type_traits.is_pointer(item['type'])]
+        if handles:
+            refcounted = handles[-1]
+
+    # the adapter owns the platforms and the root devices, the handles it returns for
+    # them, e.g., from "$xDeviceGet" or "$xDeviceCreateWithNativeHandle", are lookups
+    # of existing objects rather than references the application has to release
+    def is_acquired(tname):
+        if re.match(r"\w+_(platform|native)_handle_t$", tname):
+            return False
+        if re.match(r"\w+_device_handle_t$", tname):
+            return make_func_name(namespace, tags, obj) == subt(namespace, tags, "$xDevicePartition")
+        return True
+
     for i, item in enumerate(obj['params']):
         if param_traits.is_mbz(item):
             continue
-        if param_traits.is_release(item) or param_traits.is_output(item) or param_traits.is_inoutput(item):
+        if item is refcounted:
+            tname = _remove_const_ptr(subt(namespace, tags, item['type']))
+            epilogue.append({
+                'name': subt(namespace, tags, item['name']),
+                'factory': re.sub(r"(\w+)_handle_t", r"\1_factory", tname),
+                'release': not is_retain,
+                'retain': is_retain
+            })
+        elif param_traits.is_release(item) or param_traits.is_output(item) or param_traits.is_inoutput(item):
             if type_traits.is_class_handle(item['type'], meta):
                 name = subt(namespace, tags, item['name'])
                 tname = _remove_const_ptr(subt(namespace, tags, item['type']))
@@ -1181,6 +1284,8 @@ def get_loader_epilogue(namespace, tags, obj, meta):
                         'obj': obj_name,
                         'factory': fty_name,
                         'release': param_traits.is_release(item),
+                        'retain': False,
+                        'acquire': is_acquired(tname),
                         'range': (range_start, range_end)
                     })
                 else:
@@ -1190,6 +1295,8 @@ def get_loader_epilogue(namespace, tags, obj, meta):
                         'obj': obj_name,
                         'factory': fty_name,
                         'release': param_traits.is_release(item),
+                        'retain': False,
+                        'acquire': is_acquired(tname),
                         'optional': param_traits.is_optional(item)
                     })
 
@@ -1197,32 +1304,44 @@ def get_loader_epilogue(namespace, tags, obj, meta):
 
 """
 Public:
-    returns a dictionary with lists of create, retain and release functions
+    returns a dictionary with the create, retain and release functions, the
+    create functions mapped to the names of the handles they return, and the
+    handle types whose handles are all returned by create functions
 """
 def get_create_retain_release_functions(specs, namespace, tags):
     funcs = []
     for s in specs:
         for obj in s['objects']:
             if re.match(r"function", obj['type']):
-                funcs.append(make_func_name(namespace, tags, obj))
-
-    create_suffixes = r"(Create[A-Za-z]*){1}"
-    retain_suffixes = r"(Retain){1}"
-    release_suffixes = r"(Release){1}"
-
-    create_exp = namespace + r"([A-Za-z]+)" + create_suffixes
-    retain_exp = namespace + r"([A-Za-z]+)" + retain_suffixes
-    release_exp = namespace + r"([A-Za-z]+)" + release_suffixes
-
-    create_funcs, retain_funcs, release_funcs = (
-        list(filter(lambda f: re.match(create_exp, f), funcs)),
-        list(filter(lambda f: re.match(retain_exp, f), funcs)),
-        list(filter(lambda f: re.match(release_exp, f), funcs)),
-    )
-
-    create_funcs, retain_funcs = (
-        list(filter(lambda f: re.sub(create_suffixes, "Release", f) in release_funcs, create_funcs)),
-        list(filter(lambda f: re.sub(retain_suffixes, "Release", f) in release_funcs, retain_funcs)),
-    )
+                funcs.append(obj)
+
+    # the handle a release function takes is its last parameter
+    release_funcs = {}
+    for f in funcs:
+        if re.search(r"(Release|Destroy)$", f['name']) and f['params']:
+            release_funcs[make_func_name(namespace, tags, f)] = f['params'][-1]['type']
+    released_types = set(release_funcs.values())
+
+    create_funcs, retain_funcs, untracked_types = {}, [], set()
+    for f in funcs:
+        func_name = make_func_name(namespace, tags, f)
+        if re.search(r"Retain$", f['name']) and f['params'][-1]['type'] in released_types:
+            retain_funcs.append(func_name)
+
+        for item in f['params']:
+            handle_type = re.sub(r"\*$", "", item['type'])
+            if not param_traits.is_output(item) or not item['type'].endswith("*") \
+                    or handle_type not in released_types:
+                continue
+            if param_traits.is_range(item):
+                # arrays of handles, e.g. of urDeviceGet, are not tracked
+                untracked_types.add(handle_type)
+            else:
+                create_funcs.setdefault(func_name, []).append({
+                    'name': item['name'],
+                    'optional': param_traits.is_optional(item)
+                })
 
-    return {"create": create_funcs, "retain": retain_funcs, "release": release_funcs}
+    tracked_types = [subt(namespace, tags, t) for t in released_types - untracked_types]
+    return {"create": create_funcs, "retain": retain_funcs, "release": list(release_funcs),
+            "tracked_types": sorted(tracked_types)}
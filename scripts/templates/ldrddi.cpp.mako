@@ -45,18 +45,27 @@ namespace ur_loader
         %endfor
         )
     {
-        ${x}_result_t result = ${X}_RESULT_SUCCESS;<%
-        add_local = False
-        arrays_to_delete = []
-    %>
+        ${x}_result_t result = ${X}_RESULT_SUCCESS;
 
         %if re.match(r"Init", obj['name']):
-        bool atLeastOneplatformValid = false;
-        for( auto& platform : context->platforms )
+        if( context->lazyInit )
+        {
+            // the platforms are initialized by the first ${n}PlatformGet
+            context->lazyInitFlags = ${obj['params'][0]['name']};
+            return result;
+        }
+
+        // initialize the platforms concurrently
+        context->forEachPlatform( "initialized", [&]( platform_t& platform )
         {
             if(platform.initStatus != ${X}_RESULT_SUCCESS)
-                continue;
+                return;
             platform.initStatus = platform.dditable.${n}.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+        } );
+
+        bool atLeastOneplatformValid = false;
+        for( auto& platform : context->platforms )
+        {
             if(platform.initStatus == ${X}_RESULT_SUCCESS)
                 atLeastOneplatformValid = true;
         }
@@ -64,24 +73,35 @@ namespace ur_loader
         if(!atLeastOneplatformValid)
             result=${X}_RESULT_ERROR_UNINITIALIZED;
 
+        context->updateAdapterCache();
+
         %elif re.match(r"\w+TearDown$", th.make_func_name(n, tags, obj)):
 
         for( auto& platform : context->platforms )
         {
+            // lazily initialized platforms may never have been loaded
+            if( nullptr == platform.dditable.${n}.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)} )
+                continue;
             platform.dditable.${n}.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
         }
 
         %elif re.match(r"\w+PlatformGet$", th.make_func_name(n, tags, obj)):
+        // counting the platforms needs every adapter, retrieving handles only
+        // the adapters up to the one completing ${obj['params'][0]['name']} platforms
+        if( nullptr != ${obj['params'][2]['name']} || 0 == ${obj['params'][0]['name']} )
+            context->lazyInitPlatforms();
+
         uint32_t total_platform_handle_count = 0;
 
         for( auto& platform : context->platforms )
         {
-            if(platform.initStatus != ${X}_RESULT_SUCCESS)
-                continue;
-
             if( ( 0 < ${obj['params'][0]['name']} ) && ( ${obj['params'][0]['name']} == total_platform_handle_count))
                 break;
 
+            context->lazyInitPlatform( platform );
+            if(platform.initStatus != ${X}_RESULT_SUCCESS)
+                continue;
+
             uint32_t library_platform_handle_count = 0;
 
             result = platform.dditable.${n}.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)}( 0, nullptr, &library_platform_handle_count );
@@ -120,19 +140,22 @@ namespace ur_loader
         %if 0 == i:
         // extract platform's function pointer table
         auto dditable = reinterpret_cast<${item['obj']}*>( ${item['pointer']}${item['name']} )->dditable;
+        %if th.get_hot_pfn_name(n, tags, obj):
+        auto ${th.make_pfn_name(n, tags, obj)} = dditable->hot.${th.get_hot_pfn_name(n, tags, obj)};
+        %else:
         auto ${th.make_pfn_name(n, tags, obj)} = dditable->${n}.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
+        %endif
         if( nullptr == ${th.make_pfn_name(n, tags, obj)} )
             return ${X}_RESULT_ERROR_UNINITIALIZED;
 
         %endif
         %if 'range' in item:
-        <%
-        add_local = True%>// convert loader handles to platform handles
-        auto ${item['name']}Local = new ${item['type']} [${item['range'][1]}];
-        <%
-        arrays_to_delete.append(item['name']+ 'Local')
-        %>for( size_t i = ${item['range'][0]}; ( nullptr != ${item['name']} ) && ( i < ${item['range'][1]} ); ++i )
+        // convert loader handles to platform handles
+        small_array_t<${item['type']}> ${item['name']}Local( ${item['range'][1]} );
+        for( size_t i = ${item['range'][0]}; ( nullptr != ${item['name']} ) && ( i < ${item['range'][1]} ); ++i )
             ${item['name']}Local[ i ] = reinterpret_cast<${item['obj']}*>( ${item['name']}[ i ] )->handle;
+        if( nullptr != ${item['name']} )
+            ${item['name']} = ${item['name']}Local.data();
         %else:
         // convert loader handle to platform handle
         %if item['optional']:
@@ -144,17 +167,8 @@ namespace ur_loader
 
         %endfor
         // forward to device-platform
-        %if add_local:
-        result = ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name", "local"]))} );
-        %for array_name in arrays_to_delete:
-        delete []${array_name};
-        %endfor
-        %else:
         result = ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
-        %endif
-<%
-        del arrays_to_delete
-        del add_local%>
+
         %for i, item in enumerate(th.get_loader_epilogue(n, tags, obj, meta)):
         %if 0 == i:
         if( ${X}_RESULT_SUCCESS != result )
@@ -164,6 +178,9 @@ namespace ur_loader
         %if item['release']:
         // release loader handle
         ${item['factory']}.release( ${item['name']} );
+        %elif item['retain']:
+        // retain loader handle
+        ${item['factory']}.retain( ${item['name']} );
         %else:
         try
         {
@@ -171,16 +188,16 @@ namespace ur_loader
             // convert platform handles to loader handles
             for( size_t i = ${item['range'][0]}; ( nullptr != ${item['name']} ) && ( i < ${item['range'][1]} ); ++i )
                 ${item['name']}[ i ] = reinterpret_cast<${item['type']}>(
-                    ${item['factory']}.getInstance( ${item['name']}[ i ], dditable ) );
+                    ${item['factory']}.${'acquire' if item['acquire'] else 'getInstance'}( ${item['name']}[ i ], dditable ) );
             %else:
             // convert platform handle to loader handle
             %if item['optional']:
             if( nullptr != ${item['name']} )
                 *${item['name']} = reinterpret_cast<${item['type']}>(
-                    ${item['factory']}.getInstance( *${item['name']}, dditable ) );
+                    ${item['factory']}.${'acquire' if item['acquire'] else 'getInstance'}( *${item['name']}, dditable ) );
             %else:
             *${item['name']} = reinterpret_cast<${item['type']}>(
-                ${item['factory']}.getInstance( *${item['name']}, dditable ) );
+                ${item['factory']}.${'acquire' if item['acquire'] else 'getInstance'}( *${item['name']}, dditable ) );
             %endif
             %endif
         }
@@ -199,6 +216,34 @@ namespace ur_loader
     %endif
 
     %endfor
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Fills the DDI tables of a platform loaded by the lazy initialization
+    ${x}_result_t context_t::getDdiTables( platform_t& platform )
+    {
+        %for tbl in th.get_pfntables(specs, meta, n, tags):
+        {
+            auto getTable = reinterpret_cast<${tbl['pfn']}>(
+                LibLoader::getFunctionPtr(platform.handle.get(), "${tbl['export']['name']}"));
+            if(getTable)
+            {
+                platform.tables |= 1u << ${loop.index};
+                %if tbl['experimental'] is False:
+                auto getTableResult = getTable( version, &platform.dditable.${n}.${tbl['name']});
+                if(getTableResult != ${X}_RESULT_SUCCESS)
+                    return getTableResult;
+                %else:
+                // Experimental Tables may not be implemented in platform
+                getTable( version, &platform.dditable.${n}.${tbl['name']});
+                %endif
+            }
+        }
+
+        %endfor
+        updateHotDdiTable( platform.dditable );
+
+        return ${X}_RESULT_SUCCESS;
+    }
+
 } // namespace ur_loader
 
 #if defined(__cplusplus)
@@ -239,10 +284,17 @@ ${tbl['export']['name']}(
     {
         if(platform.initStatus != ${X}_RESULT_SUCCESS)
             continue;
+        if(!platform.handle)
+        {
+            // not loaded yet, the lazy initialization fills the tables later
+            atLeastOneplatformValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<${tbl['pfn']}>(
             ur_loader::LibLoader::getFunctionPtr(platform.handle.get(), "${tbl['export']['name']}"));
         if(!getTable) 
             continue; 
+        platform.tables |= 1u << ${loop.index};
         auto getTableResult = getTable( version, &platform.dditable.${n}.${tbl['name']});
         if(getTableResult == ${X}_RESULT_SUCCESS) 
             atLeastOneplatformValid = true;
@@ -280,6 +332,11 @@ ${tbl['export']['name']}(
         {
             // return pointers directly to platform's DDIs
             *pDdiTable = ur_loader::context->platforms.front().dditable.${n}.${tbl['name']};
+            %if tbl['name'] == 'Global':
+            // initialization still goes through the loader, which records
+            // the init status of the adapters
+            pDdiTable->pfnInit = ur_loader::${n}Init;
+            %endif
         }
     }
 
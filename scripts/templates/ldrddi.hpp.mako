@@ -21,8 +21,34 @@ from templates import helper as th
 
 #include "${x}_object.hpp"
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function pointers of the functions on the hot path, copied out of
+///        the platform's DDI tables and packed into a few cache lines
+struct hot_dditable_t
+{
+    %for obj in th.get_hot_function_objs(specs, n, tags):
+    ${th.append_ws(th.make_pfn_type(n, tags, obj), 43)} ${th.get_hot_pfn_name(n, tags, obj)};
+    %endfor
+};
+
+///////////////////////////////////////////////////////////////////////////////
+struct alignas(64) dditable_t
+{
+    hot_dditable_t hot;
+    ${n}_dditable_t ${n};
+};
+
 namespace ur_loader
 {
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Copies the hot function pointers out of the DDI tables
+    inline void updateHotDdiTable( dditable_t& dditable )
+    {
+        %for obj in th.get_hot_function_objs(specs, n, tags):
+        dditable.hot.${th.get_hot_pfn_name(n, tags, obj)} = dditable.${n}.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
+        %endfor
+    }
+
     ///////////////////////////////////////////////////////////////////////////////
     %for obj in th.extract_objs(specs, r"handle"):
     %if 'class' in obj:
@@ -1,6 +1,116 @@
 <%!
 import re
 from templates import helper as th
+
+## the spec does not say how many bytes a void pointer points to, these are
+## the parameters holding that count for the pointers whose data is captured
+capture_counts = {
+    "$xEnqueueMemBufferRead.pDst": "size",
+    "$xEnqueueMemBufferWrite.pSrc": "size",
+    "$xEnqueueMemBufferFill.pPattern": "patternSize",
+    "$xEnqueueUSMFill.ptr": "size",
+    "$xEnqueueUSMFill.pPattern": "patternSize",
+    "$xEnqueueUSMFill2D.pPattern": "patternSize",
+    "$xEnqueueUSMMemcpy.pDst": "size",
+    "$xEnqueueUSMMemcpy.pSrc": "size",
+    "$xEnqueueUSMPrefetch.pMem": "size",
+    "$xEnqueueUSMAdvise.pMem": "size",
+    "$xEnqueueDeviceGlobalVariableWrite.pSrc": "count",
+    "$xEnqueueDeviceGlobalVariableRead.pDst": "count",
+    "$xEnqueueKernelLaunch.pGlobalWorkOffset": "workDim",
+    "$xEnqueueKernelLaunch.pGlobalWorkSize": "workDim",
+    "$xEnqueueKernelLaunch.pLocalWorkSize": "workDim",
+    "$xKernelSetArgValue.pArgValue": "argSize",
+    "$xProgramCreateWithIL.pIL": "length",
+    "$xProgramCreateWithBinary.pBinary": "size",
+    "$xUSMHostAlloc.ppMem": "size",
+    "$xUSMDeviceAlloc.ppMem": "size",
+    "$xUSMSharedAlloc.ppMem": "size",
+    "$xEnqueueMemBufferMap.ppRetMap": "size",
+}
+## the [in] void pointers to memory the function writes into
+capture_outputs = {
+    "$xEnqueueMemBufferRead.pDst",
+    "$xEnqueueMemBufferReadRect.pDst",
+    "$xEnqueueMemImageRead.pDst",
+    "$xEnqueueUSMFill.ptr",
+    "$xEnqueueUSMFill2D.pMem",
+    "$xEnqueueUSMMemcpy.pDst",
+    "$xEnqueueUSMMemcpy2D.pDst",
+    "$xEnqueueDeviceGlobalVariableRead.pDst",
+}
+## the outputs that return memory
+capture_allocs = {
+    "$xUSMHostAlloc.ppMem",
+    "$xUSMDeviceAlloc.ppMem",
+    "$xUSMSharedAlloc.ppMem",
+    "$xEnqueueMemBufferMap.ppRetMap",
+}
+## passed as null when replayed
+capture_ignored = {
+    "$xTearDown.pParams",
+    "$xContextSetExtendedDeleter.pUserData",
+    "$xEventSetCallback.pUserData",
+}
+
+## returns the capture_param_t initializer of a parameter of a function
+def capture_param(n, tags, specs, meta, obj, item):
+    key = "%s%s.%s"%(obj['class'], obj['name'], item['name'])
+    names = [param['name'] for param in obj['params']]
+    itype = item['type']
+    is_ptr = th.type_traits.is_pointer(itype)
+    pointee = re.sub(r"\*$", "", itype).replace("const ", "").strip() if is_ptr else itype
+    size = "1" if pointee == "void" else "sizeof(%s)"%re.sub(r"\s*\*", " *", th.subt(n, tags, pointee))
+
+    count = None
+    if key in capture_counts:
+        count = capture_counts[key]
+    elif th.param_traits.is_range(item):
+        count = th.param_traits.range_end(item)
+    elif th.param_traits.typename(item) is not None:
+        count = th.param_traits.typename_size(item)
+    count = str(names.index(count)) if count is not None else "-1"
+
+    struct = None
+    for s in specs:
+        for o in s['objects']:
+            if o['type'] == 'struct' and o['name'] == pointee:
+                struct = o
+
+    if key in capture_ignored:
+        kind = "ignored"
+    elif key in capture_allocs:
+        kind = "alloc_out"
+    elif th.type_traits.is_funcptr(itype, meta) or pointee == "$x_device_partition_property_t":
+        kind = "unsupported"
+    elif not is_ptr:
+        if itype == "$x_native_handle_t":
+            kind = "unsupported"
+        elif th.type_traits.is_handle(itype):
+            kind = "handle"
+        else:
+            kind = "value"
+    elif th.param_traits.is_output(item) or th.param_traits.is_inoutput(item):
+        if th.type_traits.is_handle(pointee) and pointee != "$x_native_handle_t":
+            kind = "handle_out"
+        else:
+            kind = "out"
+    elif pointee == "char":
+        kind = "string"
+    elif th.type_traits.is_handle(pointee):
+        kind = "handle_array"
+    elif struct is not None:
+        if any('*' in m['type'] and m['name'] != "pNext" for m in struct['members']):
+            kind = "unsupported"
+        elif 'base' in struct:
+            kind = "desc"
+        else:
+            kind = "data"
+    elif pointee == "void":
+        kind = "memory_out" if key in capture_outputs else "memory"
+    else:
+        kind = "data"
+    return "{param_kind_t::%s, %s, %s}"%(kind, size, count)
 %><%
     n=namespace
     N=n.upper()
@@ -39,7 +149,7 @@ from templates import helper as th
     %endif
 </%def>
 
-<%def name="line(item, n, params, params_dict)">
+<%def name="line(item, n, params, params_dict, label=True)">
     <%
         iname = th._get_param_name(n, tags, item)
         prefix = "p" if params else ""
@@ -57,7 +167,7 @@ from templates import helper as th
     %endif
     ## can't iterate over 'void *'...
     %if th.param_traits.is_range(item) and "void*" not in itype:
-        os << ".${iname} = [";
+        os << "${".%s = "%iname if label else ""}[";
         for (size_t i = ${th.param_traits.range_start(item)}; ${deref}(params${access}${pname}) != NULL && i < ${deref}params${access}${prefix + th.param_traits.range_end(item)}; ++i) {
             if (i != 0) {
                 os << ", ";
@@ -68,10 +178,14 @@ from templates import helper as th
         }
         os << "]";
     %elif typename is not None:
+        %if label:
         os << ".${iname} = ";
+        %endif
         ${x}_params::serializeTaggedTyped_${underlying_type}(os, ${deref}(params${access}${pname}), ${deref}(params${access}${prefix}${typename}), ${deref}(params${access}${prefix}${typename_size}));
     %else:
+        %if label:
         os << ".${iname} = ";
+        %endif
         <%call expr="member(iname, itype, False)">
             ${deref}(params${access}${pname})
         </%call>
@@ -333,6 +447,146 @@ inline int serializeFunctionParams(std::ostream &os, uint32_t function, const vo
     }
     return 0;
 }
+
+/// returns the name of the API function of a ${x}_function_t,
+/// nullptr for an unknown function
+inline const char *getFunctionName(uint32_t function) {
+    switch((enum ${x}_function_t)function) {
+    %for tbl in th.get_pfncbtables(specs, meta, n, tags):
+    %for obj in tbl['functions']:
+        case ${th.make_func_etor(n, tags, obj)}:
+            return "${th.make_func_name(n, tags, obj)}";
+    %endfor
+    %endfor
+        default: return nullptr;
+    }
+}
+
+/// returns the event a call to a function that enqueues a command returned,
+/// nullptr for other functions and for calls that did not ask for an event
+inline ${x}_event_handle_t getEnqueuedEvent(uint32_t function, const void *params) {
+    switch((enum ${x}_function_t)function) {
+    %for tbl in th.get_pfncbtables(specs, meta, n, tags):
+    %for obj in tbl['functions']:
+    %if obj['class'] == '$xEnqueue' and any(item['name'] == 'phEvent' for item in obj['params']):
+        case ${th.make_func_etor(n, tags, obj)}: {
+            auto p = (const struct ${th.make_pfncb_param_type(n, tags, obj)} *)params;
+            return *p->pphEvent ? **p->pphEvent : nullptr;
+        }
+    %endif
+    %endfor
+    %endfor
+        default: return nullptr;
+    }
+}
+
+/// writes the parameters of a call as typed fields, for the structured trace
+/// formats. The writer gets a call for every parameter of the function:
+/// - `number(name, value)` for the integer parameters
+/// - `boolean(name, value)` for the bool parameters
+/// - `pointer(name, ptr)` for the handles
+/// - `text(name, serialize)` for the others, where `serialize(os)` prints the
+///   value as serializeFunctionParams does
+template <typename Writer>
+inline int serializeFunctionParamFields(Writer &writer, uint32_t function, const void *args) {
+    switch((enum ${x}_function_t)function) {
+    %for tbl in th.get_pfncbtables(specs, meta, n, tags):
+    %for obj in tbl['functions']:
+        case ${th.make_func_etor(n, tags, obj)}: {
+            <%
+                params_dict = dict()
+                for item in obj['params']:
+                    iname = th._get_param_name(n, tags, item)
+                    itype = th._get_type_name(n, tags, obj, item)
+                    params_dict[iname] = itype
+            %>
+            auto params = (const struct ${th.make_pfncb_param_type(n, tags, obj)} *)args;
+            %for item in obj['params']:
+            <%
+                iname = th._get_param_name(n, tags, item)
+                itype = item['type']
+            %>
+            %if th.type_traits.is_integer(itype):
+            writer.number("${iname}", *(params->p${iname}));
+            %elif itype == "bool":
+            writer.boolean("${iname}", *(params->p${iname}));
+            %elif th.type_traits.is_handle(itype) and not th.type_traits.is_pointer(itype):
+            writer.pointer("${iname}", *(params->p${iname}));
+            %else:
+            writer.text("${iname}", [&](std::ostream &os) {
+                ${line(item, 0, True, params_dict, False)}
+            });
+            %endif
+            %endfor
+        } break;
+    %endfor
+    %endfor
+        default: return -1;
+    }
+    return 0;
+}
+
+/// how the capture of the calls records a parameter of a function
+enum class param_kind_t : uint8_t {
+    value,        ///< passed by value
+    handle,       ///< handle, remapped when replayed
+    handle_array, ///< array of `count` handles
+    handle_out,   ///< returns `count` handles, or one if there is no count
+    data,         ///< array of `count` elements of `size` bytes, or one
+    desc,         ///< descriptor or properties struct, its pNext chain is
+                  ///< not captured
+    string,       ///< null-terminated string
+    memory,       ///< USM or host memory the function reads `count` bytes of
+    memory_out,   ///< USM or host memory the function writes `count` bytes to
+    alloc_out,    ///< returns a pointer to `count` bytes of USM or host memory
+    out,          ///< returns `count` elements of `size` bytes, or one
+    ignored,      ///< passed as null when replayed
+    unsupported,  ///< a call with this parameter not null cannot be replayed
+};
+
+/// capture description of a parameter of a function
+struct capture_param_t {
+    param_kind_t kind;
+    uint32_t size; ///< size of the value, or of an element of the array
+    int32_t count; ///< index of the parameter holding the number of elements
+                   ///< or bytes, -1 if there is none
+};
+
+/// returns the capture description of the parameters of a function, one per
+/// member of its params struct, nullptr for an unknown function
+inline const capture_param_t *getCaptureParams(uint32_t function, size_t *count) {
+    switch((enum ${x}_function_t)function) {
+    %for tbl in th.get_pfncbtables(specs, meta, n, tags):
+    %for obj in tbl['functions']:
+        case ${th.make_func_etor(n, tags, obj)}: {
+            static const capture_param_t params[] = {
+            %for item in obj['params']:
+                ${capture_param(n, tags, specs, meta, obj, item)},
+            %endfor
+            };
+            *count = sizeof(params) / sizeof(params[0]);
+            return params;
+        }
+    %endfor
+    %endfor
+        default: return nullptr;
+    }
+}
+
+/// calls a function with the arguments of a params struct
+inline ${x}_result_t replayCall(uint32_t function, const void *params) {
+    switch((enum ${x}_function_t)function) {
+    %for tbl in th.get_pfncbtables(specs, meta, n, tags):
+    %for obj in tbl['functions']:
+        case ${th.make_func_etor(n, tags, obj)}: {
+            auto p = (const struct ${th.make_pfncb_param_type(n, tags, obj)} *)params;
+            return ${th.make_func_name(n, tags, obj)}(${", ".join("*p->p" + item['name'] for item in obj['params'])});
+        }
+    %endfor
+    %endfor
+        default: return ${X}_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+}
 } // namespace ur_params
 
 #endif /* ${X}_PARAMS_HPP */
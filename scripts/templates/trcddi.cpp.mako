@@ -40,8 +40,13 @@ namespace ur_tracing_layer
         if( nullptr == ${th.make_pfn_name(n, tags, obj)} )
             return ${X}_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !context.is_subscribed(${th.make_func_etor(n, tags, obj)}) )
+            return ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+
         ${th.make_pfncb_param_type(n, tags, obj)} params = { &${",&".join(th.make_param_lines(n, tags, obj, format=["name"]))} };
-        uint64_t instance = context.notify_begin(${th.make_func_etor(n, tags, obj)}, "${th.make_func_name(n, tags, obj)}", &params);
+        <%
+            handle = th.get_first_handle_param(n, tags, obj)
+        %>uint64_t instance = context.notify_begin(${th.make_func_etor(n, tags, obj)}, "${th.make_func_name(n, tags, obj)}", &params${", " + handle if handle else ""});
 
         ${x}_result_t result = ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
 
@@ -111,6 +116,9 @@ namespace ur_tracing_layer
         }
 
     %endfor
+        // pick up the subscribers registered since the layer was created
+        refresh_subscriptions();
+
         return result;
     }
 } /* namespace ur_tracing_layer */
@@ -8,6 +8,53 @@ from templates import helper as th
     x=tags['$x']
     X=x.upper()
     create_retain_release_funcs=th.get_create_retain_release_functions(specs, n, tags)
+    lifetime_errors={
+        n + "_context_handle_t": X + "_RESULT_ERROR_INVALID_CONTEXT",
+        n + "_mem_handle_t": X + "_RESULT_ERROR_INVALID_MEM_OBJECT",
+        n + "_sampler_handle_t": X + "_RESULT_ERROR_INVALID_SAMPLER",
+        n + "_program_handle_t": X + "_RESULT_ERROR_INVALID_PROGRAM",
+        n + "_kernel_handle_t": X + "_RESULT_ERROR_INVALID_KERNEL",
+        n + "_queue_handle_t": X + "_RESULT_ERROR_INVALID_QUEUE",
+        n + "_event_handle_t": X + "_RESULT_ERROR_INVALID_EVENT",
+    }
+    usm_allocs=[n + "USMHostAlloc", n + "USMDeviceAlloc", n + "USMSharedAlloc"]
+    usm_checks={
+        n + "EnqueueUSMFill": [
+            ("!usmAllocations.inBounds(ptr, size)", X + "_RESULT_ERROR_INVALID_SIZE")],
+        n + "EnqueueUSMMemcpy": [
+            ("!usmAllocations.inBounds(pDst, size)", X + "_RESULT_ERROR_INVALID_SIZE"),
+            ("!usmAllocations.inBounds(pSrc, size)", X + "_RESULT_ERROR_INVALID_SIZE"),
+            ("rangesOverlap(pDst, pSrc, size)", X + "_RESULT_ERROR_OVERLAPPING_REGIONS")],
+        n + "EnqueueUSMPrefetch": [
+            ("!usmAllocations.inBounds(pMem, size)", X + "_RESULT_ERROR_INVALID_SIZE")],
+        n + "EnqueueUSMAdvise": [
+            ("!usmAllocations.inBounds(pMem, size)", X + "_RESULT_ERROR_INVALID_SIZE")],
+        n + "EnqueueUSMFill2D": [
+            ("!usmAllocations.inBounds(pMem, pitch * (height - 1) + width)", X + "_RESULT_ERROR_INVALID_SIZE")],
+        n + "EnqueueUSMMemcpy2D": [
+            ("!usmAllocations.inBounds(pDst, dstPitch * (height - 1) + width)", X + "_RESULT_ERROR_INVALID_SIZE"),
+            ("!usmAllocations.inBounds(pSrc, srcPitch * (height - 1) + width)", X + "_RESULT_ERROR_INVALID_SIZE"),
+            ("regionsOverlap2D(pDst, dstPitch, pSrc, srcPitch, width, height)", X + "_RESULT_ERROR_OVERLAPPING_REGIONS")],
+    }
+    perf_lint_hooks={
+        n + "EnqueueMemBufferRead": ["onMemBufferRead(blockingRead)"],
+        n + "EnqueueUSMMemcpy": ["onUSMMemcpy(size)"],
+        n + "QueueFinish": ["onQueueFinish(hQueue)"],
+        n + "QueueRelease": ["onQueueRelease(hQueue)"],
+        n + "KernelSetArgValue": ["onKernelSetArgValue(hKernel, argIndex, argSize, pArgValue)"],
+        n + "KernelSetArgLocal": ["onKernelSetArg(hKernel, argIndex)"],
+        n + "KernelSetArgPointer": ["onKernelSetArg(hKernel, argIndex)"],
+        n + "KernelSetArgSampler": ["onKernelSetArg(hKernel, argIndex)"],
+        n + "KernelSetArgMemObj": ["onKernelSetArg(hKernel, argIndex)"],
+        n + "KernelRelease": ["onKernelRelease(hKernel)"],
+        n + "ProgramCreateWithIL": ["onProgramCreateWithIL(hContext, pIL, length)"],
+        n + "ProgramRelease": ["onProgramRelease(hProgram)"],
+        n + "ContextRelease": ["onContextRelease(hContext)"],
+    }
+    ## called once the adapter succeeded, for the handles it returns
+    perf_lint_post_hooks={
+        n + "KernelCreate": ["onKernelCreate(hProgram, *phKernel)"],
+    }
 %>/*
  *
  * Copyright (C) 2023 Intel Corporation
@@ -18,6 +65,8 @@ from templates import helper as th
  *
  */
 #include "${x}_leak_check.hpp"
+#include "${x}_perf_lint.hpp"
+#include "${x}_usm_allocations.hpp"
 #include "${x}_validation_layer.hpp"
 
 namespace ur_validation_layer
@@ -30,6 +79,18 @@ namespace ur_validation_layer
         param_checks=th.make_param_checks(n, tags, obj, meta=meta).items()
         first_errors = [X + "_RESULT_ERROR_INVALID_NULL_POINTER", X + "_RESULT_ERROR_INVALID_NULL_HANDLE"]
         sorted_param_checks = sorted(param_checks, key=lambda pair: False if pair[0] in first_errors else True)
+        lifetime_checks=[]
+        for item in obj['params']:
+            handle_type=re.sub(r"^const |\*$", "", th.subt(n, tags, item['type']))
+            if not th.param_traits.is_input(item) or handle_type not in create_retain_release_funcs["tracked_types"]:
+                continue
+            if th.param_traits.is_range(item):
+                error=X + "_RESULT_ERROR_INVALID_EVENT_WAIT_LIST" if handle_type == n + "_event_handle_t" else lifetime_errors.get(handle_type, X + "_RESULT_ERROR_INVALID_ARGUMENT")
+                lifetime_checks.append((item['name'], th.param_traits.range_end(item), error))
+            elif not item['type'].endswith("*"):
+                lifetime_checks.append((item['name'], None, lifetime_errors.get(handle_type, X + "_RESULT_ERROR_INVALID_ARGUMENT")))
+        created_handles=create_retain_release_funcs["create"].get(func_name, [])
+        perf_lint_calls=(["onEnqueue(hQueue)"] if func_name.startswith(n + "Enqueue") else []) + perf_lint_hooks.get(func_name, [])
     %>
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for ${th.make_func_name(n, tags, obj)}
@@ -57,33 +118,117 @@ namespace ur_validation_layer
 
             %endfor
             %endfor
+            ## the bounds of the USM allocations, once the arguments are known to be valid
+            %for check, error in usm_checks.get(func_name, []):
+            if( ${check} )
+                return ${error};
+
+            %endfor
+        }
+
+        %if lifetime_checks:
+        if( context.enableLifetimeValidation )
+        {
+            %for handle, count, error in lifetime_checks:
+            %if count:
+            for( uint32_t i = 0; ${handle} && i < ${count}; ++i )
+            {
+                if( !refCountContext.isLive( ${handle}[i], __func__ ) )
+                    return ${error};
+            }
+            %else:
+            if( ${handle} && !refCountContext.isLive( ${handle}, __func__ ) )
+                return ${error};
+            %endif
+
+            %endfor
+        }
+
+        %endif
+        %if perf_lint_calls:
+        if( context.enablePerfLint )
+        {
+            %for call in perf_lint_calls:
+            perfLintContext.${call};
+            %endfor
+        }
+
+        %endif
+        %if func_name in create_retain_release_funcs["release"]:
+        if( context.enableHandleTracking )
+        {
+            // the handle is forgotten before the adapter releases it, which
+            // may hand out its address to a create on another thread at once
+            refCountContext.decrementRefCount(${object_param});
+        }
+
+        %endif
+        %if func_name == n + "USMFree":
+        if( context.enableParameterValidation )
+        {
+            usmAllocations.remove(pMem);
         }
 
+        %endif
         ${x}_result_t result = ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
 
-        %if func_name in create_retain_release_funcs["create"]:
-        if( context.enableLeakChecking && result == UR_RESULT_SUCCESS )
+        %if func_name in perf_lint_post_hooks:
+        if( context.enablePerfLint && result == UR_RESULT_SUCCESS )
+        {
+            %for call in perf_lint_post_hooks[func_name]:
+            perfLintContext.${call};
+            %endfor
+        }
+
+        %endif
+        %if created_handles:
+        if( context.enableHandleTracking && result == UR_RESULT_SUCCESS${"".join(" && " + h['name'] for h in created_handles if h['optional'])} )
         {
-            refCountContext.createRefCount(*${object_param});
+            %for h in created_handles:
+            refCountContext.createRefCount(*${h['name']});
+            %endfor
         }
+
         %elif func_name in create_retain_release_funcs["retain"]:
-        if( context.enableLeakChecking && result == UR_RESULT_SUCCESS )
+        if( context.enableHandleTracking && result == UR_RESULT_SUCCESS )
         {
             refCountContext.incrementRefCount(${object_param});
         }
+
         %elif func_name in create_retain_release_funcs["release"]:
-        if( context.enableLeakChecking && result == UR_RESULT_SUCCESS )
+        if( context.enableHandleTracking && result != UR_RESULT_SUCCESS )
         {
-            refCountContext.decrementRefCount(${object_param});
+            refCountContext.restoreRefCount(${object_param});
         }
+
+        %elif func_name in usm_allocs:
+        if( context.enableParameterValidation && result == UR_RESULT_SUCCESS )
+        {
+            usmAllocations.add(*ppMem, size);
+        }
+
         %elif func_name == n + "TearDown":
-        if ( context.enableLeakChecking )
+        if ( context.enableHandleTracking )
         {
-            refCountContext.logInvalidReferences();
+            if ( context.enableLeakChecking )
+            {
+                refCountContext.logInvalidReferences();
+            }
             refCountContext.clear();
         }
-        %endif
 
+        if ( context.enableParameterValidation )
+        {
+            usmAllocations.clear();
+        }
+
+        if ( context.enablePerfLint )
+        {
+            perfLintContext.logFindings();
+            perfLintContext.clear();
+        }
+
+        %endif
         return result;
     }
     %if 'condition' in obj:
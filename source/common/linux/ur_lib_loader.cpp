@@ -6,6 +6,7 @@
  *
  */
 #include <dlfcn.h>
+#include <link.h>
 
 #include "logger/ur_logger.hpp"
 #include "ur_lib_loader.hpp"
@@ -40,4 +41,13 @@ void *LibLoader::getFunctionPtr(HMODULE handle, const char *func_name) {
     return dlsym(handle, func_name);
 }
 
+std::string LibLoader::getLibraryPath(HMODULE handle) {
+    struct link_map *map = nullptr;
+    if (dlinfo(handle, RTLD_DI_LINKMAP, &map) != 0 || nullptr == map ||
+        nullptr == map->l_name) {
+        return std::string();
+    }
+    return map->l_name;
+}
+
 } // namespace ur_loader
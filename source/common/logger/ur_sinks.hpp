@@ -4,9 +4,19 @@
 #ifndef UR_SINKS_HPP
 #define UR_SINKS_HPP 1
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <condition_variable>
+#include <deque>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 #if __has_include(<filesystem>)
 #include <filesystem>
@@ -24,15 +34,15 @@ class Sink {
   public:
     template <typename... Args>
     void log(logger::Level level, const char *fmt, Args &&...args) {
+        MessageGuard message(*this);
+        std::ostream &os = message.begin();
         if (!skip_prefix) {
-            *ostream << "<" << logger_name << ">";
-            *ostream << "[" << level_to_str(level) << "]: ";
-        }
-        format(fmt, std::forward<Args &&>(args)...);
-        *ostream << "\n";
-        if (level >= flush_level) {
-            ostream->flush();
+            os << "<" << logger_name << ">";
+            os << "[" << level_to_str(level) << "]: ";
         }
+        format(os, fmt, std::forward<Args &&>(args)...);
+        os << "\n";
+        message.end(level);
     }
 
     void setFlushLevel(logger::Level level) { this->flush_level = level; }
@@ -48,26 +58,70 @@ class Sink {
         flush_level = logger::Level::ERR;
     }
 
+    /// returns the stream a message is formatted into
+    virtual std::ostream &beginMessage() { return *ostream; }
+
+    /// called once a message has been formatted
+    virtual void endMessage(logger::Level level) {
+        if (level >= flush_level) {
+            ostream->flush();
+        }
+    }
+
+    /// called instead of endMessage when formatting a message throws, the
+    /// part already written straight to the stream cannot be taken back
+    virtual void abortMessage() {}
+
   private:
     std::string logger_name;
     bool skip_prefix;
 
-    void format(const char *fmt) {
+    /// ends the message being logged, or aborts it if it is left by an
+    /// exception
+    class MessageGuard {
+      public:
+        explicit MessageGuard(Sink &sink) : sink(sink) {}
+        MessageGuard(const MessageGuard &) = delete;
+        MessageGuard &operator=(const MessageGuard &) = delete;
+
+        ~MessageGuard() {
+            if (begun) {
+                sink.abortMessage();
+            }
+        }
+
+        std::ostream &begin() {
+            std::ostream &os = sink.beginMessage();
+            begun = true;
+            return os;
+        }
+
+        void end(logger::Level level) {
+            begun = false;
+            sink.endMessage(level);
+        }
+
+      private:
+        Sink &sink;
+        bool begun = false;
+    };
+
+    void format(std::ostream &os, const char *fmt) {
         while (*fmt != '\0') {
             while (*fmt != '{' && *fmt != '}' && *fmt != '\0') {
-                *ostream << *fmt++;
+                os << *fmt++;
             }
 
             if (*fmt == '{') {
                 if (*(++fmt) == '{') {
-                    *ostream << *fmt++;
+                    os << *fmt++;
                 } else {
                     throw std::runtime_error(
                         "No arguments provided and braces not escaped!");
                 }
             } else if (*fmt == '}') {
                 if (*(++fmt) == '}') {
-                    *ostream << *fmt++;
+                    os << *fmt++;
                 } else {
                     throw std::runtime_error(
                         "Closing curly brace not escaped!");
@@ -77,25 +131,25 @@ class Sink {
     }
 
     template <typename Arg, typename... Args>
-    void format(const char *fmt, Arg &&arg, Args &&...args) {
+    void format(std::ostream &os, const char *fmt, Arg &&arg, Args &&...args) {
         bool arg_printed = false;
         while (!arg_printed) {
             while (*fmt != '{' && *fmt != '}' && *fmt != '\0') {
-                *ostream << *fmt++;
+                os << *fmt++;
             }
 
             if (*fmt == '{') {
                 if (*(++fmt) == '{') {
-                    *ostream << *fmt++;
+                    os << *fmt++;
                 } else if (*fmt != '}') {
                     throw std::runtime_error("Only empty braces are allowed!");
                 } else {
-                    *ostream << arg;
+                    os << arg;
                     arg_printed = true;
                 }
             } else if (*fmt == '}') {
                 if (*(++fmt) == '}') {
-                    *ostream << *fmt++;
+                    os << *fmt++;
                 } else {
                     throw std::runtime_error(
                         "Closing curly brace not escaped!");
@@ -103,7 +157,7 @@ class Sink {
             }
         }
 
-        format(++fmt, std::forward<Args &&>(args)...);
+        format(os, ++fmt, std::forward<Args &&>(args)...);
     }
 };
 
@@ -163,6 +217,283 @@ class FileSink : public Sink {
     std::ofstream ofstream;
 };
 
+/// writes the messages to a file from a background thread
+///
+/// every logging thread formats its messages into its own buffer, under a
+/// lock only the writer thread may contend on, full buffers are handed over
+/// to the writer through a bounded queue, and the writer collects the
+/// partially filled ones periodically
+///
+/// a logging thread waits only when the queue is full, a message at or above
+/// the flush level is written and flushed by the logging thread itself,
+/// together with everything queued before it
+class AsyncFileSink : public Sink {
+  public:
+    AsyncFileSink(std::string logger_name, filesystem::path file_path,
+                  bool skip_prefix = false)
+        : Sink(logger_name, skip_prefix) {
+        ofstream = std::ofstream(file_path);
+        if (!ofstream.good()) {
+            std::stringstream ss;
+            ss << "Failure while opening log file " << file_path.string()
+               << ". Check if given path exists.";
+            throw std::invalid_argument(ss.str());
+        }
+        this->ostream = &ofstream;
+        buffers.push_back(exitBuffer);
+        writer = std::thread([this] { writeLoop(); });
+    }
+
+    AsyncFileSink(std::string logger_name, filesystem::path file_path,
+                  Level flush_lvl, bool skip_prefix = false)
+        : AsyncFileSink(logger_name, file_path, skip_prefix) {
+        this->flush_level = flush_lvl;
+    }
+
+    ~AsyncFileSink() {
+        {
+            std::scoped_lock<std::mutex> lock(mut);
+            stopping = true;
+        }
+        notEmpty.notify_one();
+        writer.join();
+    }
+
+  protected:
+    std::ostream &beginMessage() override {
+        auto buffer = threadBuffer();
+        buffer->mut.lock();
+        buffer->messageStart = buffer->data.size();
+        return buffer->stream;
+    }
+
+    void endMessage(logger::Level level) override {
+        auto buffer = threadBuffer();
+        buffer->stream.flush();
+        bool flush = level >= flush_level;
+        if (flush || buffer->data.size() >= bufferSize) {
+            push(*buffer, !flush);
+        }
+        buffer->mut.unlock();
+
+        if (flush) {
+            writeQueued(true);
+        }
+    }
+
+    void abortMessage() override {
+        auto buffer = threadBuffer();
+        buffer->stream.flush();
+        buffer->stream.clear();
+        buffer->data.resize(buffer->messageStart);
+        buffer->mut.unlock();
+    }
+
+  private:
+    /// size at which a thread hands its buffer over to the writer
+    static constexpr size_t bufferSize = 16 * 1024;
+    /// number of buffers queued before the logging threads wait
+    static constexpr size_t maxQueued = 256;
+    /// how often the writer collects the partially filled buffers
+    static constexpr auto collectPeriod = std::chrono::milliseconds(50);
+
+    /// appends everything written to the stream to a string, through a small
+    /// put area, so that single characters do not take a virtual call each
+    class StringBuf : public std::streambuf {
+      public:
+        explicit StringBuf(std::string &str) : str(str) {
+            setp(area, area + sizeof(area));
+        }
+
+      protected:
+        int_type overflow(int_type c) override {
+            sync();
+            if (!traits_type::eq_int_type(c, traits_type::eof())) {
+                str.push_back(traits_type::to_char_type(c));
+            }
+            return traits_type::not_eof(c);
+        }
+
+        int sync() override {
+            str.append(pbase(), pptr() - pbase());
+            setp(area, area + sizeof(area));
+            return 0;
+        }
+
+      private:
+        std::string &str;
+        char area[256];
+    };
+
+    struct ThreadBuffer {
+        std::mutex mut; ///< held by the owning thread while it formats
+        std::string data;
+        StringBuf buf{data};
+        std::ostream stream{&buf};
+        size_t messageStart = 0; ///< size of data before the current message
+        /// set once the owning thread is gone, the buffer is dropped once
+        /// its content is queued
+        std::atomic<bool> orphaned = false;
+    };
+
+    /// the buffers of a thread, for every async sink it logs to
+    /// keyed by the sink id, a new sink may reuse the address of a destroyed
+    /// one
+    struct ThreadBuffers {
+        std::vector<std::pair<uint64_t, std::shared_ptr<ThreadBuffer>>>
+            buffers;
+        ~ThreadBuffers() {
+            threadBuffersDestroyed = true;
+            for (auto &[sinkId, buffer] : buffers) {
+                buffer->orphaned = true;
+            }
+        }
+    };
+
+    /// trivially destructible, so that it can still be read once the
+    /// buffers of the thread are gone
+    static inline thread_local bool threadBuffersDestroyed = false;
+
+    static uint64_t nextId() {
+        static std::atomic<uint64_t> next{0};
+        return next++;
+    }
+
+    std::shared_ptr<ThreadBuffer> threadBuffer() {
+        if (threadBuffersDestroyed) {
+            // logging from static or thread-local destructors, after the
+            // buffers of the thread are gone
+            return exitBuffer;
+        }
+        static thread_local ThreadBuffers threadBuffers;
+        for (auto &[sinkId, buffer] : threadBuffers.buffers) {
+            if (sinkId == id) {
+                return buffer;
+            }
+        }
+
+        auto buffer = std::make_shared<ThreadBuffer>();
+        {
+            std::scoped_lock<std::mutex> lock(mut);
+            buffers.push_back(buffer);
+        }
+        threadBuffers.buffers.emplace_back(id, buffer);
+        return buffer;
+    }
+
+    /// queues the content of a buffer, the caller holds the buffer's lock,
+    /// waits for room in the queue unless the caller writes it out itself
+    void push(ThreadBuffer &buffer, bool wait) {
+        if (buffer.data.empty()) {
+            return;
+        }
+
+        std::unique_lock<std::mutex> lock(mut);
+        if (wait) {
+            notFull.wait(lock, [this] { return queue.size() < maxQueued; });
+        }
+        queue.push_back(std::move(buffer.data));
+        buffer.data.clear();
+        // a flushing thread writes the queue right after, no need to wake up
+        // the writer for it
+        if (wait && writerIdle) {
+            notEmpty.notify_one();
+        }
+    }
+
+    /// queues the partially filled buffers of the threads that are not
+    /// logging right now, and drops the buffers of the exited threads
+    void collect() {
+        std::vector<std::shared_ptr<ThreadBuffer>> pending;
+        {
+            std::scoped_lock<std::mutex> lock(mut);
+            pending = buffers;
+        }
+        std::vector<ThreadBuffer *> drained;
+        for (auto &buffer : pending) {
+            if (buffer->mut.try_lock()) {
+                // read before the push, so that it covers all the messages
+                // of the thread if set
+                bool orphaned = buffer->orphaned;
+                push(*buffer, false);
+                buffer->mut.unlock();
+                if (orphaned) {
+                    drained.push_back(buffer.get());
+                }
+            }
+        }
+        if (drained.empty()) {
+            return;
+        }
+
+        std::scoped_lock<std::mutex> lock(mut);
+        buffers.erase(std::remove_if(buffers.begin(), buffers.end(),
+                                     [&](const auto &buffer) {
+                                         return std::find(drained.begin(),
+                                                          drained.end(),
+                                                          buffer.get()) !=
+                                                drained.end();
+                                     }),
+                      buffers.end());
+    }
+
+    /// writes out the queue, in the order it was filled
+    void writeQueued(bool flush) {
+        std::vector<std::string> batch;
+        std::scoped_lock<std::mutex> fileLock(fileMut);
+        {
+            std::scoped_lock<std::mutex> lock(mut);
+            batch.assign(std::make_move_iterator(queue.begin()),
+                         std::make_move_iterator(queue.end()));
+            queue.clear();
+        }
+        notFull.notify_all();
+
+        for (auto &data : batch) {
+            ofstream << data;
+        }
+        if (flush) {
+            ofstream.flush();
+        }
+    }
+
+    void writeLoop() {
+        bool stop = false;
+        while (!stop) {
+            {
+                std::unique_lock<std::mutex> lock(mut);
+                writerIdle = true;
+                notEmpty.wait_for(lock, collectPeriod, [this] {
+                    return !queue.empty() || stopping;
+                });
+                writerIdle = false;
+                stop = stopping;
+            }
+
+            collect();
+            writeQueued(stop);
+        }
+    }
+
+    std::mutex fileMut; ///< serializes writing the queue to the file
+    std::ofstream ofstream;
+
+    std::mutex mut; ///< guards the members below
+    std::condition_variable notEmpty;
+    std::condition_variable notFull;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    std::deque<std::string> queue;
+    bool writerIdle = false;
+    bool stopping = false;
+
+    const uint64_t id = nextId();
+    /// shared by the threads logging after their buffers are gone, collected
+    /// like the others
+    std::shared_ptr<ThreadBuffer> exitBuffer =
+        std::make_shared<ThreadBuffer>();
+    std::thread writer;
+};
+
 inline std::unique_ptr<Sink> sink_from_str(std::string logger_name,
                                            std::string name,
                                            std::filesystem::path file_path = "",
@@ -174,12 +505,16 @@ inline std::unique_ptr<Sink> sink_from_str(std::string logger_name,
     } else if (name == "file" && !file_path.empty()) {
         return std::make_unique<logger::FileSink>(logger_name, file_path,
                                                   skip_prefix);
+    } else if (name == "async_file" && !file_path.empty()) {
+        return std::make_unique<logger::AsyncFileSink>(logger_name, file_path,
+                                                       skip_prefix);
     }
 
     throw std::invalid_argument(
         std::string("Parsing error: no valid sink for string '") + name +
         std::string("' with path '") + file_path.string() + std::string("'.") +
-        std::string("\nValid sink names are: stdout, stderr, file"));
+        std::string("\nValid sink names are: stdout, stderr, file, "
+                    "async_file"));
 }
 
 } // namespace logger
@@ -9,6 +9,7 @@
 #define UR_LIB_LOADER_HPP 1
 
 #include <memory>
+#include <string>
 
 #include "ur_util.hpp"
 
@@ -27,6 +28,9 @@ class LibLoader {
     static void freeAdapterLibrary(HMODULE handle);
 
     static void *getFunctionPtr(HMODULE handle, const char *func_name);
+
+    /// returns the path the library was loaded from, empty if unknown
+    static std::string getLibraryPath(HMODULE handle);
 };
 
 } // namespace ur_loader
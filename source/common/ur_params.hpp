@@ -11293,6 +11293,3876 @@ inline int serializeFunctionParams(std::ostream &os, uint32_t function,
     }
     return 0;
 }
+/// returns the name of the API function of a ur_function_t,
+/// nullptr for an unknown function
+inline const char *getFunctionName(uint32_t function) {
+    switch ((enum ur_function_t)function) {
+    case UR_FUNCTION_INIT:
+        return "urInit";
+    case UR_FUNCTION_GET_LAST_RESULT:
+        return "urGetLastResult";
+    case UR_FUNCTION_TEAR_DOWN:
+        return "urTearDown";
+    case UR_FUNCTION_CONTEXT_CREATE:
+        return "urContextCreate";
+    case UR_FUNCTION_CONTEXT_RETAIN:
+        return "urContextRetain";
+    case UR_FUNCTION_CONTEXT_RELEASE:
+        return "urContextRelease";
+    case UR_FUNCTION_CONTEXT_GET_INFO:
+        return "urContextGetInfo";
+    case UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE:
+        return "urContextGetNativeHandle";
+    case UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE:
+        return "urContextCreateWithNativeHandle";
+    case UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER:
+        return "urContextSetExtendedDeleter";
+    case UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH:
+        return "urEnqueueKernelLaunch";
+    case UR_FUNCTION_ENQUEUE_EVENTS_WAIT:
+        return "urEnqueueEventsWait";
+    case UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER:
+        return "urEnqueueEventsWaitWithBarrier";
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ:
+        return "urEnqueueMemBufferRead";
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE:
+        return "urEnqueueMemBufferWrite";
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT:
+        return "urEnqueueMemBufferReadRect";
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT:
+        return "urEnqueueMemBufferWriteRect";
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY:
+        return "urEnqueueMemBufferCopy";
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT:
+        return "urEnqueueMemBufferCopyRect";
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL:
+        return "urEnqueueMemBufferFill";
+    case UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ:
+        return "urEnqueueMemImageRead";
+    case UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE:
+        return "urEnqueueMemImageWrite";
+    case UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY:
+        return "urEnqueueMemImageCopy";
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP:
+        return "urEnqueueMemBufferMap";
+    case UR_FUNCTION_ENQUEUE_MEM_UNMAP:
+        return "urEnqueueMemUnmap";
+    case UR_FUNCTION_ENQUEUE_USM_FILL:
+        return "urEnqueueUSMFill";
+    case UR_FUNCTION_ENQUEUE_USM_MEMCPY:
+        return "urEnqueueUSMMemcpy";
+    case UR_FUNCTION_ENQUEUE_USM_PREFETCH:
+        return "urEnqueueUSMPrefetch";
+    case UR_FUNCTION_ENQUEUE_USM_ADVISE:
+        return "urEnqueueUSMAdvise";
+    case UR_FUNCTION_ENQUEUE_USM_FILL2_D:
+        return "urEnqueueUSMFill2D";
+    case UR_FUNCTION_ENQUEUE_USM_MEMCPY2_D:
+        return "urEnqueueUSMMemcpy2D";
+    case UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE:
+        return "urEnqueueDeviceGlobalVariableWrite";
+    case UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ:
+        return "urEnqueueDeviceGlobalVariableRead";
+    case UR_FUNCTION_EVENT_GET_INFO:
+        return "urEventGetInfo";
+    case UR_FUNCTION_EVENT_GET_PROFILING_INFO:
+        return "urEventGetProfilingInfo";
+    case UR_FUNCTION_EVENT_WAIT:
+        return "urEventWait";
+    case UR_FUNCTION_EVENT_RETAIN:
+        return "urEventRetain";
+    case UR_FUNCTION_EVENT_RELEASE:
+        return "urEventRelease";
+    case UR_FUNCTION_EVENT_GET_NATIVE_HANDLE:
+        return "urEventGetNativeHandle";
+    case UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE:
+        return "urEventCreateWithNativeHandle";
+    case UR_FUNCTION_EVENT_SET_CALLBACK:
+        return "urEventSetCallback";
+    case UR_FUNCTION_KERNEL_CREATE:
+        return "urKernelCreate";
+    case UR_FUNCTION_KERNEL_GET_INFO:
+        return "urKernelGetInfo";
+    case UR_FUNCTION_KERNEL_GET_GROUP_INFO:
+        return "urKernelGetGroupInfo";
+    case UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO:
+        return "urKernelGetSubGroupInfo";
+    case UR_FUNCTION_KERNEL_RETAIN:
+        return "urKernelRetain";
+    case UR_FUNCTION_KERNEL_RELEASE:
+        return "urKernelRelease";
+    case UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE:
+        return "urKernelGetNativeHandle";
+    case UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE:
+        return "urKernelCreateWithNativeHandle";
+    case UR_FUNCTION_KERNEL_SET_ARG_VALUE:
+        return "urKernelSetArgValue";
+    case UR_FUNCTION_KERNEL_SET_ARG_LOCAL:
+        return "urKernelSetArgLocal";
+    case UR_FUNCTION_KERNEL_SET_ARG_POINTER:
+        return "urKernelSetArgPointer";
+    case UR_FUNCTION_KERNEL_SET_EXEC_INFO:
+        return "urKernelSetExecInfo";
+    case UR_FUNCTION_KERNEL_SET_ARG_SAMPLER:
+        return "urKernelSetArgSampler";
+    case UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ:
+        return "urKernelSetArgMemObj";
+    case UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS:
+        return "urKernelSetSpecializationConstants";
+    case UR_FUNCTION_MEM_IMAGE_CREATE:
+        return "urMemImageCreate";
+    case UR_FUNCTION_MEM_BUFFER_CREATE:
+        return "urMemBufferCreate";
+    case UR_FUNCTION_MEM_RETAIN:
+        return "urMemRetain";
+    case UR_FUNCTION_MEM_RELEASE:
+        return "urMemRelease";
+    case UR_FUNCTION_MEM_BUFFER_PARTITION:
+        return "urMemBufferPartition";
+    case UR_FUNCTION_MEM_GET_NATIVE_HANDLE:
+        return "urMemGetNativeHandle";
+    case UR_FUNCTION_MEM_CREATE_WITH_NATIVE_HANDLE:
+        return "urMemCreateWithNativeHandle";
+    case UR_FUNCTION_MEM_GET_INFO:
+        return "urMemGetInfo";
+    case UR_FUNCTION_MEM_IMAGE_GET_INFO:
+        return "urMemImageGetInfo";
+    case UR_FUNCTION_PLATFORM_GET:
+        return "urPlatformGet";
+    case UR_FUNCTION_PLATFORM_GET_INFO:
+        return "urPlatformGetInfo";
+    case UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE:
+        return "urPlatformGetNativeHandle";
+    case UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE:
+        return "urPlatformCreateWithNativeHandle";
+    case UR_FUNCTION_PLATFORM_GET_API_VERSION:
+        return "urPlatformGetApiVersion";
+    case UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION:
+        return "urPlatformGetBackendOption";
+    case UR_FUNCTION_PROGRAM_CREATE_WITH_IL:
+        return "urProgramCreateWithIL";
+    case UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY:
+        return "urProgramCreateWithBinary";
+    case UR_FUNCTION_PROGRAM_BUILD:
+        return "urProgramBuild";
+    case UR_FUNCTION_PROGRAM_COMPILE:
+        return "urProgramCompile";
+    case UR_FUNCTION_PROGRAM_LINK:
+        return "urProgramLink";
+    case UR_FUNCTION_PROGRAM_RETAIN:
+        return "urProgramRetain";
+    case UR_FUNCTION_PROGRAM_RELEASE:
+        return "urProgramRelease";
+    case UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER:
+        return "urProgramGetFunctionPointer";
+    case UR_FUNCTION_PROGRAM_GET_INFO:
+        return "urProgramGetInfo";
+    case UR_FUNCTION_PROGRAM_GET_BUILD_INFO:
+        return "urProgramGetBuildInfo";
+    case UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS:
+        return "urProgramSetSpecializationConstants";
+    case UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE:
+        return "urProgramGetNativeHandle";
+    case UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE:
+        return "urProgramCreateWithNativeHandle";
+    case UR_FUNCTION_QUEUE_GET_INFO:
+        return "urQueueGetInfo";
+    case UR_FUNCTION_QUEUE_CREATE:
+        return "urQueueCreate";
+    case UR_FUNCTION_QUEUE_RETAIN:
+        return "urQueueRetain";
+    case UR_FUNCTION_QUEUE_RELEASE:
+        return "urQueueRelease";
+    case UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE:
+        return "urQueueGetNativeHandle";
+    case UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE:
+        return "urQueueCreateWithNativeHandle";
+    case UR_FUNCTION_QUEUE_FINISH:
+        return "urQueueFinish";
+    case UR_FUNCTION_QUEUE_FLUSH:
+        return "urQueueFlush";
+    case UR_FUNCTION_SAMPLER_CREATE:
+        return "urSamplerCreate";
+    case UR_FUNCTION_SAMPLER_RETAIN:
+        return "urSamplerRetain";
+    case UR_FUNCTION_SAMPLER_RELEASE:
+        return "urSamplerRelease";
+    case UR_FUNCTION_SAMPLER_GET_INFO:
+        return "urSamplerGetInfo";
+    case UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE:
+        return "urSamplerGetNativeHandle";
+    case UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE:
+        return "urSamplerCreateWithNativeHandle";
+    case UR_FUNCTION_USM_HOST_ALLOC:
+        return "urUSMHostAlloc";
+    case UR_FUNCTION_USM_DEVICE_ALLOC:
+        return "urUSMDeviceAlloc";
+    case UR_FUNCTION_USM_SHARED_ALLOC:
+        return "urUSMSharedAlloc";
+    case UR_FUNCTION_USM_FREE:
+        return "urUSMFree";
+    case UR_FUNCTION_USM_GET_MEM_ALLOC_INFO:
+        return "urUSMGetMemAllocInfo";
+    case UR_FUNCTION_USM_POOL_CREATE:
+        return "urUSMPoolCreate";
+    case UR_FUNCTION_USM_POOL_DESTROY:
+        return "urUSMPoolDestroy";
+    case UR_FUNCTION_DEVICE_GET:
+        return "urDeviceGet";
+    case UR_FUNCTION_DEVICE_GET_INFO:
+        return "urDeviceGetInfo";
+    case UR_FUNCTION_DEVICE_RETAIN:
+        return "urDeviceRetain";
+    case UR_FUNCTION_DEVICE_RELEASE:
+        return "urDeviceRelease";
+    case UR_FUNCTION_DEVICE_PARTITION:
+        return "urDevicePartition";
+    case UR_FUNCTION_DEVICE_SELECT_BINARY:
+        return "urDeviceSelectBinary";
+    case UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE:
+        return "urDeviceGetNativeHandle";
+    case UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE:
+        return "urDeviceCreateWithNativeHandle";
+    case UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS:
+        return "urDeviceGetGlobalTimestamps";
+    default:
+        return nullptr;
+    }
+}
+
+/// returns the event a call to a function that enqueues a command returned,
+/// nullptr for other functions and for calls that did not ask for an event
+inline ur_event_handle_t getEnqueuedEvent(uint32_t function,
+                                          const void *params) {
+    switch ((enum ur_function_t)function) {
+    case UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH: {
+        auto p = (const struct ur_enqueue_kernel_launch_params_t *)params;
+        return *p->pphEvent ? **p->pphEvent : nullptr;
+    }
+    case UR_FUNCTION_ENQUEUE_EVENTS_WAIT: {
+        auto p = (const struct ur_enqueue_events_wait_params_t *)params;
+        return *p->pphEvent ? **p->pphEvent : nullptr;
+    }
+    case UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER: {
+        auto p =
+            (const struct ur_enqueue_events_wait_with_barrier_params_t *)params;
+        return *p->pphEvent ? **p->pphEvent : nullptr;
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ: {
+        auto p = (const struct ur_enqueue_mem_buffer_read_params_t *)params;
+        return *p->pphEvent ? **p->pphEvent : nullptr;
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE: {
+        auto p = (const struct ur_enqueue_mem_buffer_write_params_t *)params;
+        return *p->pphEvent ? **p->pphEvent : nullptr;
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT: {
+        auto p =
+            (const struct ur_enqueue_mem_buffer_read_rect_params_t *)params;
+        return *p->pphEvent ? **p->pphEvent : nullptr;
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT: {
+        auto p =
+            (const struct ur_enqueue_mem_buffer_write_rect_params_t *)params;
+        return *p->pphEvent ? **p->pphEvent : nullptr;
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY: {
+        auto p = (const struct ur_enqueue_mem_buffer_copy_params_t *)params;
+        return *p->pphEvent ? **p->pphEvent : nullptr;
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT: {
+        auto p =
+            (const struct ur_enqueue_mem_buffer_copy_rect_params_t *)params;
+        return *p->pphEvent ? **p->pphEvent : nullptr;
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL: {
+        auto p = (const struct ur_enqueue_mem_buffer_fill_params_t *)params;
+        return *p->pphEvent ? **p->pphEvent : nullptr;
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ: {
+        auto p = (const struct ur_enqueue_mem_image_read_params_t *)params;
+        return *p->pphEvent ? **p->pphEvent : nullptr;
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE: {
+        auto p = (const struct ur_enqueue_mem_image_write_params_t *)params;
+        return *p->pphEvent ? **p->pphEvent : nullptr;
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY: {
+        auto p = (const struct ur_enqueue_mem_image_copy_params_t *)params;
+        return *p->pphEvent ? **p->pphEvent : nullptr;
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP: {
+        auto p = (const struct ur_enqueue_mem_buffer_map_params_t *)params;
+        return *p->pphEvent ? **p->pphEvent : nullptr;
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_UNMAP: {
+        auto p = (const struct ur_enqueue_mem_unmap_params_t *)params;
+        return *p->pphEvent ? **p->pphEvent : nullptr;
+    }
+    case UR_FUNCTION_ENQUEUE_USM_FILL: {
+        auto p = (const struct ur_enqueue_usm_fill_params_t *)params;
+        return *p->pphEvent ? **p->pphEvent : nullptr;
+    }
+    case UR_FUNCTION_ENQUEUE_USM_MEMCPY: {
+        auto p = (const struct ur_enqueue_usm_memcpy_params_t *)params;
+        return *p->pphEvent ? **p->pphEvent : nullptr;
+    }
+    case UR_FUNCTION_ENQUEUE_USM_PREFETCH: {
+        auto p = (const struct ur_enqueue_usm_prefetch_params_t *)params;
+        return *p->pphEvent ? **p->pphEvent : nullptr;
+    }
+    case UR_FUNCTION_ENQUEUE_USM_ADVISE: {
+        auto p = (const struct ur_enqueue_usm_advise_params_t *)params;
+        return *p->pphEvent ? **p->pphEvent : nullptr;
+    }
+    case UR_FUNCTION_ENQUEUE_USM_FILL2_D: {
+        auto p = (const struct ur_enqueue_usm_fill2_d_params_t *)params;
+        return *p->pphEvent ? **p->pphEvent : nullptr;
+    }
+    case UR_FUNCTION_ENQUEUE_USM_MEMCPY2_D: {
+        auto p = (const struct ur_enqueue_usm_memcpy2_d_params_t *)params;
+        return *p->pphEvent ? **p->pphEvent : nullptr;
+    }
+    case UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE: {
+        auto p =
+            (const struct ur_enqueue_device_global_variable_write_params_t *)
+                params;
+        return *p->pphEvent ? **p->pphEvent : nullptr;
+    }
+    case UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ: {
+        auto p =
+            (const struct ur_enqueue_device_global_variable_read_params_t *)
+                params;
+        return *p->pphEvent ? **p->pphEvent : nullptr;
+    }
+    default:
+        return nullptr;
+    }
+}
+
+/// writes the parameters of a call as typed fields, for the structured trace
+/// formats. The writer gets a call for every parameter of the function:
+/// - `number(name, value)` for the integer parameters
+/// - `boolean(name, value)` for the bool parameters
+/// - `pointer(name, ptr)` for the handles
+/// - `text(name, serialize)` for the others, where `serialize(os)` prints the
+///   value as serializeFunctionParams does
+template <typename Writer>
+inline int serializeFunctionParamFields(Writer &writer, uint32_t function,
+                                        const void *args) {
+    switch ((enum ur_function_t)function) {
+    case UR_FUNCTION_INIT: {
+        auto params = (const struct ur_init_params_t *)args;
+        writer.text("device_flags", [&](std::ostream &os) {
+            ur_params::serializeFlag_ur_device_init_flags_t(
+                os, *(params->pdevice_flags));
+        });
+    } break;
+    case UR_FUNCTION_GET_LAST_RESULT: {
+        auto params = (const struct ur_get_last_result_params_t *)args;
+        writer.pointer("hPlatform", *(params->phPlatform));
+        writer.text("ppMessage", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pppMessage));
+        });
+    } break;
+    case UR_FUNCTION_TEAR_DOWN: {
+        auto params = (const struct ur_tear_down_params_t *)args;
+        writer.text("pParams", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppParams));
+        });
+    } break;
+    case UR_FUNCTION_CONTEXT_CREATE: {
+        auto params = (const struct ur_context_create_params_t *)args;
+        writer.number("DeviceCount", *(params->pDeviceCount));
+        writer.text("phDevices", [&](std::ostream &os) {
+            os << "[";
+            for (size_t i = 0;
+                 *(params->pphDevices) != NULL && i < *params->pDeviceCount;
+                 ++i) {
+                if (i != 0) {
+                    os << ", ";
+                }
+                ur_params::serializePtr(os, (*(params->pphDevices))[i]);
+            }
+            os << "]";
+        });
+        writer.text("pProperties", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppProperties));
+        });
+        writer.text("phContext", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphContext));
+        });
+    } break;
+    case UR_FUNCTION_CONTEXT_RETAIN: {
+        auto params = (const struct ur_context_retain_params_t *)args;
+        writer.pointer("hContext", *(params->phContext));
+    } break;
+    case UR_FUNCTION_CONTEXT_RELEASE: {
+        auto params = (const struct ur_context_release_params_t *)args;
+        writer.pointer("hContext", *(params->phContext));
+    } break;
+    case UR_FUNCTION_CONTEXT_GET_INFO: {
+        auto params = (const struct ur_context_get_info_params_t *)args;
+        writer.pointer("hContext", *(params->phContext));
+        writer.text("propName", [&](std::ostream &os) {
+            os << *(params->ppropName);
+        });
+        writer.number("propSize", *(params->ppropSize));
+        writer.text("pPropValue", [&](std::ostream &os) {
+            ur_params::serializeTaggedTyped_ur_context_info_t(
+                os, *(params->ppPropValue), *(params->ppropName),
+                *(params->ppropSize));
+        });
+        writer.text("pPropSizeRet", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppPropSizeRet));
+        });
+    } break;
+    case UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE: {
+        auto params =
+            (const struct ur_context_get_native_handle_params_t *)args;
+        writer.pointer("hContext", *(params->phContext));
+        writer.text("phNativeContext", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphNativeContext));
+        });
+    } break;
+    case UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE: {
+        auto params =
+            (const struct ur_context_create_with_native_handle_params_t *)args;
+        writer.pointer("hNativeContext", *(params->phNativeContext));
+        writer.number("numDevices", *(params->pnumDevices));
+        writer.text("phDevices", [&](std::ostream &os) {
+            os << "[";
+            for (size_t i = 0;
+                 *(params->pphDevices) != NULL && i < *params->pnumDevices;
+                 ++i) {
+                if (i != 0) {
+                    os << ", ";
+                }
+                ur_params::serializePtr(os, (*(params->pphDevices))[i]);
+            }
+            os << "]";
+        });
+        writer.text("pProperties", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppProperties));
+        });
+        writer.text("phContext", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphContext));
+        });
+    } break;
+    case UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER: {
+        auto params =
+            (const struct ur_context_set_extended_deleter_params_t *)args;
+        writer.pointer("hContext", *(params->phContext));
+        writer.text("pfnDeleter", [&](std::ostream &os) {
+            os << *(params->ppfnDeleter);
+        });
+        writer.text("pUserData", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppUserData));
+        });
+    } break;
+    case UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH: {
+        auto params = (const struct ur_enqueue_kernel_launch_params_t *)args;
+        writer.pointer("hQueue", *(params->phQueue));
+        writer.pointer("hKernel", *(params->phKernel));
+        writer.number("workDim", *(params->pworkDim));
+        writer.text("pGlobalWorkOffset", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppGlobalWorkOffset));
+        });
+        writer.text("pGlobalWorkSize", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppGlobalWorkSize));
+        });
+        writer.text("pLocalWorkSize", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppLocalWorkSize));
+        });
+        writer.number("numEventsInWaitList", *(params->pnumEventsInWaitList));
+        writer.text("phEventWaitList", [&](std::ostream &os) {
+            os << "[";
+            for (size_t i = 0;
+                 *(params->pphEventWaitList) != NULL &&
+                 i < *params->pnumEventsInWaitList; ++i) {
+                if (i != 0) {
+                    os << ", ";
+                }
+                ur_params::serializePtr(os, (*(params->pphEventWaitList))[i]);
+            }
+            os << "]";
+        });
+        writer.text("phEvent", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphEvent));
+        });
+    } break;
+    case UR_FUNCTION_ENQUEUE_EVENTS_WAIT: {
+        auto params = (const struct ur_enqueue_events_wait_params_t *)args;
+        writer.pointer("hQueue", *(params->phQueue));
+        writer.number("numEventsInWaitList", *(params->pnumEventsInWaitList));
+        writer.text("phEventWaitList", [&](std::ostream &os) {
+            os << "[";
+            for (size_t i = 0;
+                 *(params->pphEventWaitList) != NULL &&
+                 i < *params->pnumEventsInWaitList; ++i) {
+                if (i != 0) {
+                    os << ", ";
+                }
+                ur_params::serializePtr(os, (*(params->pphEventWaitList))[i]);
+            }
+            os << "]";
+        });
+        writer.text("phEvent", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphEvent));
+        });
+    } break;
+    case UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER: {
+        auto params =
+            (const struct ur_enqueue_events_wait_with_barrier_params_t *)args;
+        writer.pointer("hQueue", *(params->phQueue));
+        writer.number("numEventsInWaitList", *(params->pnumEventsInWaitList));
+        writer.text("phEventWaitList", [&](std::ostream &os) {
+            os << "[";
+            for (size_t i = 0;
+                 *(params->pphEventWaitList) != NULL &&
+                 i < *params->pnumEventsInWaitList; ++i) {
+                if (i != 0) {
+                    os << ", ";
+                }
+                ur_params::serializePtr(os, (*(params->pphEventWaitList))[i]);
+            }
+            os << "]";
+        });
+        writer.text("phEvent", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphEvent));
+        });
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ: {
+        auto params = (const struct ur_enqueue_mem_buffer_read_params_t *)args;
+        writer.pointer("hQueue", *(params->phQueue));
+        writer.pointer("hBuffer", *(params->phBuffer));
+        writer.boolean("blockingRead", *(params->pblockingRead));
+        writer.number("offset", *(params->poffset));
+        writer.number("size", *(params->psize));
+        writer.text("pDst", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppDst));
+        });
+        writer.number("numEventsInWaitList", *(params->pnumEventsInWaitList));
+        writer.text("phEventWaitList", [&](std::ostream &os) {
+            os << "[";
+            for (size_t i = 0;
+                 *(params->pphEventWaitList) != NULL &&
+                 i < *params->pnumEventsInWaitList; ++i) {
+                if (i != 0) {
+                    os << ", ";
+                }
+                ur_params::serializePtr(os, (*(params->pphEventWaitList))[i]);
+            }
+            os << "]";
+        });
+        writer.text("phEvent", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphEvent));
+        });
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE: {
+        auto params = (const struct ur_enqueue_mem_buffer_write_params_t *)args;
+        writer.pointer("hQueue", *(params->phQueue));
+        writer.pointer("hBuffer", *(params->phBuffer));
+        writer.boolean("blockingWrite", *(params->pblockingWrite));
+        writer.number("offset", *(params->poffset));
+        writer.number("size", *(params->psize));
+        writer.text("pSrc", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppSrc));
+        });
+        writer.number("numEventsInWaitList", *(params->pnumEventsInWaitList));
+        writer.text("phEventWaitList", [&](std::ostream &os) {
+            os << "[";
+            for (size_t i = 0;
+                 *(params->pphEventWaitList) != NULL &&
+                 i < *params->pnumEventsInWaitList; ++i) {
+                if (i != 0) {
+                    os << ", ";
+                }
+                ur_params::serializePtr(os, (*(params->pphEventWaitList))[i]);
+            }
+            os << "]";
+        });
+        writer.text("phEvent", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphEvent));
+        });
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT: {
+        auto params =
+            (const struct ur_enqueue_mem_buffer_read_rect_params_t *)args;
+        writer.pointer("hQueue", *(params->phQueue));
+        writer.pointer("hBuffer", *(params->phBuffer));
+        writer.boolean("blockingRead", *(params->pblockingRead));
+        writer.text("bufferOrigin", [&](std::ostream &os) {
+            os << *(params->pbufferOrigin);
+        });
+        writer.text("hostOrigin", [&](std::ostream &os) {
+            os << *(params->phostOrigin);
+        });
+        writer.text("region", [&](std::ostream &os) {
+            os << *(params->pregion);
+        });
+        writer.number("bufferRowPitch", *(params->pbufferRowPitch));
+        writer.number("bufferSlicePitch", *(params->pbufferSlicePitch));
+        writer.number("hostRowPitch", *(params->phostRowPitch));
+        writer.number("hostSlicePitch", *(params->phostSlicePitch));
+        writer.text("pDst", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppDst));
+        });
+        writer.number("numEventsInWaitList", *(params->pnumEventsInWaitList));
+        writer.text("phEventWaitList", [&](std::ostream &os) {
+            os << "[";
+            for (size_t i = 0;
+                 *(params->pphEventWaitList) != NULL &&
+                 i < *params->pnumEventsInWaitList; ++i) {
+                if (i != 0) {
+                    os << ", ";
+                }
+                ur_params::serializePtr(os, (*(params->pphEventWaitList))[i]);
+            }
+            os << "]";
+        });
+        writer.text("phEvent", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphEvent));
+        });
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT: {
+        auto params =
+            (const struct ur_enqueue_mem_buffer_write_rect_params_t *)args;
+        writer.pointer("hQueue", *(params->phQueue));
+        writer.pointer("hBuffer", *(params->phBuffer));
+        writer.boolean("blockingWrite", *(params->pblockingWrite));
+        writer.text("bufferOrigin", [&](std::ostream &os) {
+            os << *(params->pbufferOrigin);
+        });
+        writer.text("hostOrigin", [&](std::ostream &os) {
+            os << *(params->phostOrigin);
+        });
+        writer.text("region", [&](std::ostream &os) {
+            os << *(params->pregion);
+        });
+        writer.number("bufferRowPitch", *(params->pbufferRowPitch));
+        writer.number("bufferSlicePitch", *(params->pbufferSlicePitch));
+        writer.number("hostRowPitch", *(params->phostRowPitch));
+        writer.number("hostSlicePitch", *(params->phostSlicePitch));
+        writer.text("pSrc", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppSrc));
+        });
+        writer.number("numEventsInWaitList", *(params->pnumEventsInWaitList));
+        writer.text("phEventWaitList", [&](std::ostream &os) {
+            os << "[";
+            for (size_t i = 0;
+                 *(params->pphEventWaitList) != NULL &&
+                 i < *params->pnumEventsInWaitList; ++i) {
+                if (i != 0) {
+                    os << ", ";
+                }
+                ur_params::serializePtr(os, (*(params->pphEventWaitList))[i]);
+            }
+            os << "]";
+        });
+        writer.text("phEvent", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphEvent));
+        });
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY: {
+        auto params = (const struct ur_enqueue_mem_buffer_copy_params_t *)args;
+        writer.pointer("hQueue", *(params->phQueue));
+        writer.pointer("hBufferSrc", *(params->phBufferSrc));
+        writer.pointer("hBufferDst", *(params->phBufferDst));
+        writer.number("srcOffset", *(params->psrcOffset));
+        writer.number("dstOffset", *(params->pdstOffset));
+        writer.number("size", *(params->psize));
+        writer.number("numEventsInWaitList", *(params->pnumEventsInWaitList));
+        writer.text("phEventWaitList", [&](std::ostream &os) {
+            os << "[";
+            for (size_t i = 0;
+                 *(params->pphEventWaitList) != NULL &&
+                 i < *params->pnumEventsInWaitList; ++i) {
+                if (i != 0) {
+                    os << ", ";
+                }
+                ur_params::serializePtr(os, (*(params->pphEventWaitList))[i]);
+            }
+            os << "]";
+        });
+        writer.text("phEvent", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphEvent));
+        });
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT: {
+        auto params =
+            (const struct ur_enqueue_mem_buffer_copy_rect_params_t *)args;
+        writer.pointer("hQueue", *(params->phQueue));
+        writer.pointer("hBufferSrc", *(params->phBufferSrc));
+        writer.pointer("hBufferDst", *(params->phBufferDst));
+        writer.text("srcOrigin", [&](std::ostream &os) {
+            os << *(params->psrcOrigin);
+        });
+        writer.text("dstOrigin", [&](std::ostream &os) {
+            os << *(params->pdstOrigin);
+        });
+        writer.text("region", [&](std::ostream &os) {
+            os << *(params->pregion);
+        });
+        writer.number("srcRowPitch", *(params->psrcRowPitch));
+        writer.number("srcSlicePitch", *(params->psrcSlicePitch));
+        writer.number("dstRowPitch", *(params->pdstRowPitch));
+        writer.number("dstSlicePitch", *(params->pdstSlicePitch));
+        writer.number("numEventsInWaitList", *(params->pnumEventsInWaitList));
+        writer.text("phEventWaitList", [&](std::ostream &os) {
+            os << "[";
+            for (size_t i = 0;
+                 *(params->pphEventWaitList) != NULL &&
+                 i < *params->pnumEventsInWaitList; ++i) {
+                if (i != 0) {
+                    os << ", ";
+                }
+                ur_params::serializePtr(os, (*(params->pphEventWaitList))[i]);
+            }
+            os << "]";
+        });
+        writer.text("phEvent", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphEvent));
+        });
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL: {
+        auto params = (const struct ur_enqueue_mem_buffer_fill_params_t *)args;
+        writer.pointer("hQueue", *(params->phQueue));
+        writer.pointer("hBuffer", *(params->phBuffer));
+        writer.text("pPattern", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppPattern));
+        });
+        writer.number("patternSize", *(params->ppatternSize));
+        writer.number("offset", *(params->poffset));
+        writer.number("size", *(params->psize));
+        writer.number("numEventsInWaitList", *(params->pnumEventsInWaitList));
+        writer.text("phEventWaitList", [&](std::ostream &os) {
+            os << "[";
+            for (size_t i = 0;
+                 *(params->pphEventWaitList) != NULL &&
+                 i < *params->pnumEventsInWaitList; ++i) {
+                if (i != 0) {
+                    os << ", ";
+                }
+                ur_params::serializePtr(os, (*(params->pphEventWaitList))[i]);
+            }
+            os << "]";
+        });
+        writer.text("phEvent", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphEvent));
+        });
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ: {
+        auto params = (const struct ur_enqueue_mem_image_read_params_t *)args;
+        writer.pointer("hQueue", *(params->phQueue));
+        writer.pointer("hImage", *(params->phImage));
+        writer.boolean("blockingRead", *(params->pblockingRead));
+        writer.text("origin", [&](std::ostream &os) {
+            os << *(params->porigin);
+        });
+        writer.text("region", [&](std::ostream &os) {
+            os << *(params->pregion);
+        });
+        writer.number("rowPitch", *(params->prowPitch));
+        writer.number("slicePitch", *(params->pslicePitch));
+        writer.text("pDst", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppDst));
+        });
+        writer.number("numEventsInWaitList", *(params->pnumEventsInWaitList));
+        writer.text("phEventWaitList", [&](std::ostream &os) {
+            os << "[";
+            for (size_t i = 0;
+                 *(params->pphEventWaitList) != NULL &&
+                 i < *params->pnumEventsInWaitList; ++i) {
+                if (i != 0) {
+                    os << ", ";
+                }
+                ur_params::serializePtr(os, (*(params->pphEventWaitList))[i]);
+            }
+            os << "]";
+        });
+        writer.text("phEvent", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphEvent));
+        });
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE: {
+        auto params = (const struct ur_enqueue_mem_image_write_params_t *)args;
+        writer.pointer("hQueue", *(params->phQueue));
+        writer.pointer("hImage", *(params->phImage));
+        writer.boolean("blockingWrite", *(params->pblockingWrite));
+        writer.text("origin", [&](std::ostream &os) {
+            os << *(params->porigin);
+        });
+        writer.text("region", [&](std::ostream &os) {
+            os << *(params->pregion);
+        });
+        writer.number("rowPitch", *(params->prowPitch));
+        writer.number("slicePitch", *(params->pslicePitch));
+        writer.text("pSrc", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppSrc));
+        });
+        writer.number("numEventsInWaitList", *(params->pnumEventsInWaitList));
+        writer.text("phEventWaitList", [&](std::ostream &os) {
+            os << "[";
+            for (size_t i = 0;
+                 *(params->pphEventWaitList) != NULL &&
+                 i < *params->pnumEventsInWaitList; ++i) {
+                if (i != 0) {
+                    os << ", ";
+                }
+                ur_params::serializePtr(os, (*(params->pphEventWaitList))[i]);
+            }
+            os << "]";
+        });
+        writer.text("phEvent", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphEvent));
+        });
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY: {
+        auto params = (const struct ur_enqueue_mem_image_copy_params_t *)args;
+        writer.pointer("hQueue", *(params->phQueue));
+        writer.pointer("hImageSrc", *(params->phImageSrc));
+        writer.pointer("hImageDst", *(params->phImageDst));
+        writer.text("srcOrigin", [&](std::ostream &os) {
+            os << *(params->psrcOrigin);
+        });
+        writer.text("dstOrigin", [&](std::ostream &os) {
+            os << *(params->pdstOrigin);
+        });
+        writer.text("region", [&](std::ostream &os) {
+            os << *(params->pregion);
+        });
+        writer.number("numEventsInWaitList", *(params->pnumEventsInWaitList));
+        writer.text("phEventWaitList", [&](std::ostream &os) {
+            os << "[";
+            for (size_t i = 0;
+                 *(params->pphEventWaitList) != NULL &&
+                 i < *params->pnumEventsInWaitList; ++i) {
+                if (i != 0) {
+                    os << ", ";
+                }
+                ur_params::serializePtr(os, (*(params->pphEventWaitList))[i]);
+            }
+            os << "]";
+        });
+        writer.text("phEvent", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphEvent));
+        });
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP: {
+        auto params = (const struct ur_enqueue_mem_buffer_map_params_t *)args;
+        writer.pointer("hQueue", *(params->phQueue));
+        writer.pointer("hBuffer", *(params->phBuffer));
+        writer.boolean("blockingMap", *(params->pblockingMap));
+        writer.text("mapFlags", [&](std::ostream &os) {
+            ur_params::serializeFlag_ur_map_flags_t(os, *(params->pmapFlags));
+        });
+        writer.number("offset", *(params->poffset));
+        writer.number("size", *(params->psize));
+        writer.number("numEventsInWaitList", *(params->pnumEventsInWaitList));
+        writer.text("phEventWaitList", [&](std::ostream &os) {
+            os << "[";
+            for (size_t i = 0;
+                 *(params->pphEventWaitList) != NULL &&
+                 i < *params->pnumEventsInWaitList; ++i) {
+                if (i != 0) {
+                    os << ", ";
+                }
+                ur_params::serializePtr(os, (*(params->pphEventWaitList))[i]);
+            }
+            os << "]";
+        });
+        writer.text("phEvent", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphEvent));
+        });
+        writer.text("ppRetMap", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pppRetMap));
+        });
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_UNMAP: {
+        auto params = (const struct ur_enqueue_mem_unmap_params_t *)args;
+        writer.pointer("hQueue", *(params->phQueue));
+        writer.pointer("hMem", *(params->phMem));
+        writer.text("pMappedPtr", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppMappedPtr));
+        });
+        writer.number("numEventsInWaitList", *(params->pnumEventsInWaitList));
+        writer.text("phEventWaitList", [&](std::ostream &os) {
+            os << "[";
+            for (size_t i = 0;
+                 *(params->pphEventWaitList) != NULL &&
+                 i < *params->pnumEventsInWaitList; ++i) {
+                if (i != 0) {
+                    os << ", ";
+                }
+                ur_params::serializePtr(os, (*(params->pphEventWaitList))[i]);
+            }
+            os << "]";
+        });
+        writer.text("phEvent", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphEvent));
+        });
+    } break;
+    case UR_FUNCTION_ENQUEUE_USM_FILL: {
+        auto params = (const struct ur_enqueue_usm_fill_params_t *)args;
+        writer.pointer("hQueue", *(params->phQueue));
+        writer.text("ptr", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pptr));
+        });
+        writer.number("patternSize", *(params->ppatternSize));
+        writer.text("pPattern", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppPattern));
+        });
+        writer.number("size", *(params->psize));
+        writer.number("numEventsInWaitList", *(params->pnumEventsInWaitList));
+        writer.text("phEventWaitList", [&](std::ostream &os) {
+            os << "[";
+            for (size_t i = 0;
+                 *(params->pphEventWaitList) != NULL &&
+                 i < *params->pnumEventsInWaitList; ++i) {
+                if (i != 0) {
+                    os << ", ";
+                }
+                ur_params::serializePtr(os, (*(params->pphEventWaitList))[i]);
+            }
+            os << "]";
+        });
+        writer.text("phEvent", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphEvent));
+        });
+    } break;
+    case UR_FUNCTION_ENQUEUE_USM_MEMCPY: {
+        auto params = (const struct ur_enqueue_usm_memcpy_params_t *)args;
+        writer.pointer("hQueue", *(params->phQueue));
+        writer.boolean("blocking", *(params->pblocking));
+        writer.text("pDst", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppDst));
+        });
+        writer.text("pSrc", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppSrc));
+        });
+        writer.number("size", *(params->psize));
+        writer.number("numEventsInWaitList", *(params->pnumEventsInWaitList));
+        writer.text("phEventWaitList", [&](std::ostream &os) {
+            os << "[";
+            for (size_t i = 0;
+                 *(params->pphEventWaitList) != NULL &&
+                 i < *params->pnumEventsInWaitList; ++i) {
+                if (i != 0) {
+                    os << ", ";
+                }
+                ur_params::serializePtr(os, (*(params->pphEventWaitList))[i]);
+            }
+            os << "]";
+        });
+        writer.text("phEvent", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphEvent));
+        });
+    } break;
+    case UR_FUNCTION_ENQUEUE_USM_PREFETCH: {
+        auto params = (const struct ur_enqueue_usm_prefetch_params_t *)args;
+        writer.pointer("hQueue", *(params->phQueue));
+        writer.text("pMem", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppMem));
+        });
+        writer.number("size", *(params->psize));
+        writer.text("flags", [&](std::ostream &os) {
+            ur_params::serializeFlag_ur_usm_migration_flags_t(
+                os, *(params->pflags));
+        });
+        writer.number("numEventsInWaitList", *(params->pnumEventsInWaitList));
+        writer.text("phEventWaitList", [&](std::ostream &os) {
+            os << "[";
+            for (size_t i = 0;
+                 *(params->pphEventWaitList) != NULL &&
+                 i < *params->pnumEventsInWaitList; ++i) {
+                if (i != 0) {
+                    os << ", ";
+                }
+                ur_params::serializePtr(os, (*(params->pphEventWaitList))[i]);
+            }
+            os << "]";
+        });
+        writer.text("phEvent", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphEvent));
+        });
+    } break;
+    case UR_FUNCTION_ENQUEUE_USM_ADVISE: {
+        auto params = (const struct ur_enqueue_usm_advise_params_t *)args;
+        writer.pointer("hQueue", *(params->phQueue));
+        writer.text("pMem", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppMem));
+        });
+        writer.number("size", *(params->psize));
+        writer.text("advice", [&](std::ostream &os) {
+            ur_params::serializeFlag_ur_usm_advice_flags_t(os,
+                                                           *(params->padvice));
+        });
+        writer.text("phEvent", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphEvent));
+        });
+    } break;
+    case UR_FUNCTION_ENQUEUE_USM_FILL2_D: {
+        auto params = (const struct ur_enqueue_usm_fill2_d_params_t *)args;
+        writer.pointer("hQueue", *(params->phQueue));
+        writer.text("pMem", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppMem));
+        });
+        writer.number("pitch", *(params->ppitch));
+        writer.number("patternSize", *(params->ppatternSize));
+        writer.text("pPattern", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppPattern));
+        });
+        writer.number("width", *(params->pwidth));
+        writer.number("height", *(params->pheight));
+        writer.number("numEventsInWaitList", *(params->pnumEventsInWaitList));
+        writer.text("phEventWaitList", [&](std::ostream &os) {
+            os << "[";
+            for (size_t i = 0;
+                 *(params->pphEventWaitList) != NULL &&
+                 i < *params->pnumEventsInWaitList; ++i) {
+                if (i != 0) {
+                    os << ", ";
+                }
+                ur_params::serializePtr(os, (*(params->pphEventWaitList))[i]);
+            }
+            os << "]";
+        });
+        writer.text("phEvent", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphEvent));
+        });
+    } break;
+    case UR_FUNCTION_ENQUEUE_USM_MEMCPY2_D: {
+        auto params = (const struct ur_enqueue_usm_memcpy2_d_params_t *)args;
+        writer.pointer("hQueue", *(params->phQueue));
+        writer.boolean("blocking", *(params->pblocking));
+        writer.text("pDst", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppDst));
+        });
+        writer.number("dstPitch", *(params->pdstPitch));
+        writer.text("pSrc", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppSrc));
+        });
+        writer.number("srcPitch", *(params->psrcPitch));
+        writer.number("width", *(params->pwidth));
+        writer.number("height", *(params->pheight));
+        writer.number("numEventsInWaitList", *(params->pnumEventsInWaitList));
+        writer.text("phEventWaitList", [&](std::ostream &os) {
+            os << "[";
+            for (size_t i = 0;
+                 *(params->pphEventWaitList) != NULL &&
+                 i < *params->pnumEventsInWaitList; ++i) {
+                if (i != 0) {
+                    os << ", ";
+                }
+                ur_params::serializePtr(os, (*(params->pphEventWaitList))[i]);
+            }
+            os << "]";
+        });
+        writer.text("phEvent", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphEvent));
+        });
+    } break;
+    case UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE: {
+        auto params =
+            (const struct ur_enqueue_device_global_variable_write_params_t *)
+                args;
+        writer.pointer("hQueue", *(params->phQueue));
+        writer.pointer("hProgram", *(params->phProgram));
+        writer.text("name", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pname));
+        });
+        writer.boolean("blockingWrite", *(params->pblockingWrite));
+        writer.number("count", *(params->pcount));
+        writer.number("offset", *(params->poffset));
+        writer.text("pSrc", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppSrc));
+        });
+        writer.number("numEventsInWaitList", *(params->pnumEventsInWaitList));
+        writer.text("phEventWaitList", [&](std::ostream &os) {
+            os << "[";
+            for (size_t i = 0;
+                 *(params->pphEventWaitList) != NULL &&
+                 i < *params->pnumEventsInWaitList; ++i) {
+                if (i != 0) {
+                    os << ", ";
+                }
+                ur_params::serializePtr(os, (*(params->pphEventWaitList))[i]);
+            }
+            os << "]";
+        });
+        writer.text("phEvent", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphEvent));
+        });
+    } break;
+    case UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ: {
+        auto params =
+            (const struct ur_enqueue_device_global_variable_read_params_t *)
+                args;
+        writer.pointer("hQueue", *(params->phQueue));
+        writer.pointer("hProgram", *(params->phProgram));
+        writer.text("name", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pname));
+        });
+        writer.boolean("blockingRead", *(params->pblockingRead));
+        writer.number("count", *(params->pcount));
+        writer.number("offset", *(params->poffset));
+        writer.text("pDst", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppDst));
+        });
+        writer.number("numEventsInWaitList", *(params->pnumEventsInWaitList));
+        writer.text("phEventWaitList", [&](std::ostream &os) {
+            os << "[";
+            for (size_t i = 0;
+                 *(params->pphEventWaitList) != NULL &&
+                 i < *params->pnumEventsInWaitList; ++i) {
+                if (i != 0) {
+                    os << ", ";
+                }
+                ur_params::serializePtr(os, (*(params->pphEventWaitList))[i]);
+            }
+            os << "]";
+        });
+        writer.text("phEvent", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphEvent));
+        });
+    } break;
+    case UR_FUNCTION_EVENT_GET_INFO: {
+        auto params = (const struct ur_event_get_info_params_t *)args;
+        writer.pointer("hEvent", *(params->phEvent));
+        writer.text("propName", [&](std::ostream &os) {
+            os << *(params->ppropName);
+        });
+        writer.number("propSize", *(params->ppropSize));
+        writer.text("pPropValue", [&](std::ostream &os) {
+            ur_params::serializeTaggedTyped_ur_event_info_t(
+                os, *(params->ppPropValue), *(params->ppropName),
+                *(params->ppropSize));
+        });
+        writer.text("pPropSizeRet", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppPropSizeRet));
+        });
+    } break;
+    case UR_FUNCTION_EVENT_GET_PROFILING_INFO: {
+        auto params = (const struct ur_event_get_profiling_info_params_t *)args;
+        writer.pointer("hEvent", *(params->phEvent));
+        writer.text("propName", [&](std::ostream &os) {
+            os << *(params->ppropName);
+        });
+        writer.number("propSize", *(params->ppropSize));
+        writer.text("pPropValue", [&](std::ostream &os) {
+            ur_params::serializeTaggedTyped_ur_profiling_info_t(
+                os, *(params->ppPropValue), *(params->ppropName),
+                *(params->ppropSize));
+        });
+        writer.text("pPropSizeRet", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppPropSizeRet));
+        });
+    } break;
+    case UR_FUNCTION_EVENT_WAIT: {
+        auto params = (const struct ur_event_wait_params_t *)args;
+        writer.number("numEvents", *(params->pnumEvents));
+        writer.text("phEventWaitList", [&](std::ostream &os) {
+            os << "[";
+            for (size_t i = 0;
+                 *(params->pphEventWaitList) != NULL && i < *params->pnumEvents;
+                 ++i) {
+                if (i != 0) {
+                    os << ", ";
+                }
+                ur_params::serializePtr(os, (*(params->pphEventWaitList))[i]);
+            }
+            os << "]";
+        });
+    } break;
+    case UR_FUNCTION_EVENT_RETAIN: {
+        auto params = (const struct ur_event_retain_params_t *)args;
+        writer.pointer("hEvent", *(params->phEvent));
+    } break;
+    case UR_FUNCTION_EVENT_RELEASE: {
+        auto params = (const struct ur_event_release_params_t *)args;
+        writer.pointer("hEvent", *(params->phEvent));
+    } break;
+    case UR_FUNCTION_EVENT_GET_NATIVE_HANDLE: {
+        auto params = (const struct ur_event_get_native_handle_params_t *)args;
+        writer.pointer("hEvent", *(params->phEvent));
+        writer.text("phNativeEvent", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphNativeEvent));
+        });
+    } break;
+    case UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE: {
+        auto params =
+            (const struct ur_event_create_with_native_handle_params_t *)args;
+        writer.pointer("hNativeEvent", *(params->phNativeEvent));
+        writer.pointer("hContext", *(params->phContext));
+        writer.text("phEvent", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphEvent));
+        });
+    } break;
+    case UR_FUNCTION_EVENT_SET_CALLBACK: {
+        auto params = (const struct ur_event_set_callback_params_t *)args;
+        writer.pointer("hEvent", *(params->phEvent));
+        writer.text("execStatus", [&](std::ostream &os) {
+            os << *(params->pexecStatus);
+        });
+        writer.text("pfnNotify", [&](std::ostream &os) {
+            os << *(params->ppfnNotify);
+        });
+        writer.text("pUserData", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppUserData));
+        });
+    } break;
+    case UR_FUNCTION_KERNEL_CREATE: {
+        auto params = (const struct ur_kernel_create_params_t *)args;
+        writer.pointer("hProgram", *(params->phProgram));
+        writer.text("pKernelName", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppKernelName));
+        });
+        writer.text("phKernel", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphKernel));
+        });
+    } break;
+    case UR_FUNCTION_KERNEL_GET_INFO: {
+        auto params = (const struct ur_kernel_get_info_params_t *)args;
+        writer.pointer("hKernel", *(params->phKernel));
+        writer.text("propName", [&](std::ostream &os) {
+            os << *(params->ppropName);
+        });
+        writer.number("propSize", *(params->ppropSize));
+        writer.text("pPropValue", [&](std::ostream &os) {
+            ur_params::serializeTaggedTyped_ur_kernel_info_t(
+                os, *(params->ppPropValue), *(params->ppropName),
+                *(params->ppropSize));
+        });
+        writer.text("pPropSizeRet", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppPropSizeRet));
+        });
+    } break;
+    case UR_FUNCTION_KERNEL_GET_GROUP_INFO: {
+        auto params = (const struct ur_kernel_get_group_info_params_t *)args;
+        writer.pointer("hKernel", *(params->phKernel));
+        writer.pointer("hDevice", *(params->phDevice));
+        writer.text("propName", [&](std::ostream &os) {
+            os << *(params->ppropName);
+        });
+        writer.number("propSize", *(params->ppropSize));
+        writer.text("pPropValue", [&](std::ostream &os) {
+            ur_params::serializeTaggedTyped_ur_kernel_group_info_t(
+                os, *(params->ppPropValue), *(params->ppropName),
+                *(params->ppropSize));
+        });
+        writer.text("pPropSizeRet", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppPropSizeRet));
+        });
+    } break;
+    case UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO: {
+        auto params =
+            (const struct ur_kernel_get_sub_group_info_params_t *)args;
+        writer.pointer("hKernel", *(params->phKernel));
+        writer.pointer("hDevice", *(params->phDevice));
+        writer.text("propName", [&](std::ostream &os) {
+            os << *(params->ppropName);
+        });
+        writer.number("propSize", *(params->ppropSize));
+        writer.text("pPropValue", [&](std::ostream &os) {
+            ur_params::serializeTaggedTyped_ur_kernel_sub_group_info_t(
+                os, *(params->ppPropValue), *(params->ppropName),
+                *(params->ppropSize));
+        });
+        writer.text("pPropSizeRet", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppPropSizeRet));
+        });
+    } break;
+    case UR_FUNCTION_KERNEL_RETAIN: {
+        auto params = (const struct ur_kernel_retain_params_t *)args;
+        writer.pointer("hKernel", *(params->phKernel));
+    } break;
+    case UR_FUNCTION_KERNEL_RELEASE: {
+        auto params = (const struct ur_kernel_release_params_t *)args;
+        writer.pointer("hKernel", *(params->phKernel));
+    } break;
+    case UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE: {
+        auto params = (const struct ur_kernel_get_native_handle_params_t *)args;
+        writer.pointer("hKernel", *(params->phKernel));
+        writer.text("phNativeKernel", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphNativeKernel));
+        });
+    } break;
+    case UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE: {
+        auto params =
+            (const struct ur_kernel_create_with_native_handle_params_t *)args;
+        writer.pointer("hNativeKernel", *(params->phNativeKernel));
+        writer.pointer("hContext", *(params->phContext));
+        writer.pointer("hProgram", *(params->phProgram));
+        writer.text("pProperties", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppProperties));
+        });
+        writer.text("phKernel", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphKernel));
+        });
+    } break;
+    case UR_FUNCTION_KERNEL_SET_ARG_VALUE: {
+        auto params = (const struct ur_kernel_set_arg_value_params_t *)args;
+        writer.pointer("hKernel", *(params->phKernel));
+        writer.number("argIndex", *(params->pargIndex));
+        writer.number("argSize", *(params->pargSize));
+        writer.text("pArgValue", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppArgValue));
+        });
+    } break;
+    case UR_FUNCTION_KERNEL_SET_ARG_LOCAL: {
+        auto params = (const struct ur_kernel_set_arg_local_params_t *)args;
+        writer.pointer("hKernel", *(params->phKernel));
+        writer.number("argIndex", *(params->pargIndex));
+        writer.number("argSize", *(params->pargSize));
+    } break;
+    case UR_FUNCTION_KERNEL_SET_ARG_POINTER: {
+        auto params = (const struct ur_kernel_set_arg_pointer_params_t *)args;
+        writer.pointer("hKernel", *(params->phKernel));
+        writer.number("argIndex", *(params->pargIndex));
+        writer.text("pArgValue", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppArgValue));
+        });
+    } break;
+    case UR_FUNCTION_KERNEL_SET_EXEC_INFO: {
+        auto params = (const struct ur_kernel_set_exec_info_params_t *)args;
+        writer.pointer("hKernel", *(params->phKernel));
+        writer.text("propName", [&](std::ostream &os) {
+            os << *(params->ppropName);
+        });
+        writer.number("propSize", *(params->ppropSize));
+        writer.text("pPropValue", [&](std::ostream &os) {
+            ur_params::serializeTaggedTyped_ur_kernel_exec_info_t(
+                os, *(params->ppPropValue), *(params->ppropName),
+                *(params->ppropSize));
+        });
+    } break;
+    case UR_FUNCTION_KERNEL_SET_ARG_SAMPLER: {
+        auto params = (const struct ur_kernel_set_arg_sampler_params_t *)args;
+        writer.pointer("hKernel", *(params->phKernel));
+        writer.number("argIndex", *(params->pargIndex));
+        writer.pointer("hArgValue", *(params->phArgValue));
+    } break;
+    case UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ: {
+        auto params = (const struct ur_kernel_set_arg_mem_obj_params_t *)args;
+        writer.pointer("hKernel", *(params->phKernel));
+        writer.number("argIndex", *(params->pargIndex));
+        writer.pointer("hArgValue", *(params->phArgValue));
+    } break;
+    case UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS: {
+        auto params =
+            (const struct ur_kernel_set_specialization_constants_params_t *)
+                args;
+        writer.pointer("hKernel", *(params->phKernel));
+        writer.number("count", *(params->pcount));
+        writer.text("pSpecConstants", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppSpecConstants));
+        });
+    } break;
+    case UR_FUNCTION_MEM_IMAGE_CREATE: {
+        auto params = (const struct ur_mem_image_create_params_t *)args;
+        writer.pointer("hContext", *(params->phContext));
+        writer.text("flags", [&](std::ostream &os) {
+            ur_params::serializeFlag_ur_mem_flags_t(os, *(params->pflags));
+        });
+        writer.text("pImageFormat", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppImageFormat));
+        });
+        writer.text("pImageDesc", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppImageDesc));
+        });
+        writer.text("pHost", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppHost));
+        });
+        writer.text("phMem", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphMem));
+        });
+    } break;
+    case UR_FUNCTION_MEM_BUFFER_CREATE: {
+        auto params = (const struct ur_mem_buffer_create_params_t *)args;
+        writer.pointer("hContext", *(params->phContext));
+        writer.text("flags", [&](std::ostream &os) {
+            ur_params::serializeFlag_ur_mem_flags_t(os, *(params->pflags));
+        });
+        writer.number("size", *(params->psize));
+        writer.text("pProperties", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppProperties));
+        });
+        writer.text("phBuffer", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphBuffer));
+        });
+    } break;
+    case UR_FUNCTION_MEM_RETAIN: {
+        auto params = (const struct ur_mem_retain_params_t *)args;
+        writer.pointer("hMem", *(params->phMem));
+    } break;
+    case UR_FUNCTION_MEM_RELEASE: {
+        auto params = (const struct ur_mem_release_params_t *)args;
+        writer.pointer("hMem", *(params->phMem));
+    } break;
+    case UR_FUNCTION_MEM_BUFFER_PARTITION: {
+        auto params = (const struct ur_mem_buffer_partition_params_t *)args;
+        writer.pointer("hBuffer", *(params->phBuffer));
+        writer.text("flags", [&](std::ostream &os) {
+            ur_params::serializeFlag_ur_mem_flags_t(os, *(params->pflags));
+        });
+        writer.text("bufferCreateType", [&](std::ostream &os) {
+            os << *(params->pbufferCreateType);
+        });
+        writer.text("pRegion", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppRegion));
+        });
+        writer.text("phMem", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphMem));
+        });
+    } break;
+    case UR_FUNCTION_MEM_GET_NATIVE_HANDLE: {
+        auto params = (const struct ur_mem_get_native_handle_params_t *)args;
+        writer.pointer("hMem", *(params->phMem));
+        writer.text("phNativeMem", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphNativeMem));
+        });
+    } break;
+    case UR_FUNCTION_MEM_CREATE_WITH_NATIVE_HANDLE: {
+        auto params =
+            (const struct ur_mem_create_with_native_handle_params_t *)args;
+        writer.pointer("hNativeMem", *(params->phNativeMem));
+        writer.pointer("hContext", *(params->phContext));
+        writer.text("phMem", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphMem));
+        });
+    } break;
+    case UR_FUNCTION_MEM_GET_INFO: {
+        auto params = (const struct ur_mem_get_info_params_t *)args;
+        writer.pointer("hMemory", *(params->phMemory));
+        writer.text("propName", [&](std::ostream &os) {
+            os << *(params->ppropName);
+        });
+        writer.number("propSize", *(params->ppropSize));
+        writer.text("pPropValue", [&](std::ostream &os) {
+            ur_params::serializeTaggedTyped_ur_mem_info_t(
+                os, *(params->ppPropValue), *(params->ppropName),
+                *(params->ppropSize));
+        });
+        writer.text("pPropSizeRet", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppPropSizeRet));
+        });
+    } break;
+    case UR_FUNCTION_MEM_IMAGE_GET_INFO: {
+        auto params = (const struct ur_mem_image_get_info_params_t *)args;
+        writer.pointer("hMemory", *(params->phMemory));
+        writer.text("propName", [&](std::ostream &os) {
+            os << *(params->ppropName);
+        });
+        writer.number("propSize", *(params->ppropSize));
+        writer.text("pPropValue", [&](std::ostream &os) {
+            ur_params::serializeTaggedTyped_ur_image_info_t(
+                os, *(params->ppPropValue), *(params->ppropName),
+                *(params->ppropSize));
+        });
+        writer.text("pPropSizeRet", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppPropSizeRet));
+        });
+    } break;
+    case UR_FUNCTION_PLATFORM_GET: {
+        auto params = (const struct ur_platform_get_params_t *)args;
+        writer.number("NumEntries", *(params->pNumEntries));
+        writer.text("phPlatforms", [&](std::ostream &os) {
+            os << "[";
+            for (size_t i = 0;
+                 *(params->pphPlatforms) != NULL && i < *params->pNumEntries;
+                 ++i) {
+                if (i != 0) {
+                    os << ", ";
+                }
+                ur_params::serializePtr(os, (*(params->pphPlatforms))[i]);
+            }
+            os << "]";
+        });
+        writer.text("pNumPlatforms", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppNumPlatforms));
+        });
+    } break;
+    case UR_FUNCTION_PLATFORM_GET_INFO: {
+        auto params = (const struct ur_platform_get_info_params_t *)args;
+        writer.pointer("hPlatform", *(params->phPlatform));
+        writer.text("propName", [&](std::ostream &os) {
+            os << *(params->ppropName);
+        });
+        writer.number("propSize", *(params->ppropSize));
+        writer.text("pPropValue", [&](std::ostream &os) {
+            ur_params::serializeTaggedTyped_ur_platform_info_t(
+                os, *(params->ppPropValue), *(params->ppropName),
+                *(params->ppropSize));
+        });
+        writer.text("pSizeRet", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppSizeRet));
+        });
+    } break;
+    case UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE: {
+        auto params =
+            (const struct ur_platform_get_native_handle_params_t *)args;
+        writer.pointer("hPlatform", *(params->phPlatform));
+        writer.text("phNativePlatform", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphNativePlatform));
+        });
+    } break;
+    case UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE: {
+        auto params =
+            (const struct ur_platform_create_with_native_handle_params_t *)args;
+        writer.pointer("hNativePlatform", *(params->phNativePlatform));
+        writer.text("phPlatform", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphPlatform));
+        });
+    } break;
+    case UR_FUNCTION_PLATFORM_GET_API_VERSION: {
+        auto params = (const struct ur_platform_get_api_version_params_t *)args;
+        writer.pointer("hDriver", *(params->phDriver));
+        writer.text("pVersion", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppVersion));
+        });
+    } break;
+    case UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION: {
+        auto params =
+            (const struct ur_platform_get_backend_option_params_t *)args;
+        writer.pointer("hPlatform", *(params->phPlatform));
+        writer.text("pFrontendOption", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppFrontendOption));
+        });
+        writer.text("ppPlatformOption", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pppPlatformOption));
+        });
+    } break;
+    case UR_FUNCTION_PROGRAM_CREATE_WITH_IL: {
+        auto params = (const struct ur_program_create_with_il_params_t *)args;
+        writer.pointer("hContext", *(params->phContext));
+        writer.text("pIL", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppIL));
+        });
+        writer.number("length", *(params->plength));
+        writer.text("pProperties", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppProperties));
+        });
+        writer.text("phProgram", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphProgram));
+        });
+    } break;
+    case UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY: {
+        auto params =
+            (const struct ur_program_create_with_binary_params_t *)args;
+        writer.pointer("hContext", *(params->phContext));
+        writer.pointer("hDevice", *(params->phDevice));
+        writer.number("size", *(params->psize));
+        writer.text("pBinary", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppBinary));
+        });
+        writer.text("pProperties", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppProperties));
+        });
+        writer.text("phProgram", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphProgram));
+        });
+    } break;
+    case UR_FUNCTION_PROGRAM_BUILD: {
+        auto params = (const struct ur_program_build_params_t *)args;
+        writer.pointer("hContext", *(params->phContext));
+        writer.pointer("hProgram", *(params->phProgram));
+        writer.text("pOptions", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppOptions));
+        });
+    } break;
+    case UR_FUNCTION_PROGRAM_COMPILE: {
+        auto params = (const struct ur_program_compile_params_t *)args;
+        writer.pointer("hContext", *(params->phContext));
+        writer.pointer("hProgram", *(params->phProgram));
+        writer.text("pOptions", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppOptions));
+        });
+    } break;
+    case UR_FUNCTION_PROGRAM_LINK: {
+        auto params = (const struct ur_program_link_params_t *)args;
+        writer.pointer("hContext", *(params->phContext));
+        writer.number("count", *(params->pcount));
+        writer.text("phPrograms", [&](std::ostream &os) {
+            os << "[";
+            for (size_t i = 0;
+                 *(params->pphPrograms) != NULL && i < *params->pcount; ++i) {
+                if (i != 0) {
+                    os << ", ";
+                }
+                ur_params::serializePtr(os, (*(params->pphPrograms))[i]);
+            }
+            os << "]";
+        });
+        writer.text("pOptions", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppOptions));
+        });
+        writer.text("phProgram", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphProgram));
+        });
+    } break;
+    case UR_FUNCTION_PROGRAM_RETAIN: {
+        auto params = (const struct ur_program_retain_params_t *)args;
+        writer.pointer("hProgram", *(params->phProgram));
+    } break;
+    case UR_FUNCTION_PROGRAM_RELEASE: {
+        auto params = (const struct ur_program_release_params_t *)args;
+        writer.pointer("hProgram", *(params->phProgram));
+    } break;
+    case UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER: {
+        auto params =
+            (const struct ur_program_get_function_pointer_params_t *)args;
+        writer.pointer("hDevice", *(params->phDevice));
+        writer.pointer("hProgram", *(params->phProgram));
+        writer.text("pFunctionName", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppFunctionName));
+        });
+        writer.text("ppFunctionPointer", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pppFunctionPointer));
+        });
+    } break;
+    case UR_FUNCTION_PROGRAM_GET_INFO: {
+        auto params = (const struct ur_program_get_info_params_t *)args;
+        writer.pointer("hProgram", *(params->phProgram));
+        writer.text("propName", [&](std::ostream &os) {
+            os << *(params->ppropName);
+        });
+        writer.number("propSize", *(params->ppropSize));
+        writer.text("pPropValue", [&](std::ostream &os) {
+            ur_params::serializeTaggedTyped_ur_program_info_t(
+                os, *(params->ppPropValue), *(params->ppropName),
+                *(params->ppropSize));
+        });
+        writer.text("pPropSizeRet", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppPropSizeRet));
+        });
+    } break;
+    case UR_FUNCTION_PROGRAM_GET_BUILD_INFO: {
+        auto params = (const struct ur_program_get_build_info_params_t *)args;
+        writer.pointer("hProgram", *(params->phProgram));
+        writer.pointer("hDevice", *(params->phDevice));
+        writer.text("propName", [&](std::ostream &os) {
+            os << *(params->ppropName);
+        });
+        writer.number("propSize", *(params->ppropSize));
+        writer.text("pPropValue", [&](std::ostream &os) {
+            ur_params::serializeTaggedTyped_ur_program_build_info_t(
+                os, *(params->ppPropValue), *(params->ppropName),
+                *(params->ppropSize));
+        });
+        writer.text("pPropSizeRet", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppPropSizeRet));
+        });
+    } break;
+    case UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS: {
+        auto params =
+            (const struct ur_program_set_specialization_constants_params_t *)
+                args;
+        writer.pointer("hProgram", *(params->phProgram));
+        writer.number("count", *(params->pcount));
+        writer.text("pSpecConstants", [&](std::ostream &os) {
+            os << "[";
+            for (size_t i = 0;
+                 *(params->ppSpecConstants) != NULL && i < *params->pcount;
+                 ++i) {
+                if (i != 0) {
+                    os << ", ";
+                }
+                os << (*(params->ppSpecConstants))[i];
+            }
+            os << "]";
+        });
+    } break;
+    case UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE: {
+        auto params =
+            (const struct ur_program_get_native_handle_params_t *)args;
+        writer.pointer("hProgram", *(params->phProgram));
+        writer.text("phNativeProgram", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphNativeProgram));
+        });
+    } break;
+    case UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE: {
+        auto params =
+            (const struct ur_program_create_with_native_handle_params_t *)args;
+        writer.pointer("hNativeProgram", *(params->phNativeProgram));
+        writer.pointer("hContext", *(params->phContext));
+        writer.text("phProgram", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphProgram));
+        });
+    } break;
+    case UR_FUNCTION_QUEUE_GET_INFO: {
+        auto params = (const struct ur_queue_get_info_params_t *)args;
+        writer.pointer("hQueue", *(params->phQueue));
+        writer.text("propName", [&](std::ostream &os) {
+            os << *(params->ppropName);
+        });
+        writer.number("propSize", *(params->ppropSize));
+        writer.text("pPropValue", [&](std::ostream &os) {
+            ur_params::serializeTaggedTyped_ur_queue_info_t(
+                os, *(params->ppPropValue), *(params->ppropName),
+                *(params->ppropSize));
+        });
+        writer.text("pPropSizeRet", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppPropSizeRet));
+        });
+    } break;
+    case UR_FUNCTION_QUEUE_CREATE: {
+        auto params = (const struct ur_queue_create_params_t *)args;
+        writer.pointer("hContext", *(params->phContext));
+        writer.pointer("hDevice", *(params->phDevice));
+        writer.text("pProperties", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppProperties));
+        });
+        writer.text("phQueue", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphQueue));
+        });
+    } break;
+    case UR_FUNCTION_QUEUE_RETAIN: {
+        auto params = (const struct ur_queue_retain_params_t *)args;
+        writer.pointer("hQueue", *(params->phQueue));
+    } break;
+    case UR_FUNCTION_QUEUE_RELEASE: {
+        auto params = (const struct ur_queue_release_params_t *)args;
+        writer.pointer("hQueue", *(params->phQueue));
+    } break;
+    case UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE: {
+        auto params = (const struct ur_queue_get_native_handle_params_t *)args;
+        writer.pointer("hQueue", *(params->phQueue));
+        writer.text("phNativeQueue", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphNativeQueue));
+        });
+    } break;
+    case UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE: {
+        auto params =
+            (const struct ur_queue_create_with_native_handle_params_t *)args;
+        writer.pointer("hNativeQueue", *(params->phNativeQueue));
+        writer.pointer("hContext", *(params->phContext));
+        writer.text("phQueue", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphQueue));
+        });
+    } break;
+    case UR_FUNCTION_QUEUE_FINISH: {
+        auto params = (const struct ur_queue_finish_params_t *)args;
+        writer.pointer("hQueue", *(params->phQueue));
+    } break;
+    case UR_FUNCTION_QUEUE_FLUSH: {
+        auto params = (const struct ur_queue_flush_params_t *)args;
+        writer.pointer("hQueue", *(params->phQueue));
+    } break;
+    case UR_FUNCTION_SAMPLER_CREATE: {
+        auto params = (const struct ur_sampler_create_params_t *)args;
+        writer.pointer("hContext", *(params->phContext));
+        writer.text("pDesc", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppDesc));
+        });
+        writer.text("phSampler", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphSampler));
+        });
+    } break;
+    case UR_FUNCTION_SAMPLER_RETAIN: {
+        auto params = (const struct ur_sampler_retain_params_t *)args;
+        writer.pointer("hSampler", *(params->phSampler));
+    } break;
+    case UR_FUNCTION_SAMPLER_RELEASE: {
+        auto params = (const struct ur_sampler_release_params_t *)args;
+        writer.pointer("hSampler", *(params->phSampler));
+    } break;
+    case UR_FUNCTION_SAMPLER_GET_INFO: {
+        auto params = (const struct ur_sampler_get_info_params_t *)args;
+        writer.pointer("hSampler", *(params->phSampler));
+        writer.text("propName", [&](std::ostream &os) {
+            os << *(params->ppropName);
+        });
+        writer.number("propSize", *(params->ppropSize));
+        writer.text("pPropValue", [&](std::ostream &os) {
+            ur_params::serializeTaggedTyped_ur_sampler_info_t(
+                os, *(params->ppPropValue), *(params->ppropName),
+                *(params->ppropSize));
+        });
+        writer.text("pPropSizeRet", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppPropSizeRet));
+        });
+    } break;
+    case UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE: {
+        auto params =
+            (const struct ur_sampler_get_native_handle_params_t *)args;
+        writer.pointer("hSampler", *(params->phSampler));
+        writer.text("phNativeSampler", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphNativeSampler));
+        });
+    } break;
+    case UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE: {
+        auto params =
+            (const struct ur_sampler_create_with_native_handle_params_t *)args;
+        writer.pointer("hNativeSampler", *(params->phNativeSampler));
+        writer.pointer("hContext", *(params->phContext));
+        writer.text("phSampler", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphSampler));
+        });
+    } break;
+    case UR_FUNCTION_USM_HOST_ALLOC: {
+        auto params = (const struct ur_usm_host_alloc_params_t *)args;
+        writer.pointer("hContext", *(params->phContext));
+        writer.text("pUSMDesc", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppUSMDesc));
+        });
+        writer.pointer("pool", *(params->ppool));
+        writer.number("size", *(params->psize));
+        writer.text("ppMem", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pppMem));
+        });
+    } break;
+    case UR_FUNCTION_USM_DEVICE_ALLOC: {
+        auto params = (const struct ur_usm_device_alloc_params_t *)args;
+        writer.pointer("hContext", *(params->phContext));
+        writer.pointer("hDevice", *(params->phDevice));
+        writer.text("pUSMDesc", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppUSMDesc));
+        });
+        writer.pointer("pool", *(params->ppool));
+        writer.number("size", *(params->psize));
+        writer.text("ppMem", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pppMem));
+        });
+    } break;
+    case UR_FUNCTION_USM_SHARED_ALLOC: {
+        auto params = (const struct ur_usm_shared_alloc_params_t *)args;
+        writer.pointer("hContext", *(params->phContext));
+        writer.pointer("hDevice", *(params->phDevice));
+        writer.text("pUSMDesc", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppUSMDesc));
+        });
+        writer.pointer("pool", *(params->ppool));
+        writer.number("size", *(params->psize));
+        writer.text("ppMem", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pppMem));
+        });
+    } break;
+    case UR_FUNCTION_USM_FREE: {
+        auto params = (const struct ur_usm_free_params_t *)args;
+        writer.pointer("hContext", *(params->phContext));
+        writer.text("pMem", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppMem));
+        });
+    } break;
+    case UR_FUNCTION_USM_GET_MEM_ALLOC_INFO: {
+        auto params = (const struct ur_usm_get_mem_alloc_info_params_t *)args;
+        writer.pointer("hContext", *(params->phContext));
+        writer.text("pMem", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppMem));
+        });
+        writer.text("propName", [&](std::ostream &os) {
+            os << *(params->ppropName);
+        });
+        writer.number("propSize", *(params->ppropSize));
+        writer.text("pPropValue", [&](std::ostream &os) {
+            ur_params::serializeTaggedTyped_ur_usm_alloc_info_t(
+                os, *(params->ppPropValue), *(params->ppropName),
+                *(params->ppropSize));
+        });
+        writer.text("pPropSizeRet", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppPropSizeRet));
+        });
+    } break;
+    case UR_FUNCTION_USM_POOL_CREATE: {
+        auto params = (const struct ur_usm_pool_create_params_t *)args;
+        writer.pointer("hContext", *(params->phContext));
+        writer.text("pPoolDesc", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppPoolDesc));
+        });
+        writer.text("ppPool", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pppPool));
+        });
+    } break;
+    case UR_FUNCTION_USM_POOL_DESTROY: {
+        auto params = (const struct ur_usm_pool_destroy_params_t *)args;
+        writer.pointer("hContext", *(params->phContext));
+        writer.pointer("pPool", *(params->ppPool));
+    } break;
+    case UR_FUNCTION_DEVICE_GET: {
+        auto params = (const struct ur_device_get_params_t *)args;
+        writer.pointer("hPlatform", *(params->phPlatform));
+        writer.text("DeviceType", [&](std::ostream &os) {
+            os << *(params->pDeviceType);
+        });
+        writer.number("NumEntries", *(params->pNumEntries));
+        writer.text("phDevices", [&](std::ostream &os) {
+            os << "[";
+            for (size_t i = 0;
+                 *(params->pphDevices) != NULL && i < *params->pNumEntries;
+                 ++i) {
+                if (i != 0) {
+                    os << ", ";
+                }
+                ur_params::serializePtr(os, (*(params->pphDevices))[i]);
+            }
+            os << "]";
+        });
+        writer.text("pNumDevices", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppNumDevices));
+        });
+    } break;
+    case UR_FUNCTION_DEVICE_GET_INFO: {
+        auto params = (const struct ur_device_get_info_params_t *)args;
+        writer.pointer("hDevice", *(params->phDevice));
+        writer.text("propName", [&](std::ostream &os) {
+            os << *(params->ppropName);
+        });
+        writer.number("propSize", *(params->ppropSize));
+        writer.text("pPropValue", [&](std::ostream &os) {
+            ur_params::serializeTaggedTyped_ur_device_info_t(
+                os, *(params->ppPropValue), *(params->ppropName),
+                *(params->ppropSize));
+        });
+        writer.text("pPropSizeRet", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppPropSizeRet));
+        });
+    } break;
+    case UR_FUNCTION_DEVICE_RETAIN: {
+        auto params = (const struct ur_device_retain_params_t *)args;
+        writer.pointer("hDevice", *(params->phDevice));
+    } break;
+    case UR_FUNCTION_DEVICE_RELEASE: {
+        auto params = (const struct ur_device_release_params_t *)args;
+        writer.pointer("hDevice", *(params->phDevice));
+    } break;
+    case UR_FUNCTION_DEVICE_PARTITION: {
+        auto params = (const struct ur_device_partition_params_t *)args;
+        writer.pointer("hDevice", *(params->phDevice));
+        writer.text("pProperties", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppProperties));
+        });
+        writer.number("NumDevices", *(params->pNumDevices));
+        writer.text("phSubDevices", [&](std::ostream &os) {
+            os << "[";
+            for (size_t i = 0;
+                 *(params->pphSubDevices) != NULL && i < *params->pNumDevices;
+                 ++i) {
+                if (i != 0) {
+                    os << ", ";
+                }
+                ur_params::serializePtr(os, (*(params->pphSubDevices))[i]);
+            }
+            os << "]";
+        });
+        writer.text("pNumDevicesRet", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppNumDevicesRet));
+        });
+    } break;
+    case UR_FUNCTION_DEVICE_SELECT_BINARY: {
+        auto params = (const struct ur_device_select_binary_params_t *)args;
+        writer.pointer("hDevice", *(params->phDevice));
+        writer.text("pBinaries", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppBinaries));
+        });
+        writer.number("NumBinaries", *(params->pNumBinaries));
+        writer.text("pSelectedBinary", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppSelectedBinary));
+        });
+    } break;
+    case UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE: {
+        auto params = (const struct ur_device_get_native_handle_params_t *)args;
+        writer.pointer("hDevice", *(params->phDevice));
+        writer.text("phNativeDevice", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphNativeDevice));
+        });
+    } break;
+    case UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE: {
+        auto params =
+            (const struct ur_device_create_with_native_handle_params_t *)args;
+        writer.pointer("hNativeDevice", *(params->phNativeDevice));
+        writer.pointer("hPlatform", *(params->phPlatform));
+        writer.text("phDevice", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->pphDevice));
+        });
+    } break;
+    case UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS: {
+        auto params =
+            (const struct ur_device_get_global_timestamps_params_t *)args;
+        writer.pointer("hDevice", *(params->phDevice));
+        writer.text("pDeviceTimestamp", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppDeviceTimestamp));
+        });
+        writer.text("pHostTimestamp", [&](std::ostream &os) {
+            ur_params::serializePtr(os, *(params->ppHostTimestamp));
+        });
+    } break;
+    default:
+        return -1;
+    }
+    return 0;
+}
+
+/// how the capture of the calls records a parameter of a function
+enum class param_kind_t : uint8_t {
+    value,        ///< passed by value
+    handle,       ///< handle, remapped when replayed
+    handle_array, ///< array of `count` handles
+    handle_out,   ///< returns `count` handles, or one if there is no count
+    data,         ///< array of `count` elements of `size` bytes, or one
+    desc,         ///< descriptor or properties struct, its pNext chain is
+                  ///< not captured
+    string,       ///< null-terminated string
+    memory,       ///< USM or host memory the function reads `count` bytes of
+    memory_out,   ///< USM or host memory the function writes `count` bytes to
+    alloc_out,    ///< returns a pointer to `count` bytes of USM or host memory
+    out,          ///< returns `count` elements of `size` bytes, or one
+    ignored,      ///< passed as null when replayed
+    unsupported,  ///< a call with this parameter not null cannot be replayed
+};
+
+/// capture description of a parameter of a function
+struct capture_param_t {
+    param_kind_t kind;
+    uint32_t size; ///< size of the value, or of an element of the array
+    int32_t count; ///< index of the parameter holding the number of elements
+                   ///< or bytes, -1 if there is none
+};
+
+/// returns the capture description of the parameters of a function, one per
+/// member of its params struct, nullptr for an unknown function
+inline const capture_param_t *getCaptureParams(uint32_t function,
+                                               size_t *count) {
+    switch ((enum ur_function_t)function) {
+    case UR_FUNCTION_INIT: {
+        static const capture_param_t params[] = {
+            {param_kind_t::value, sizeof(ur_device_init_flags_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_GET_LAST_RESULT: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_platform_handle_t), -1},
+            {param_kind_t::out, sizeof(char *), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_TEAR_DOWN: {
+        static const capture_param_t params[] = {
+            {param_kind_t::ignored, 1, -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_CONTEXT_CREATE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::handle_array, sizeof(ur_device_handle_t), 0},
+            {param_kind_t::desc, sizeof(ur_context_properties_t), -1},
+            {param_kind_t::handle_out, sizeof(ur_context_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_CONTEXT_RETAIN: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_context_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_CONTEXT_RELEASE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_context_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_CONTEXT_GET_INFO: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_context_handle_t), -1},
+            {param_kind_t::value, sizeof(ur_context_info_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::out, 1, 2},
+            {param_kind_t::out, sizeof(size_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_context_handle_t), -1},
+            {param_kind_t::out, sizeof(ur_native_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::unsupported, sizeof(ur_native_handle_t), -1},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::handle_array, sizeof(ur_device_handle_t), 1},
+            {param_kind_t::desc, sizeof(ur_context_native_properties_t), -1},
+            {param_kind_t::handle_out, sizeof(ur_context_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_context_handle_t), -1},
+            {param_kind_t::unsupported, sizeof(ur_context_extended_deleter_t),
+             -1},
+            {param_kind_t::ignored, 1, -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_queue_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_kernel_handle_t), -1},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::data, sizeof(size_t), 2},
+            {param_kind_t::data, sizeof(size_t), 2},
+            {param_kind_t::data, sizeof(size_t), 2},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::handle_array, sizeof(ur_event_handle_t), 6},
+            {param_kind_t::handle_out, sizeof(ur_event_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_ENQUEUE_EVENTS_WAIT: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_queue_handle_t), -1},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::handle_array, sizeof(ur_event_handle_t), 1},
+            {param_kind_t::handle_out, sizeof(ur_event_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_queue_handle_t), -1},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::handle_array, sizeof(ur_event_handle_t), 1},
+            {param_kind_t::handle_out, sizeof(ur_event_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_queue_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_mem_handle_t), -1},
+            {param_kind_t::value, sizeof(bool), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::memory_out, 1, 4},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::handle_array, sizeof(ur_event_handle_t), 6},
+            {param_kind_t::handle_out, sizeof(ur_event_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_queue_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_mem_handle_t), -1},
+            {param_kind_t::value, sizeof(bool), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::memory, 1, 4},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::handle_array, sizeof(ur_event_handle_t), 6},
+            {param_kind_t::handle_out, sizeof(ur_event_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_queue_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_mem_handle_t), -1},
+            {param_kind_t::value, sizeof(bool), -1},
+            {param_kind_t::value, sizeof(ur_rect_offset_t), -1},
+            {param_kind_t::value, sizeof(ur_rect_offset_t), -1},
+            {param_kind_t::value, sizeof(ur_rect_region_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::memory_out, 1, -1},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::handle_array, sizeof(ur_event_handle_t), 11},
+            {param_kind_t::handle_out, sizeof(ur_event_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_queue_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_mem_handle_t), -1},
+            {param_kind_t::value, sizeof(bool), -1},
+            {param_kind_t::value, sizeof(ur_rect_offset_t), -1},
+            {param_kind_t::value, sizeof(ur_rect_offset_t), -1},
+            {param_kind_t::value, sizeof(ur_rect_region_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::memory, 1, -1},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::handle_array, sizeof(ur_event_handle_t), 11},
+            {param_kind_t::handle_out, sizeof(ur_event_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_queue_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_mem_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_mem_handle_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::handle_array, sizeof(ur_event_handle_t), 6},
+            {param_kind_t::handle_out, sizeof(ur_event_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_queue_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_mem_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_mem_handle_t), -1},
+            {param_kind_t::value, sizeof(ur_rect_offset_t), -1},
+            {param_kind_t::value, sizeof(ur_rect_offset_t), -1},
+            {param_kind_t::value, sizeof(ur_rect_region_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::handle_array, sizeof(ur_event_handle_t), 10},
+            {param_kind_t::handle_out, sizeof(ur_event_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_queue_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_mem_handle_t), -1},
+            {param_kind_t::memory, 1, 3},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::handle_array, sizeof(ur_event_handle_t), 6},
+            {param_kind_t::handle_out, sizeof(ur_event_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_queue_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_mem_handle_t), -1},
+            {param_kind_t::value, sizeof(bool), -1},
+            {param_kind_t::value, sizeof(ur_rect_offset_t), -1},
+            {param_kind_t::value, sizeof(ur_rect_region_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::memory_out, 1, -1},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::handle_array, sizeof(ur_event_handle_t), 8},
+            {param_kind_t::handle_out, sizeof(ur_event_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_queue_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_mem_handle_t), -1},
+            {param_kind_t::value, sizeof(bool), -1},
+            {param_kind_t::value, sizeof(ur_rect_offset_t), -1},
+            {param_kind_t::value, sizeof(ur_rect_region_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::memory, 1, -1},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::handle_array, sizeof(ur_event_handle_t), 8},
+            {param_kind_t::handle_out, sizeof(ur_event_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_queue_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_mem_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_mem_handle_t), -1},
+            {param_kind_t::value, sizeof(ur_rect_offset_t), -1},
+            {param_kind_t::value, sizeof(ur_rect_offset_t), -1},
+            {param_kind_t::value, sizeof(ur_rect_region_t), -1},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::handle_array, sizeof(ur_event_handle_t), 6},
+            {param_kind_t::handle_out, sizeof(ur_event_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_queue_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_mem_handle_t), -1},
+            {param_kind_t::value, sizeof(bool), -1},
+            {param_kind_t::value, sizeof(ur_map_flags_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::handle_array, sizeof(ur_event_handle_t), 6},
+            {param_kind_t::handle_out, sizeof(ur_event_handle_t), -1},
+            {param_kind_t::alloc_out, sizeof(void *), 5},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_UNMAP: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_queue_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_mem_handle_t), -1},
+            {param_kind_t::memory, 1, -1},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::handle_array, sizeof(ur_event_handle_t), 3},
+            {param_kind_t::handle_out, sizeof(ur_event_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_ENQUEUE_USM_FILL: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_queue_handle_t), -1},
+            {param_kind_t::memory_out, 1, 4},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::memory, 1, 2},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::handle_array, sizeof(ur_event_handle_t), 5},
+            {param_kind_t::handle_out, sizeof(ur_event_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_ENQUEUE_USM_MEMCPY: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_queue_handle_t), -1},
+            {param_kind_t::value, sizeof(bool), -1},
+            {param_kind_t::memory_out, 1, 4},
+            {param_kind_t::memory, 1, 4},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::handle_array, sizeof(ur_event_handle_t), 5},
+            {param_kind_t::handle_out, sizeof(ur_event_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_ENQUEUE_USM_PREFETCH: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_queue_handle_t), -1},
+            {param_kind_t::memory, 1, 2},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(ur_usm_migration_flags_t), -1},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::handle_array, sizeof(ur_event_handle_t), 4},
+            {param_kind_t::handle_out, sizeof(ur_event_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_ENQUEUE_USM_ADVISE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_queue_handle_t), -1},
+            {param_kind_t::memory, 1, 2},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(ur_usm_advice_flags_t), -1},
+            {param_kind_t::handle_out, sizeof(ur_event_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_ENQUEUE_USM_FILL2_D: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_queue_handle_t), -1},
+            {param_kind_t::memory_out, 1, -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::memory, 1, 3},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::handle_array, sizeof(ur_event_handle_t), 7},
+            {param_kind_t::handle_out, sizeof(ur_event_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_ENQUEUE_USM_MEMCPY2_D: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_queue_handle_t), -1},
+            {param_kind_t::value, sizeof(bool), -1},
+            {param_kind_t::memory_out, 1, -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::memory, 1, -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::handle_array, sizeof(ur_event_handle_t), 8},
+            {param_kind_t::handle_out, sizeof(ur_event_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_queue_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_program_handle_t), -1},
+            {param_kind_t::string, sizeof(char), -1},
+            {param_kind_t::value, sizeof(bool), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::memory, 1, 4},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::handle_array, sizeof(ur_event_handle_t), 7},
+            {param_kind_t::handle_out, sizeof(ur_event_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_queue_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_program_handle_t), -1},
+            {param_kind_t::string, sizeof(char), -1},
+            {param_kind_t::value, sizeof(bool), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::memory_out, 1, 4},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::handle_array, sizeof(ur_event_handle_t), 7},
+            {param_kind_t::handle_out, sizeof(ur_event_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_EVENT_GET_INFO: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_event_handle_t), -1},
+            {param_kind_t::value, sizeof(ur_event_info_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::out, 1, 2},
+            {param_kind_t::out, sizeof(size_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_EVENT_GET_PROFILING_INFO: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_event_handle_t), -1},
+            {param_kind_t::value, sizeof(ur_profiling_info_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::out, 1, 2},
+            {param_kind_t::out, sizeof(size_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_EVENT_WAIT: {
+        static const capture_param_t params[] = {
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::handle_array, sizeof(ur_event_handle_t), 0},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_EVENT_RETAIN: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_event_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_EVENT_RELEASE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_event_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_EVENT_GET_NATIVE_HANDLE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_event_handle_t), -1},
+            {param_kind_t::out, sizeof(ur_native_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::unsupported, sizeof(ur_native_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_context_handle_t), -1},
+            {param_kind_t::handle_out, sizeof(ur_event_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_EVENT_SET_CALLBACK: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_event_handle_t), -1},
+            {param_kind_t::value, sizeof(ur_execution_info_t), -1},
+            {param_kind_t::unsupported, sizeof(ur_event_callback_t), -1},
+            {param_kind_t::ignored, 1, -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_KERNEL_CREATE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_program_handle_t), -1},
+            {param_kind_t::string, sizeof(char), -1},
+            {param_kind_t::handle_out, sizeof(ur_kernel_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_KERNEL_GET_INFO: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_kernel_handle_t), -1},
+            {param_kind_t::value, sizeof(ur_kernel_info_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::out, 1, 2},
+            {param_kind_t::out, sizeof(size_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_KERNEL_GET_GROUP_INFO: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_kernel_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_device_handle_t), -1},
+            {param_kind_t::value, sizeof(ur_kernel_group_info_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::out, 1, 3},
+            {param_kind_t::out, sizeof(size_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_kernel_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_device_handle_t), -1},
+            {param_kind_t::value, sizeof(ur_kernel_sub_group_info_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::out, 1, 3},
+            {param_kind_t::out, sizeof(size_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_KERNEL_RETAIN: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_kernel_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_KERNEL_RELEASE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_kernel_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_kernel_handle_t), -1},
+            {param_kind_t::out, sizeof(ur_native_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::unsupported, sizeof(ur_native_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_context_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_program_handle_t), -1},
+            {param_kind_t::desc, sizeof(ur_kernel_native_properties_t), -1},
+            {param_kind_t::handle_out, sizeof(ur_kernel_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_KERNEL_SET_ARG_VALUE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_kernel_handle_t), -1},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::memory, 1, 2},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_KERNEL_SET_ARG_LOCAL: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_kernel_handle_t), -1},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_KERNEL_SET_ARG_POINTER: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_kernel_handle_t), -1},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::memory, 1, -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_KERNEL_SET_EXEC_INFO: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_kernel_handle_t), -1},
+            {param_kind_t::value, sizeof(ur_kernel_exec_info_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::memory, 1, 2},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_KERNEL_SET_ARG_SAMPLER: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_kernel_handle_t), -1},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::handle, sizeof(ur_sampler_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_kernel_handle_t), -1},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::handle, sizeof(ur_mem_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_kernel_handle_t), -1},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::unsupported,
+             sizeof(ur_specialization_constant_info_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_MEM_IMAGE_CREATE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_context_handle_t), -1},
+            {param_kind_t::value, sizeof(ur_mem_flags_t), -1},
+            {param_kind_t::data, sizeof(ur_image_format_t), -1},
+            {param_kind_t::desc, sizeof(ur_image_desc_t), -1},
+            {param_kind_t::memory, 1, -1},
+            {param_kind_t::handle_out, sizeof(ur_mem_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_MEM_BUFFER_CREATE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_context_handle_t), -1},
+            {param_kind_t::value, sizeof(ur_mem_flags_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::unsupported, sizeof(ur_buffer_properties_t), -1},
+            {param_kind_t::handle_out, sizeof(ur_mem_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_MEM_RETAIN: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_mem_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_MEM_RELEASE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_mem_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_MEM_BUFFER_PARTITION: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_mem_handle_t), -1},
+            {param_kind_t::value, sizeof(ur_mem_flags_t), -1},
+            {param_kind_t::value, sizeof(ur_buffer_create_type_t), -1},
+            {param_kind_t::desc, sizeof(ur_buffer_region_t), -1},
+            {param_kind_t::handle_out, sizeof(ur_mem_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_MEM_GET_NATIVE_HANDLE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_mem_handle_t), -1},
+            {param_kind_t::out, sizeof(ur_native_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_MEM_CREATE_WITH_NATIVE_HANDLE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::unsupported, sizeof(ur_native_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_context_handle_t), -1},
+            {param_kind_t::handle_out, sizeof(ur_mem_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_MEM_GET_INFO: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_mem_handle_t), -1},
+            {param_kind_t::value, sizeof(ur_mem_info_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::out, 1, 2},
+            {param_kind_t::out, sizeof(size_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_MEM_IMAGE_GET_INFO: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_mem_handle_t), -1},
+            {param_kind_t::value, sizeof(ur_image_info_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::out, 1, 2},
+            {param_kind_t::out, sizeof(size_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_PLATFORM_GET: {
+        static const capture_param_t params[] = {
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::handle_out, sizeof(ur_platform_handle_t), 0},
+            {param_kind_t::out, sizeof(uint32_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_PLATFORM_GET_INFO: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_platform_handle_t), -1},
+            {param_kind_t::value, sizeof(ur_platform_info_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::out, 1, 2},
+            {param_kind_t::out, sizeof(size_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_platform_handle_t), -1},
+            {param_kind_t::out, sizeof(ur_native_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::unsupported, sizeof(ur_native_handle_t), -1},
+            {param_kind_t::handle_out, sizeof(ur_platform_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_PLATFORM_GET_API_VERSION: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_platform_handle_t), -1},
+            {param_kind_t::out, sizeof(ur_api_version_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_platform_handle_t), -1},
+            {param_kind_t::string, sizeof(char), -1},
+            {param_kind_t::out, sizeof(char *), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_PROGRAM_CREATE_WITH_IL: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_context_handle_t), -1},
+            {param_kind_t::memory, 1, 2},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::unsupported, sizeof(ur_program_properties_t), -1},
+            {param_kind_t::handle_out, sizeof(ur_program_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_context_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_device_handle_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::data, sizeof(uint8_t), 2},
+            {param_kind_t::unsupported, sizeof(ur_program_properties_t), -1},
+            {param_kind_t::handle_out, sizeof(ur_program_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_PROGRAM_BUILD: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_context_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_program_handle_t), -1},
+            {param_kind_t::string, sizeof(char), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_PROGRAM_COMPILE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_context_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_program_handle_t), -1},
+            {param_kind_t::string, sizeof(char), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_PROGRAM_LINK: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_context_handle_t), -1},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::handle_array, sizeof(ur_program_handle_t), 1},
+            {param_kind_t::string, sizeof(char), -1},
+            {param_kind_t::handle_out, sizeof(ur_program_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_PROGRAM_RETAIN: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_program_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_PROGRAM_RELEASE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_program_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_device_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_program_handle_t), -1},
+            {param_kind_t::string, sizeof(char), -1},
+            {param_kind_t::out, sizeof(void *), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_PROGRAM_GET_INFO: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_program_handle_t), -1},
+            {param_kind_t::value, sizeof(ur_program_info_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::out, 1, 2},
+            {param_kind_t::out, sizeof(size_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_PROGRAM_GET_BUILD_INFO: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_program_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_device_handle_t), -1},
+            {param_kind_t::value, sizeof(ur_program_build_info_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::out, 1, 3},
+            {param_kind_t::out, sizeof(size_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_program_handle_t), -1},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::unsupported,
+             sizeof(ur_specialization_constant_info_t), 1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_program_handle_t), -1},
+            {param_kind_t::out, sizeof(ur_native_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::unsupported, sizeof(ur_native_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_context_handle_t), -1},
+            {param_kind_t::handle_out, sizeof(ur_program_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_QUEUE_GET_INFO: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_queue_handle_t), -1},
+            {param_kind_t::value, sizeof(ur_queue_info_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::out, 1, 2},
+            {param_kind_t::out, sizeof(size_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_QUEUE_CREATE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_context_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_device_handle_t), -1},
+            {param_kind_t::desc, sizeof(ur_queue_properties_t), -1},
+            {param_kind_t::handle_out, sizeof(ur_queue_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_QUEUE_RETAIN: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_queue_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_QUEUE_RELEASE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_queue_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_queue_handle_t), -1},
+            {param_kind_t::out, sizeof(ur_native_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::unsupported, sizeof(ur_native_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_context_handle_t), -1},
+            {param_kind_t::handle_out, sizeof(ur_queue_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_QUEUE_FINISH: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_queue_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_QUEUE_FLUSH: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_queue_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_SAMPLER_CREATE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_context_handle_t), -1},
+            {param_kind_t::desc, sizeof(ur_sampler_desc_t), -1},
+            {param_kind_t::handle_out, sizeof(ur_sampler_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_SAMPLER_RETAIN: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_sampler_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_SAMPLER_RELEASE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_sampler_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_SAMPLER_GET_INFO: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_sampler_handle_t), -1},
+            {param_kind_t::value, sizeof(ur_sampler_info_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::out, 1, 2},
+            {param_kind_t::out, sizeof(size_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_sampler_handle_t), -1},
+            {param_kind_t::out, sizeof(ur_native_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::unsupported, sizeof(ur_native_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_context_handle_t), -1},
+            {param_kind_t::handle_out, sizeof(ur_sampler_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_USM_HOST_ALLOC: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_context_handle_t), -1},
+            {param_kind_t::desc, sizeof(ur_usm_desc_t), -1},
+            {param_kind_t::handle, sizeof(ur_usm_pool_handle_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::alloc_out, sizeof(void *), 3},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_USM_DEVICE_ALLOC: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_context_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_device_handle_t), -1},
+            {param_kind_t::desc, sizeof(ur_usm_desc_t), -1},
+            {param_kind_t::handle, sizeof(ur_usm_pool_handle_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::alloc_out, sizeof(void *), 4},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_USM_SHARED_ALLOC: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_context_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_device_handle_t), -1},
+            {param_kind_t::desc, sizeof(ur_usm_desc_t), -1},
+            {param_kind_t::handle, sizeof(ur_usm_pool_handle_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::alloc_out, sizeof(void *), 4},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_USM_FREE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_context_handle_t), -1},
+            {param_kind_t::memory, 1, -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_USM_GET_MEM_ALLOC_INFO: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_context_handle_t), -1},
+            {param_kind_t::memory, 1, -1},
+            {param_kind_t::value, sizeof(ur_usm_alloc_info_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::out, 1, 3},
+            {param_kind_t::out, sizeof(size_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_USM_POOL_CREATE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_context_handle_t), -1},
+            {param_kind_t::desc, sizeof(ur_usm_pool_desc_t), -1},
+            {param_kind_t::handle_out, sizeof(ur_usm_pool_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_USM_POOL_DESTROY: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_context_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_usm_pool_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_DEVICE_GET: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_platform_handle_t), -1},
+            {param_kind_t::value, sizeof(ur_device_type_t), -1},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::handle_out, sizeof(ur_device_handle_t), 2},
+            {param_kind_t::out, sizeof(uint32_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_DEVICE_GET_INFO: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_device_handle_t), -1},
+            {param_kind_t::value, sizeof(ur_device_info_t), -1},
+            {param_kind_t::value, sizeof(size_t), -1},
+            {param_kind_t::out, 1, 2},
+            {param_kind_t::out, sizeof(size_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_DEVICE_RETAIN: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_device_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_DEVICE_RELEASE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_device_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_DEVICE_PARTITION: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_device_handle_t), -1},
+            {param_kind_t::unsupported, sizeof(ur_device_partition_property_t),
+             -1},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::handle_out, sizeof(ur_device_handle_t), 2},
+            {param_kind_t::out, sizeof(uint32_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_DEVICE_SELECT_BINARY: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_device_handle_t), -1},
+            {param_kind_t::unsupported, sizeof(ur_device_binary_t), -1},
+            {param_kind_t::value, sizeof(uint32_t), -1},
+            {param_kind_t::out, sizeof(uint32_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_device_handle_t), -1},
+            {param_kind_t::out, sizeof(ur_native_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE: {
+        static const capture_param_t params[] = {
+            {param_kind_t::unsupported, sizeof(ur_native_handle_t), -1},
+            {param_kind_t::handle, sizeof(ur_platform_handle_t), -1},
+            {param_kind_t::handle_out, sizeof(ur_device_handle_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    case UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS: {
+        static const capture_param_t params[] = {
+            {param_kind_t::handle, sizeof(ur_device_handle_t), -1},
+            {param_kind_t::out, sizeof(uint64_t), -1},
+            {param_kind_t::out, sizeof(uint64_t), -1},
+        };
+        *count = sizeof(params) / sizeof(params[0]);
+        return params;
+    }
+    default:
+        return nullptr;
+    }
+}
+
+/// calls a function with the arguments of a params struct
+inline ur_result_t replayCall(uint32_t function, const void *params) {
+    switch ((enum ur_function_t)function) {
+    case UR_FUNCTION_INIT: {
+        auto p = (const struct ur_init_params_t *)params;
+        return urInit(*p->pdevice_flags);
+    }
+    case UR_FUNCTION_GET_LAST_RESULT: {
+        auto p = (const struct ur_get_last_result_params_t *)params;
+        return urGetLastResult(*p->phPlatform, *p->pppMessage);
+    }
+    case UR_FUNCTION_TEAR_DOWN: {
+        auto p = (const struct ur_tear_down_params_t *)params;
+        return urTearDown(*p->ppParams);
+    }
+    case UR_FUNCTION_CONTEXT_CREATE: {
+        auto p = (const struct ur_context_create_params_t *)params;
+        return urContextCreate(*p->pDeviceCount, *p->pphDevices,
+                               *p->ppProperties, *p->pphContext);
+    }
+    case UR_FUNCTION_CONTEXT_RETAIN: {
+        auto p = (const struct ur_context_retain_params_t *)params;
+        return urContextRetain(*p->phContext);
+    }
+    case UR_FUNCTION_CONTEXT_RELEASE: {
+        auto p = (const struct ur_context_release_params_t *)params;
+        return urContextRelease(*p->phContext);
+    }
+    case UR_FUNCTION_CONTEXT_GET_INFO: {
+        auto p = (const struct ur_context_get_info_params_t *)params;
+        return urContextGetInfo(*p->phContext, *p->ppropName, *p->ppropSize,
+                                *p->ppPropValue, *p->ppPropSizeRet);
+    }
+    case UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE: {
+        auto p = (const struct ur_context_get_native_handle_params_t *)params;
+        return urContextGetNativeHandle(*p->phContext, *p->pphNativeContext);
+    }
+    case UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE: {
+        auto p =
+            (const struct ur_context_create_with_native_handle_params_t *)
+                params;
+        return urContextCreateWithNativeHandle(*p->phNativeContext,
+                                               *p->pnumDevices, *p->pphDevices,
+                                               *p->ppProperties,
+                                               *p->pphContext);
+    }
+    case UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER: {
+        auto p =
+            (const struct ur_context_set_extended_deleter_params_t *)params;
+        return urContextSetExtendedDeleter(*p->phContext, *p->ppfnDeleter,
+                                           *p->ppUserData);
+    }
+    case UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH: {
+        auto p = (const struct ur_enqueue_kernel_launch_params_t *)params;
+        return urEnqueueKernelLaunch(*p->phQueue, *p->phKernel, *p->pworkDim,
+                                     *p->ppGlobalWorkOffset,
+                                     *p->ppGlobalWorkSize, *p->ppLocalWorkSize,
+                                     *p->pnumEventsInWaitList,
+                                     *p->pphEventWaitList, *p->pphEvent);
+    }
+    case UR_FUNCTION_ENQUEUE_EVENTS_WAIT: {
+        auto p = (const struct ur_enqueue_events_wait_params_t *)params;
+        return urEnqueueEventsWait(*p->phQueue, *p->pnumEventsInWaitList,
+                                   *p->pphEventWaitList, *p->pphEvent);
+    }
+    case UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER: {
+        auto p =
+            (const struct ur_enqueue_events_wait_with_barrier_params_t *)params;
+        return urEnqueueEventsWaitWithBarrier(*p->phQueue,
+                                              *p->pnumEventsInWaitList,
+                                              *p->pphEventWaitList,
+                                              *p->pphEvent);
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ: {
+        auto p = (const struct ur_enqueue_mem_buffer_read_params_t *)params;
+        return urEnqueueMemBufferRead(*p->phQueue, *p->phBuffer,
+                                      *p->pblockingRead, *p->poffset, *p->psize,
+                                      *p->ppDst, *p->pnumEventsInWaitList,
+                                      *p->pphEventWaitList, *p->pphEvent);
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE: {
+        auto p = (const struct ur_enqueue_mem_buffer_write_params_t *)params;
+        return urEnqueueMemBufferWrite(*p->phQueue, *p->phBuffer,
+                                       *p->pblockingWrite, *p->poffset,
+                                       *p->psize, *p->ppSrc,
+                                       *p->pnumEventsInWaitList,
+                                       *p->pphEventWaitList, *p->pphEvent);
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT: {
+        auto p =
+            (const struct ur_enqueue_mem_buffer_read_rect_params_t *)params;
+        return urEnqueueMemBufferReadRect(*p->phQueue, *p->phBuffer,
+                                          *p->pblockingRead, *p->pbufferOrigin,
+                                          *p->phostOrigin, *p->pregion,
+                                          *p->pbufferRowPitch,
+                                          *p->pbufferSlicePitch,
+                                          *p->phostRowPitch,
+                                          *p->phostSlicePitch, *p->ppDst,
+                                          *p->pnumEventsInWaitList,
+                                          *p->pphEventWaitList, *p->pphEvent);
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT: {
+        auto p =
+            (const struct ur_enqueue_mem_buffer_write_rect_params_t *)params;
+        return urEnqueueMemBufferWriteRect(*p->phQueue, *p->phBuffer,
+                                           *p->pblockingWrite,
+                                           *p->pbufferOrigin, *p->phostOrigin,
+                                           *p->pregion, *p->pbufferRowPitch,
+                                           *p->pbufferSlicePitch,
+                                           *p->phostRowPitch,
+                                           *p->phostSlicePitch, *p->ppSrc,
+                                           *p->pnumEventsInWaitList,
+                                           *p->pphEventWaitList, *p->pphEvent);
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY: {
+        auto p = (const struct ur_enqueue_mem_buffer_copy_params_t *)params;
+        return urEnqueueMemBufferCopy(*p->phQueue, *p->phBufferSrc,
+                                      *p->phBufferDst, *p->psrcOffset,
+                                      *p->pdstOffset, *p->psize,
+                                      *p->pnumEventsInWaitList,
+                                      *p->pphEventWaitList, *p->pphEvent);
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT: {
+        auto p =
+            (const struct ur_enqueue_mem_buffer_copy_rect_params_t *)params;
+        return urEnqueueMemBufferCopyRect(*p->phQueue, *p->phBufferSrc,
+                                          *p->phBufferDst, *p->psrcOrigin,
+                                          *p->pdstOrigin, *p->pregion,
+                                          *p->psrcRowPitch, *p->psrcSlicePitch,
+                                          *p->pdstRowPitch, *p->pdstSlicePitch,
+                                          *p->pnumEventsInWaitList,
+                                          *p->pphEventWaitList, *p->pphEvent);
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL: {
+        auto p = (const struct ur_enqueue_mem_buffer_fill_params_t *)params;
+        return urEnqueueMemBufferFill(*p->phQueue, *p->phBuffer, *p->ppPattern,
+                                      *p->ppatternSize, *p->poffset, *p->psize,
+                                      *p->pnumEventsInWaitList,
+                                      *p->pphEventWaitList, *p->pphEvent);
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ: {
+        auto p = (const struct ur_enqueue_mem_image_read_params_t *)params;
+        return urEnqueueMemImageRead(*p->phQueue, *p->phImage,
+                                     *p->pblockingRead, *p->porigin,
+                                     *p->pregion, *p->prowPitch,
+                                     *p->pslicePitch, *p->ppDst,
+                                     *p->pnumEventsInWaitList,
+                                     *p->pphEventWaitList, *p->pphEvent);
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE: {
+        auto p = (const struct ur_enqueue_mem_image_write_params_t *)params;
+        return urEnqueueMemImageWrite(*p->phQueue, *p->phImage,
+                                      *p->pblockingWrite, *p->porigin,
+                                      *p->pregion, *p->prowPitch,
+                                      *p->pslicePitch, *p->ppSrc,
+                                      *p->pnumEventsInWaitList,
+                                      *p->pphEventWaitList, *p->pphEvent);
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY: {
+        auto p = (const struct ur_enqueue_mem_image_copy_params_t *)params;
+        return urEnqueueMemImageCopy(*p->phQueue, *p->phImageSrc,
+                                     *p->phImageDst, *p->psrcOrigin,
+                                     *p->pdstOrigin, *p->pregion,
+                                     *p->pnumEventsInWaitList,
+                                     *p->pphEventWaitList, *p->pphEvent);
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP: {
+        auto p = (const struct ur_enqueue_mem_buffer_map_params_t *)params;
+        return urEnqueueMemBufferMap(*p->phQueue, *p->phBuffer,
+                                     *p->pblockingMap, *p->pmapFlags,
+                                     *p->poffset, *p->psize,
+                                     *p->pnumEventsInWaitList,
+                                     *p->pphEventWaitList, *p->pphEvent,
+                                     *p->pppRetMap);
+    }
+    case UR_FUNCTION_ENQUEUE_MEM_UNMAP: {
+        auto p = (const struct ur_enqueue_mem_unmap_params_t *)params;
+        return urEnqueueMemUnmap(*p->phQueue, *p->phMem, *p->ppMappedPtr,
+                                 *p->pnumEventsInWaitList, *p->pphEventWaitList,
+                                 *p->pphEvent);
+    }
+    case UR_FUNCTION_ENQUEUE_USM_FILL: {
+        auto p = (const struct ur_enqueue_usm_fill_params_t *)params;
+        return urEnqueueUSMFill(*p->phQueue, *p->pptr, *p->ppatternSize,
+                                *p->ppPattern, *p->psize,
+                                *p->pnumEventsInWaitList, *p->pphEventWaitList,
+                                *p->pphEvent);
+    }
+    case UR_FUNCTION_ENQUEUE_USM_MEMCPY: {
+        auto p = (const struct ur_enqueue_usm_memcpy_params_t *)params;
+        return urEnqueueUSMMemcpy(*p->phQueue, *p->pblocking, *p->ppDst,
+                                  *p->ppSrc, *p->psize,
+                                  *p->pnumEventsInWaitList,
+                                  *p->pphEventWaitList, *p->pphEvent);
+    }
+    case UR_FUNCTION_ENQUEUE_USM_PREFETCH: {
+        auto p = (const struct ur_enqueue_usm_prefetch_params_t *)params;
+        return urEnqueueUSMPrefetch(*p->phQueue, *p->ppMem, *p->psize,
+                                    *p->pflags, *p->pnumEventsInWaitList,
+                                    *p->pphEventWaitList, *p->pphEvent);
+    }
+    case UR_FUNCTION_ENQUEUE_USM_ADVISE: {
+        auto p = (const struct ur_enqueue_usm_advise_params_t *)params;
+        return urEnqueueUSMAdvise(*p->phQueue, *p->ppMem, *p->psize,
+                                  *p->padvice, *p->pphEvent);
+    }
+    case UR_FUNCTION_ENQUEUE_USM_FILL2_D: {
+        auto p = (const struct ur_enqueue_usm_fill2_d_params_t *)params;
+        return urEnqueueUSMFill2D(*p->phQueue, *p->ppMem, *p->ppitch,
+                                  *p->ppatternSize, *p->ppPattern, *p->pwidth,
+                                  *p->pheight, *p->pnumEventsInWaitList,
+                                  *p->pphEventWaitList, *p->pphEvent);
+    }
+    case UR_FUNCTION_ENQUEUE_USM_MEMCPY2_D: {
+        auto p = (const struct ur_enqueue_usm_memcpy2_d_params_t *)params;
+        return urEnqueueUSMMemcpy2D(*p->phQueue, *p->pblocking, *p->ppDst,
+                                    *p->pdstPitch, *p->ppSrc, *p->psrcPitch,
+                                    *p->pwidth, *p->pheight,
+                                    *p->pnumEventsInWaitList,
+                                    *p->pphEventWaitList, *p->pphEvent);
+    }
+    case UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE: {
+        auto p =
+            (const struct ur_enqueue_device_global_variable_write_params_t *)
+                params;
+        return urEnqueueDeviceGlobalVariableWrite(*p->phQueue, *p->phProgram,
+                                                  *p->pname, *p->pblockingWrite,
+                                                  *p->pcount, *p->poffset,
+                                                  *p->ppSrc,
+                                                  *p->pnumEventsInWaitList,
+                                                  *p->pphEventWaitList,
+                                                  *p->pphEvent);
+    }
+    case UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ: {
+        auto p =
+            (const struct ur_enqueue_device_global_variable_read_params_t *)
+                params;
+        return urEnqueueDeviceGlobalVariableRead(*p->phQueue, *p->phProgram,
+                                                 *p->pname, *p->pblockingRead,
+                                                 *p->pcount, *p->poffset,
+                                                 *p->ppDst,
+                                                 *p->pnumEventsInWaitList,
+                                                 *p->pphEventWaitList,
+                                                 *p->pphEvent);
+    }
+    case UR_FUNCTION_EVENT_GET_INFO: {
+        auto p = (const struct ur_event_get_info_params_t *)params;
+        return urEventGetInfo(*p->phEvent, *p->ppropName, *p->ppropSize,
+                              *p->ppPropValue, *p->ppPropSizeRet);
+    }
+    case UR_FUNCTION_EVENT_GET_PROFILING_INFO: {
+        auto p = (const struct ur_event_get_profiling_info_params_t *)params;
+        return urEventGetProfilingInfo(*p->phEvent, *p->ppropName,
+                                       *p->ppropSize, *p->ppPropValue,
+                                       *p->ppPropSizeRet);
+    }
+    case UR_FUNCTION_EVENT_WAIT: {
+        auto p = (const struct ur_event_wait_params_t *)params;
+        return urEventWait(*p->pnumEvents, *p->pphEventWaitList);
+    }
+    case UR_FUNCTION_EVENT_RETAIN: {
+        auto p = (const struct ur_event_retain_params_t *)params;
+        return urEventRetain(*p->phEvent);
+    }
+    case UR_FUNCTION_EVENT_RELEASE: {
+        auto p = (const struct ur_event_release_params_t *)params;
+        return urEventRelease(*p->phEvent);
+    }
+    case UR_FUNCTION_EVENT_GET_NATIVE_HANDLE: {
+        auto p = (const struct ur_event_get_native_handle_params_t *)params;
+        return urEventGetNativeHandle(*p->phEvent, *p->pphNativeEvent);
+    }
+    case UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE: {
+        auto p =
+            (const struct ur_event_create_with_native_handle_params_t *)params;
+        return urEventCreateWithNativeHandle(*p->phNativeEvent, *p->phContext,
+                                             *p->pphEvent);
+    }
+    case UR_FUNCTION_EVENT_SET_CALLBACK: {
+        auto p = (const struct ur_event_set_callback_params_t *)params;
+        return urEventSetCallback(*p->phEvent, *p->pexecStatus, *p->ppfnNotify,
+                                  *p->ppUserData);
+    }
+    case UR_FUNCTION_KERNEL_CREATE: {
+        auto p = (const struct ur_kernel_create_params_t *)params;
+        return urKernelCreate(*p->phProgram, *p->ppKernelName, *p->pphKernel);
+    }
+    case UR_FUNCTION_KERNEL_GET_INFO: {
+        auto p = (const struct ur_kernel_get_info_params_t *)params;
+        return urKernelGetInfo(*p->phKernel, *p->ppropName, *p->ppropSize,
+                               *p->ppPropValue, *p->ppPropSizeRet);
+    }
+    case UR_FUNCTION_KERNEL_GET_GROUP_INFO: {
+        auto p = (const struct ur_kernel_get_group_info_params_t *)params;
+        return urKernelGetGroupInfo(*p->phKernel, *p->phDevice, *p->ppropName,
+                                    *p->ppropSize, *p->ppPropValue,
+                                    *p->ppPropSizeRet);
+    }
+    case UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO: {
+        auto p = (const struct ur_kernel_get_sub_group_info_params_t *)params;
+        return urKernelGetSubGroupInfo(*p->phKernel, *p->phDevice,
+                                       *p->ppropName, *p->ppropSize,
+                                       *p->ppPropValue, *p->ppPropSizeRet);
+    }
+    case UR_FUNCTION_KERNEL_RETAIN: {
+        auto p = (const struct ur_kernel_retain_params_t *)params;
+        return urKernelRetain(*p->phKernel);
+    }
+    case UR_FUNCTION_KERNEL_RELEASE: {
+        auto p = (const struct ur_kernel_release_params_t *)params;
+        return urKernelRelease(*p->phKernel);
+    }
+    case UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE: {
+        auto p = (const struct ur_kernel_get_native_handle_params_t *)params;
+        return urKernelGetNativeHandle(*p->phKernel, *p->pphNativeKernel);
+    }
+    case UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE: {
+        auto p =
+            (const struct ur_kernel_create_with_native_handle_params_t *)params;
+        return urKernelCreateWithNativeHandle(*p->phNativeKernel, *p->phContext,
+                                              *p->phProgram, *p->ppProperties,
+                                              *p->pphKernel);
+    }
+    case UR_FUNCTION_KERNEL_SET_ARG_VALUE: {
+        auto p = (const struct ur_kernel_set_arg_value_params_t *)params;
+        return urKernelSetArgValue(*p->phKernel, *p->pargIndex, *p->pargSize,
+                                   *p->ppArgValue);
+    }
+    case UR_FUNCTION_KERNEL_SET_ARG_LOCAL: {
+        auto p = (const struct ur_kernel_set_arg_local_params_t *)params;
+        return urKernelSetArgLocal(*p->phKernel, *p->pargIndex, *p->pargSize);
+    }
+    case UR_FUNCTION_KERNEL_SET_ARG_POINTER: {
+        auto p = (const struct ur_kernel_set_arg_pointer_params_t *)params;
+        return urKernelSetArgPointer(*p->phKernel, *p->pargIndex,
+                                     *p->ppArgValue);
+    }
+    case UR_FUNCTION_KERNEL_SET_EXEC_INFO: {
+        auto p = (const struct ur_kernel_set_exec_info_params_t *)params;
+        return urKernelSetExecInfo(*p->phKernel, *p->ppropName, *p->ppropSize,
+                                   *p->ppPropValue);
+    }
+    case UR_FUNCTION_KERNEL_SET_ARG_SAMPLER: {
+        auto p = (const struct ur_kernel_set_arg_sampler_params_t *)params;
+        return urKernelSetArgSampler(*p->phKernel, *p->pargIndex,
+                                     *p->phArgValue);
+    }
+    case UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ: {
+        auto p = (const struct ur_kernel_set_arg_mem_obj_params_t *)params;
+        return urKernelSetArgMemObj(*p->phKernel, *p->pargIndex,
+                                    *p->phArgValue);
+    }
+    case UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS: {
+        auto p =
+            (const struct ur_kernel_set_specialization_constants_params_t *)
+                params;
+        return urKernelSetSpecializationConstants(*p->phKernel, *p->pcount,
+                                                  *p->ppSpecConstants);
+    }
+    case UR_FUNCTION_MEM_IMAGE_CREATE: {
+        auto p = (const struct ur_mem_image_create_params_t *)params;
+        return urMemImageCreate(*p->phContext, *p->pflags, *p->ppImageFormat,
+                                *p->ppImageDesc, *p->ppHost, *p->pphMem);
+    }
+    case UR_FUNCTION_MEM_BUFFER_CREATE: {
+        auto p = (const struct ur_mem_buffer_create_params_t *)params;
+        return urMemBufferCreate(*p->phContext, *p->pflags, *p->psize,
+                                 *p->ppProperties, *p->pphBuffer);
+    }
+    case UR_FUNCTION_MEM_RETAIN: {
+        auto p = (const struct ur_mem_retain_params_t *)params;
+        return urMemRetain(*p->phMem);
+    }
+    case UR_FUNCTION_MEM_RELEASE: {
+        auto p = (const struct ur_mem_release_params_t *)params;
+        return urMemRelease(*p->phMem);
+    }
+    case UR_FUNCTION_MEM_BUFFER_PARTITION: {
+        auto p = (const struct ur_mem_buffer_partition_params_t *)params;
+        return urMemBufferPartition(*p->phBuffer, *p->pflags,
+                                    *p->pbufferCreateType, *p->ppRegion,
+                                    *p->pphMem);
+    }
+    case UR_FUNCTION_MEM_GET_NATIVE_HANDLE: {
+        auto p = (const struct ur_mem_get_native_handle_params_t *)params;
+        return urMemGetNativeHandle(*p->phMem, *p->pphNativeMem);
+    }
+    case UR_FUNCTION_MEM_CREATE_WITH_NATIVE_HANDLE: {
+        auto p =
+            (const struct ur_mem_create_with_native_handle_params_t *)params;
+        return urMemCreateWithNativeHandle(*p->phNativeMem, *p->phContext,
+                                           *p->pphMem);
+    }
+    case UR_FUNCTION_MEM_GET_INFO: {
+        auto p = (const struct ur_mem_get_info_params_t *)params;
+        return urMemGetInfo(*p->phMemory, *p->ppropName, *p->ppropSize,
+                            *p->ppPropValue, *p->ppPropSizeRet);
+    }
+    case UR_FUNCTION_MEM_IMAGE_GET_INFO: {
+        auto p = (const struct ur_mem_image_get_info_params_t *)params;
+        return urMemImageGetInfo(*p->phMemory, *p->ppropName, *p->ppropSize,
+                                 *p->ppPropValue, *p->ppPropSizeRet);
+    }
+    case UR_FUNCTION_PLATFORM_GET: {
+        auto p = (const struct ur_platform_get_params_t *)params;
+        return urPlatformGet(*p->pNumEntries, *p->pphPlatforms,
+                             *p->ppNumPlatforms);
+    }
+    case UR_FUNCTION_PLATFORM_GET_INFO: {
+        auto p = (const struct ur_platform_get_info_params_t *)params;
+        return urPlatformGetInfo(*p->phPlatform, *p->ppropName, *p->ppropSize,
+                                 *p->ppPropValue, *p->ppSizeRet);
+    }
+    case UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE: {
+        auto p = (const struct ur_platform_get_native_handle_params_t *)params;
+        return urPlatformGetNativeHandle(*p->phPlatform, *p->pphNativePlatform);
+    }
+    case UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE: {
+        auto p =
+            (const struct ur_platform_create_with_native_handle_params_t *)
+                params;
+        return urPlatformCreateWithNativeHandle(*p->phNativePlatform,
+                                                *p->pphPlatform);
+    }
+    case UR_FUNCTION_PLATFORM_GET_API_VERSION: {
+        auto p = (const struct ur_platform_get_api_version_params_t *)params;
+        return urPlatformGetApiVersion(*p->phDriver, *p->ppVersion);
+    }
+    case UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION: {
+        auto p = (const struct ur_platform_get_backend_option_params_t *)params;
+        return urPlatformGetBackendOption(*p->phPlatform, *p->ppFrontendOption,
+                                          *p->pppPlatformOption);
+    }
+    case UR_FUNCTION_PROGRAM_CREATE_WITH_IL: {
+        auto p = (const struct ur_program_create_with_il_params_t *)params;
+        return urProgramCreateWithIL(*p->phContext, *p->ppIL, *p->plength,
+                                     *p->ppProperties, *p->pphProgram);
+    }
+    case UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY: {
+        auto p = (const struct ur_program_create_with_binary_params_t *)params;
+        return urProgramCreateWithBinary(*p->phContext, *p->phDevice, *p->psize,
+                                         *p->ppBinary, *p->ppProperties,
+                                         *p->pphProgram);
+    }
+    case UR_FUNCTION_PROGRAM_BUILD: {
+        auto p = (const struct ur_program_build_params_t *)params;
+        return urProgramBuild(*p->phContext, *p->phProgram, *p->ppOptions);
+    }
+    case UR_FUNCTION_PROGRAM_COMPILE: {
+        auto p = (const struct ur_program_compile_params_t *)params;
+        return urProgramCompile(*p->phContext, *p->phProgram, *p->ppOptions);
+    }
+    case UR_FUNCTION_PROGRAM_LINK: {
+        auto p = (const struct ur_program_link_params_t *)params;
+        return urProgramLink(*p->phContext, *p->pcount, *p->pphPrograms,
+                             *p->ppOptions, *p->pphProgram);
+    }
+    case UR_FUNCTION_PROGRAM_RETAIN: {
+        auto p = (const struct ur_program_retain_params_t *)params;
+        return urProgramRetain(*p->phProgram);
+    }
+    case UR_FUNCTION_PROGRAM_RELEASE: {
+        auto p = (const struct ur_program_release_params_t *)params;
+        return urProgramRelease(*p->phProgram);
+    }
+    case UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER: {
+        auto p =
+            (const struct ur_program_get_function_pointer_params_t *)params;
+        return urProgramGetFunctionPointer(*p->phDevice, *p->phProgram,
+                                           *p->ppFunctionName,
+                                           *p->pppFunctionPointer);
+    }
+    case UR_FUNCTION_PROGRAM_GET_INFO: {
+        auto p = (const struct ur_program_get_info_params_t *)params;
+        return urProgramGetInfo(*p->phProgram, *p->ppropName, *p->ppropSize,
+                                *p->ppPropValue, *p->ppPropSizeRet);
+    }
+    case UR_FUNCTION_PROGRAM_GET_BUILD_INFO: {
+        auto p = (const struct ur_program_get_build_info_params_t *)params;
+        return urProgramGetBuildInfo(*p->phProgram, *p->phDevice, *p->ppropName,
+                                     *p->ppropSize, *p->ppPropValue,
+                                     *p->ppPropSizeRet);
+    }
+    case UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS: {
+        auto p =
+            (const struct ur_program_set_specialization_constants_params_t *)
+                params;
+        return urProgramSetSpecializationConstants(*p->phProgram, *p->pcount,
+                                                   *p->ppSpecConstants);
+    }
+    case UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE: {
+        auto p = (const struct ur_program_get_native_handle_params_t *)params;
+        return urProgramGetNativeHandle(*p->phProgram, *p->pphNativeProgram);
+    }
+    case UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE: {
+        auto p =
+            (const struct ur_program_create_with_native_handle_params_t *)
+                params;
+        return urProgramCreateWithNativeHandle(*p->phNativeProgram,
+                                               *p->phContext, *p->pphProgram);
+    }
+    case UR_FUNCTION_QUEUE_GET_INFO: {
+        auto p = (const struct ur_queue_get_info_params_t *)params;
+        return urQueueGetInfo(*p->phQueue, *p->ppropName, *p->ppropSize,
+                              *p->ppPropValue, *p->ppPropSizeRet);
+    }
+    case UR_FUNCTION_QUEUE_CREATE: {
+        auto p = (const struct ur_queue_create_params_t *)params;
+        return urQueueCreate(*p->phContext, *p->phDevice, *p->ppProperties,
+                             *p->pphQueue);
+    }
+    case UR_FUNCTION_QUEUE_RETAIN: {
+        auto p = (const struct ur_queue_retain_params_t *)params;
+        return urQueueRetain(*p->phQueue);
+    }
+    case UR_FUNCTION_QUEUE_RELEASE: {
+        auto p = (const struct ur_queue_release_params_t *)params;
+        return urQueueRelease(*p->phQueue);
+    }
+    case UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE: {
+        auto p = (const struct ur_queue_get_native_handle_params_t *)params;
+        return urQueueGetNativeHandle(*p->phQueue, *p->pphNativeQueue);
+    }
+    case UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE: {
+        auto p =
+            (const struct ur_queue_create_with_native_handle_params_t *)params;
+        return urQueueCreateWithNativeHandle(*p->phNativeQueue, *p->phContext,
+                                             *p->pphQueue);
+    }
+    case UR_FUNCTION_QUEUE_FINISH: {
+        auto p = (const struct ur_queue_finish_params_t *)params;
+        return urQueueFinish(*p->phQueue);
+    }
+    case UR_FUNCTION_QUEUE_FLUSH: {
+        auto p = (const struct ur_queue_flush_params_t *)params;
+        return urQueueFlush(*p->phQueue);
+    }
+    case UR_FUNCTION_SAMPLER_CREATE: {
+        auto p = (const struct ur_sampler_create_params_t *)params;
+        return urSamplerCreate(*p->phContext, *p->ppDesc, *p->pphSampler);
+    }
+    case UR_FUNCTION_SAMPLER_RETAIN: {
+        auto p = (const struct ur_sampler_retain_params_t *)params;
+        return urSamplerRetain(*p->phSampler);
+    }
+    case UR_FUNCTION_SAMPLER_RELEASE: {
+        auto p = (const struct ur_sampler_release_params_t *)params;
+        return urSamplerRelease(*p->phSampler);
+    }
+    case UR_FUNCTION_SAMPLER_GET_INFO: {
+        auto p = (const struct ur_sampler_get_info_params_t *)params;
+        return urSamplerGetInfo(*p->phSampler, *p->ppropName, *p->ppropSize,
+                                *p->ppPropValue, *p->ppPropSizeRet);
+    }
+    case UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE: {
+        auto p = (const struct ur_sampler_get_native_handle_params_t *)params;
+        return urSamplerGetNativeHandle(*p->phSampler, *p->pphNativeSampler);
+    }
+    case UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE: {
+        auto p =
+            (const struct ur_sampler_create_with_native_handle_params_t *)
+                params;
+        return urSamplerCreateWithNativeHandle(*p->phNativeSampler,
+                                               *p->phContext, *p->pphSampler);
+    }
+    case UR_FUNCTION_USM_HOST_ALLOC: {
+        auto p = (const struct ur_usm_host_alloc_params_t *)params;
+        return urUSMHostAlloc(*p->phContext, *p->ppUSMDesc, *p->ppool,
+                              *p->psize, *p->pppMem);
+    }
+    case UR_FUNCTION_USM_DEVICE_ALLOC: {
+        auto p = (const struct ur_usm_device_alloc_params_t *)params;
+        return urUSMDeviceAlloc(*p->phContext, *p->phDevice, *p->ppUSMDesc,
+                                *p->ppool, *p->psize, *p->pppMem);
+    }
+    case UR_FUNCTION_USM_SHARED_ALLOC: {
+        auto p = (const struct ur_usm_shared_alloc_params_t *)params;
+        return urUSMSharedAlloc(*p->phContext, *p->phDevice, *p->ppUSMDesc,
+                                *p->ppool, *p->psize, *p->pppMem);
+    }
+    case UR_FUNCTION_USM_FREE: {
+        auto p = (const struct ur_usm_free_params_t *)params;
+        return urUSMFree(*p->phContext, *p->ppMem);
+    }
+    case UR_FUNCTION_USM_GET_MEM_ALLOC_INFO: {
+        auto p = (const struct ur_usm_get_mem_alloc_info_params_t *)params;
+        return urUSMGetMemAllocInfo(*p->phContext, *p->ppMem, *p->ppropName,
+                                    *p->ppropSize, *p->ppPropValue,
+                                    *p->ppPropSizeRet);
+    }
+    case UR_FUNCTION_USM_POOL_CREATE: {
+        auto p = (const struct ur_usm_pool_create_params_t *)params;
+        return urUSMPoolCreate(*p->phContext, *p->ppPoolDesc, *p->pppPool);
+    }
+    case UR_FUNCTION_USM_POOL_DESTROY: {
+        auto p = (const struct ur_usm_pool_destroy_params_t *)params;
+        return urUSMPoolDestroy(*p->phContext, *p->ppPool);
+    }
+    case UR_FUNCTION_DEVICE_GET: {
+        auto p = (const struct ur_device_get_params_t *)params;
+        return urDeviceGet(*p->phPlatform, *p->pDeviceType, *p->pNumEntries,
+                           *p->pphDevices, *p->ppNumDevices);
+    }
+    case UR_FUNCTION_DEVICE_GET_INFO: {
+        auto p = (const struct ur_device_get_info_params_t *)params;
+        return urDeviceGetInfo(*p->phDevice, *p->ppropName, *p->ppropSize,
+                               *p->ppPropValue, *p->ppPropSizeRet);
+    }
+    case UR_FUNCTION_DEVICE_RETAIN: {
+        auto p = (const struct ur_device_retain_params_t *)params;
+        return urDeviceRetain(*p->phDevice);
+    }
+    case UR_FUNCTION_DEVICE_RELEASE: {
+        auto p = (const struct ur_device_release_params_t *)params;
+        return urDeviceRelease(*p->phDevice);
+    }
+    case UR_FUNCTION_DEVICE_PARTITION: {
+        auto p = (const struct ur_device_partition_params_t *)params;
+        return urDevicePartition(*p->phDevice, *p->ppProperties,
+                                 *p->pNumDevices, *p->pphSubDevices,
+                                 *p->ppNumDevicesRet);
+    }
+    case UR_FUNCTION_DEVICE_SELECT_BINARY: {
+        auto p = (const struct ur_device_select_binary_params_t *)params;
+        return urDeviceSelectBinary(*p->phDevice, *p->ppBinaries,
+                                    *p->pNumBinaries, *p->ppSelectedBinary);
+    }
+    case UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE: {
+        auto p = (const struct ur_device_get_native_handle_params_t *)params;
+        return urDeviceGetNativeHandle(*p->phDevice, *p->pphNativeDevice);
+    }
+    case UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE: {
+        auto p =
+            (const struct ur_device_create_with_native_handle_params_t *)params;
+        return urDeviceCreateWithNativeHandle(*p->phNativeDevice,
+                                              *p->phPlatform, *p->pphDevice);
+    }
+    case UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS: {
+        auto p =
+            (const struct ur_device_get_global_timestamps_params_t *)params;
+        return urDeviceGetGlobalTimestamps(*p->phDevice, *p->ppDeviceTimestamp,
+                                           *p->ppHostTimestamp);
+    }
+    default:
+        return UR_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+}
 } // namespace ur_params
 
 #endif /* UR_PARAMS_HPP */
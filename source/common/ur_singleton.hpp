@@ -9,23 +9,116 @@
 #ifndef UR_SINGLETON_H
 #define UR_SINGLETON_H 1
 
+#include <array>
+#include <atomic>
 #include <memory>
 #include <mutex>
+#include <new>
+#include <shared_mutex>
 #include <unordered_map>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////
+/// a pool of objects carved out of larger slabs
+/// destroyed objects leave their storage on a free list for reuse, so that
+/// objects created and destroyed at a high rate do not hit the allocator
+/// the pool is not thread-safe, callers must serialize the access
+template <typename object_tn, size_t slab_size = 64> class slab_pool_t {
+    union slot_t {
+        slot_t *next; ///< next free slot
+        alignas(object_tn) unsigned char storage[sizeof(object_tn)];
+    };
+
+    std::vector<std::unique_ptr<slot_t[]>> slabs;
+    slot_t *free_list = nullptr;
+
+  public:
+    slab_pool_t() = default;
+    slab_pool_t(const slab_pool_t &) = delete;
+    slab_pool_t &operator=(const slab_pool_t &) = delete;
+
+    //////////////////////////////////////////////////////////////////////////
+    /// constructs a new object in a free slot
+    /// the params are forwarded to the ctor of the object
+    template <typename... Ts> object_tn *create(Ts &&...params) {
+        if (nullptr == free_list) {
+            auto slab = std::make_unique<slot_t[]>(slab_size);
+            for (size_t i = 0; i < slab_size; ++i) {
+                slab[i].next = free_list;
+                free_list = &slab[i];
+            }
+            slabs.emplace_back(std::move(slab));
+        }
+
+        auto slot = free_list;
+        free_list = slot->next;
+        try {
+            return new (slot->storage) object_tn(std::forward<Ts>(params)...);
+        } catch (...) {
+            slot->next = free_list;
+            free_list = slot;
+            throw;
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// destroys an object created by this pool and recycles its slot
+    void destroy(object_tn *object) {
+        object->~object_tn();
+        auto slot = reinterpret_cast<slot_t *>(object);
+        slot->next = free_list;
+        free_list = slot;
+    }
+};
 
 //////////////////////////////////////////////////////////////////////////
 /// a abstract factory for creation of singleton objects
+///
+/// the instances are spread over a fixed number of independently locked
+/// shards, so that threads working on different handles do not contend,
+/// and lookups of existing instances only take a shared lock
+///
+/// the instances of the objects the callers own are reference counted,
+/// acquire and retain take a reference, release drops one and destroys the
+/// instance with the last one; the instances only ever looked up through
+/// getInstance hold no reference, retain and release leave them alone
+///
+/// the instances are allocated from per-shard slab pools, the pointer
+/// to an instance remains stable for its whole lifetime
 template <typename singleton_tn, typename key_tn> class singleton_factory_t {
   protected:
     using singleton_t = singleton_tn;
     using key_t = typename std::conditional<std::is_pointer<key_tn>::value,
                                             size_t, key_tn>::type;
 
-    using ptr_t = std::unique_ptr<singleton_t>;
-    using map_t = std::unordered_map<key_t, ptr_t>;
+    using ptr_t = singleton_t *;
+    using pool_t = slab_pool_t<singleton_t>;
+
+    struct entry_t {
+        ptr_t ptr = nullptr;              ///< the instance
+        std::atomic<size_t> refCount = 0; ///< references held by the callers,
+                                          ///< 0 for the ones never acquired
+    };
+
+    using map_t = std::unordered_map<key_t, entry_t>;
 
-    std::mutex mut; ///< lock for thread-safety
-    map_t map;      ///< single instance of singleton for each unique key
+    /// number of shards, must be a power of two
+    static constexpr size_t shard_count = 64;
+
+    /// each shard lives on its own cache line(s) to avoid false sharing
+    struct alignas(64) shard_t {
+        std::shared_mutex mut; ///< lock for thread-safety of this shard
+        map_t map;             ///< instances whose key hashes to this shard
+        pool_t pool;           ///< storage of the instances in this shard
+
+        ~shard_t() {
+            for (auto &entry : map) {
+                pool.destroy(entry.second.ptr);
+            }
+        }
+    };
+
+    std::array<shard_t, shard_count> shards;
 
     //////////////////////////////////////////////////////////////////////////
     /// extract the key from parameter list and if necessary, convert type
@@ -33,6 +126,16 @@ template <typename singleton_tn, typename key_tn> class singleton_factory_t {
         return reinterpret_cast<key_t>(key);
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    /// select the shard owning the key
+    /// handles are usually aligned addresses, so the low bits carry little
+    /// entropy and are folded together with the higher ones
+    shard_t &getShard(key_t key) {
+        size_t hash = std::hash<key_t>{}(key);
+        hash ^= (hash >> 4) ^ (hash >> 12) ^ (hash >> 20);
+        return shards[hash & (shard_count - 1)];
+    }
+
   public:
     //////////////////////////////////////////////////////////////////////////
     /// default ctor/dtor
@@ -45,28 +148,82 @@ template <typename singleton_tn, typename key_tn> class singleton_factory_t {
     /// the params are forwarded to the ctor of the singleton
     /// the first parameter must be the unique identifier of the instance
     template <typename... Ts> singleton_tn *getInstance(Ts &&...params) {
+        return getOrCreate(false, std::forward<Ts>(params)...);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// same as getInstance, but also takes a reference, for the objects the
+    /// caller owns
+    template <typename... Ts> singleton_tn *acquire(Ts &&...params) {
+        return getOrCreate(true, std::forward<Ts>(params)...);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// takes an additional reference on an existing singleton
+    void retain(key_tn key) {
+        auto &shard = getShard(getKey(key));
+        std::shared_lock<std::shared_mutex> lk(shard.mut);
+        auto iter = shard.map.find(getKey(key));
+        // the count only drops to 0 under the exclusive lock
+        if (shard.map.end() != iter && 0 != iter->second.refCount) {
+            ++iter->second.refCount;
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// drops a reference, once the key is no longer referenced (valid),
+    /// release the singleton
+    void release(key_tn key) {
+        auto &shard = getShard(getKey(key));
+        std::unique_lock<std::shared_mutex> lk(shard.mut);
+        auto iter = shard.map.find(getKey(key));
+        if (shard.map.end() != iter && 0 != iter->second.refCount &&
+            --iter->second.refCount == 0) {
+            shard.pool.destroy(iter->second.ptr);
+            shard.map.erase(iter);
+        }
+    }
+
+  private:
+    template <typename... Ts>
+    singleton_tn *getOrCreate(bool reference, Ts &&...params) {
         auto key = getKey(std::forward<Ts>(params)...);
 
         if (key == 0) { // No zero keys allowed in map
             return static_cast<singleton_tn *>(0);
         }
 
-        std::lock_guard<std::mutex> lk(mut);
-        auto iter = map.find(key);
+        auto &shard = getShard(key);
 
-        if (map.end() == iter) {
-            auto ptr =
-                std::make_unique<singleton_t>(std::forward<Ts>(params)...);
-            iter = map.emplace(key, std::move(ptr)).first;
+        {
+            // fast path, the instance already exists
+            std::shared_lock<std::shared_mutex> lk(shard.mut);
+            auto iter = shard.map.find(key);
+            if (shard.map.end() != iter) {
+                if (reference) {
+                    ++iter->second.refCount;
+                }
+                return iter->second.ptr;
+            }
         }
-        return iter->second.get();
-    }
 
-    //////////////////////////////////////////////////////////////////////////
-    /// once the key is no longer valid, release the singleton
-    void release(key_tn key) {
-        std::lock_guard<std::mutex> lk(mut);
-        map.erase(getKey(key));
+        std::unique_lock<std::shared_mutex> lk(shard.mut);
+        auto iter = shard.map.find(key);
+
+        if (shard.map.end() == iter) {
+            auto ptr = shard.pool.create(std::forward<Ts>(params)...);
+            try {
+                iter = shard.map.try_emplace(key).first;
+            } catch (...) {
+                shard.pool.destroy(ptr);
+                throw;
+            }
+            iter->second.ptr = ptr;
+        }
+        if (reference) {
+            ++iter->second.refCount;
+        }
+        return iter->second.ptr;
     }
 };
 
@@ -11,6 +11,7 @@
 
 #include <iostream>
 #include <map>
+#include <memory>
 #include <optional>
 #include <sstream>
 #include <string.h>
@@ -70,6 +71,28 @@ inline std::string create_library_path(const char *name, const char *path) {
 #define __urdlllocal
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Array with a size known only at run time, which is kept in inline
+///        storage when it is small enough and allocated on the heap otherwise
+/// @tparam T trivially constructible element type
+/// @tparam inline_size number of elements stored inline
+template <typename T, size_t inline_size = 16> class small_array_t {
+  public:
+    explicit small_array_t(size_t size)
+        : heap(size > inline_size ? new T[size] : nullptr) {}
+
+    small_array_t(const small_array_t &) = delete;
+    small_array_t &operator=(const small_array_t &) = delete;
+
+    T *data() noexcept { return heap ? heap.get() : storage; }
+
+    T &operator[](size_t i) noexcept { return data()[i]; }
+
+  private:
+    T storage[inline_size];
+    std::unique_ptr<T[]> heap;
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 inline std::optional<std::string> ur_getenv(const char *name) {
 #if defined(_WIN32)
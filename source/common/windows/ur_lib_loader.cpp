@@ -31,4 +31,13 @@ void *LibLoader::getFunctionPtr(HMODULE handle, const char *func_name) {
     return GetProcAddress(handle, func_name);
 }
 
+std::string LibLoader::getLibraryPath(HMODULE handle) {
+    char path[MAX_PATH];
+    DWORD length = GetModuleFileNameA(handle, path, MAX_PATH);
+    if (0 == length || MAX_PATH == length) {
+        return std::string();
+    }
+    return std::string(path, length);
+}
+
 } // namespace ur_loader
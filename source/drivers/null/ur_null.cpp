@@ -9,6 +9,8 @@
  */
 #include "ur_null.hpp"
 
+#include <cstdlib>
+
 namespace driver {
 //////////////////////////////////////////////////////////////////////////
 context_t d_context;
@@ -140,5 +142,98 @@ context_t::context_t() {
             }
             return UR_RESULT_SUCCESS;
         };
+
+    //////////////////////////////////////////////////////////////////////////
+    urDdiTable.Event.pfnGetProfilingInfo =
+        [](ur_event_handle_t hEvent, ur_profiling_info_t propName,
+           size_t propSize, void *pPropValue, size_t *pPropSizeRet) {
+            if (hEvent == nullptr) {
+                return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+            }
+
+            // synthetic timestamps: every command is queued at a time
+            // derived from its event, submitted 100ns later, and runs for
+            // 1us once it starts 500ns after being queued
+            uint64_t queued = reinterpret_cast<uintptr_t>(hEvent) * 1000;
+            uint64_t value = 0;
+            switch (propName) {
+            case UR_PROFILING_INFO_COMMAND_QUEUED:
+                value = queued;
+                break;
+            case UR_PROFILING_INFO_COMMAND_SUBMIT:
+                value = queued + 100;
+                break;
+            case UR_PROFILING_INFO_COMMAND_START:
+                value = queued + 500;
+                break;
+            case UR_PROFILING_INFO_COMMAND_END:
+                value = queued + 1500;
+                break;
+            default:
+                return UR_RESULT_ERROR_INVALID_ENUMERATION;
+            }
+
+            if (pPropValue && propSize != sizeof(uint64_t)) {
+                return UR_RESULT_ERROR_INVALID_SIZE;
+            }
+            if (pPropValue != nullptr) {
+                *reinterpret_cast<uint64_t *>(pPropValue) = value;
+            }
+            if (pPropSizeRet != nullptr) {
+                *pPropSizeRet = sizeof(uint64_t);
+            }
+            return UR_RESULT_SUCCESS;
+        };
+
+    //////////////////////////////////////////////////////////////////////////
+    urDdiTable.Event.pfnSetCallback =
+        [](ur_event_handle_t hEvent, ur_execution_info_t execStatus,
+           ur_event_callback_t pfnNotify, void *pUserData) {
+            if (hEvent == nullptr) {
+                return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+            }
+            if (pfnNotify == nullptr) {
+                return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+            }
+            // the commands of the null driver complete as soon as they are
+            // enqueued, so the callback runs right away
+            pfnNotify(hEvent, execStatus, pUserData);
+            return UR_RESULT_SUCCESS;
+        };
+
+    //////////////////////////////////////////////////////////////////////////
+    // USM allocations are backed by host memory, so that the programs using
+    // the null driver can access them
+    urDdiTable.USM.pfnHostAlloc =
+        [](ur_context_handle_t, const ur_usm_desc_t *, ur_usm_pool_handle_t,
+           size_t size, void **ppMem) {
+            if (ppMem == nullptr) {
+                return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+            }
+            *ppMem = malloc(size);
+            return *ppMem ? UR_RESULT_SUCCESS
+                          : UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+        };
+
+    urDdiTable.USM.pfnDeviceAlloc =
+        [](ur_context_handle_t hContext, ur_device_handle_t,
+           const ur_usm_desc_t *pUSMDesc, ur_usm_pool_handle_t pool,
+           size_t size, void **ppMem) {
+            return d_context.urDdiTable.USM.pfnHostAlloc(hContext, pUSMDesc,
+                                                         pool, size, ppMem);
+        };
+
+    urDdiTable.USM.pfnSharedAlloc =
+        [](ur_context_handle_t hContext, ur_device_handle_t,
+           const ur_usm_desc_t *pUSMDesc, ur_usm_pool_handle_t pool,
+           size_t size, void **ppMem) {
+            return d_context.urDdiTable.USM.pfnHostAlloc(hContext, pUSMDesc,
+                                                         pool, size, ppMem);
+        };
+
+    urDdiTable.USM.pfnFree = [](ur_context_handle_t, void *pMem) {
+        free(pMem);
+        return UR_RESULT_SUCCESS;
+    };
 }
 } // namespace driver
@@ -0,0 +1,182 @@
+/*
+ *
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file ur_binary_trace.cpp
+ *
+ */
+#include "ur_binary_trace.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define UR_BINARY_TRACE_TSC 1
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#define UR_BINARY_TRACE_TSC 1
+#endif
+
+namespace ur_tracing_layer {
+
+/// how often the writer thread drains the rings
+constexpr auto DRAIN_PERIOD = std::chrono::milliseconds(1);
+
+static uint64_t steady_clock_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+uint64_t binary_trace_t::timestamp() {
+#ifdef UR_BINARY_TRACE_TSC
+    return __rdtsc();
+#else
+    return steady_clock_ns();
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+binary_trace_t::~binary_trace_t() { stop(); }
+
+bool binary_trace_t::start(const std::string &path) {
+    std::scoped_lock<std::mutex> lock(rings_mut);
+    if (nullptr != file) {
+        return false;
+    }
+
+    file = fopen(path.c_str(), "wb");
+    if (nullptr == file) {
+        return false;
+    }
+
+    binary_file_header_t header = {};
+    std::memcpy(header.magic, "URBTRACE", sizeof(header.magic));
+    header.version = 1;
+    header.record_size = sizeof(binary_record_t);
+    header.timestamp = timestamp();
+    header.clock_ns = steady_clock_ns();
+    if (fwrite(&header, sizeof(header), 1, file) != 1) {
+        fclose(file);
+        file = nullptr;
+        return false;
+    }
+
+    // the rings of a previous session are still referenced by their threads,
+    // which pick new ones once they see the new session
+    rings.clear();
+    static std::atomic<uint64_t> next_session = 1;
+    session = next_session++;
+
+    stopping = false;
+    writer = std::thread([this] { write_loop(); });
+    active = true;
+    return true;
+}
+
+void binary_trace_t::stop() {
+    if (!active.exchange(false)) {
+        return;
+    }
+
+    stopping = true;
+    writer.join();
+
+    // the records written while the writer was stopping
+    drain();
+
+    std::scoped_lock<std::mutex> lock(rings_mut);
+    binary_file_trailer_t trailer = {};
+    trailer.timestamp = timestamp();
+    trailer.clock_ns = steady_clock_ns();
+    for (auto &ring : rings) {
+        trailer.dropped += ring->dropped.load(std::memory_order_relaxed);
+    }
+
+    binary_block_header_t block = {BINARY_BLOCK_TRAILER, 0};
+    fwrite(&block, sizeof(block), 1, file);
+    fwrite(&trailer, sizeof(trailer), 1, file);
+    fclose(file);
+    file = nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void binary_trace_t::ring_owner_t::release() {
+    if (nullptr != ring) {
+        ring->owned.store(false, std::memory_order_release);
+        ring.reset();
+    }
+}
+
+std::shared_ptr<binary_trace_t::ring_t> binary_trace_t::acquire_ring() {
+    std::scoped_lock<std::mutex> lock(rings_mut);
+
+    // reuse the ring of an exited thread once all its records are written,
+    // so that short-lived threads do not grow the list
+    std::shared_ptr<ring_t> ring;
+    for (auto &candidate : rings) {
+        if (!candidate->owned.load(std::memory_order_acquire) &&
+            candidate->head.load(std::memory_order_relaxed) ==
+                candidate->tail.load(std::memory_order_relaxed)) {
+            ring = candidate;
+            break;
+        }
+    }
+
+    if (nullptr == ring) {
+        try {
+            ring = rings.emplace_back(std::make_shared<ring_t>());
+        } catch (...) {
+            return nullptr;
+        }
+    }
+
+    ring->thread = next_thread++;
+    ring->owned.store(true, std::memory_order_relaxed);
+    return ring;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// writes the pending records of all rings to the file, returns whether
+/// there were any
+bool binary_trace_t::drain() {
+    std::scoped_lock<std::mutex> lock(rings_mut);
+
+    bool written = false;
+    for (auto &ring : rings) {
+        auto tail = ring->tail.load(std::memory_order_relaxed);
+        auto head = ring->head.load(std::memory_order_acquire);
+        if (head == tail) {
+            continue;
+        }
+
+        binary_block_header_t block = {ring->thread,
+                                       static_cast<uint32_t>(head - tail)};
+        fwrite(&block, sizeof(block), 1, file);
+
+        // the pending records wrap around the end of the ring at most once
+        auto first = tail & (ring_t::capacity - 1);
+        auto count = std::min<size_t>(head - tail, ring_t::capacity - first);
+        fwrite(&ring->records[first], sizeof(binary_record_t), count, file);
+        fwrite(&ring->records[0], sizeof(binary_record_t),
+               head - tail - count, file);
+
+        ring->tail.store(head, std::memory_order_release);
+        written = true;
+    }
+    return written;
+}
+
+void binary_trace_t::write_loop() {
+    while (!stopping.load(std::memory_order_relaxed)) {
+        if (!drain()) {
+            std::this_thread::sleep_for(DRAIN_PERIOD);
+        }
+    }
+}
+
+} // namespace ur_tracing_layer
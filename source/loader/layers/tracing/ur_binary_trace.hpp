@@ -0,0 +1,183 @@
+/*
+ *
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file ur_binary_trace.hpp
+ *
+ */
+
+#ifndef UR_BINARY_TRACE_H
+#define UR_BINARY_TRACE_H 1
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ur_tracing_layer {
+
+///////////////////////////////////////////////////////////////////////////////
+/// kind of a binary trace record
+enum binary_record_type_t : uint16_t {
+    BINARY_RECORD_BEGIN = 0, ///< a call was entered
+    BINARY_RECORD_END = 1,   ///< a call returned
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// fixed-size record of a trace point, as stored in the trace file
+struct binary_record_t {
+    uint64_t timestamp;   ///< TSC on x86, steady clock nanoseconds elsewhere
+    uint64_t instance;    ///< same for the begin and end record of a call
+    uint64_t handle;      ///< first handle argument of the call, or 0
+    int32_t result;       ///< result of the call, 0 for begin records
+    uint16_t function_id; ///< ur_function_t of the call
+    uint16_t type;        ///< binary_record_type_t
+};
+static_assert(sizeof(binary_record_t) == 32,
+              "binary trace records must stay 32 bytes");
+
+///////////////////////////////////////////////////////////////////////////////
+/// layout of the trace file
+///
+/// the file starts with a binary_file_header_t, followed by blocks of
+/// records, each block is a binary_block_header_t and `count` records of a
+/// single thread, in the order they were written by that thread
+///
+/// the last block has the thread BINARY_BLOCK_TRAILER and no records, it is
+/// followed by a binary_file_trailer_t, the two clock samples of the header
+/// and the trailer allow converting the timestamps to nanoseconds
+struct binary_file_header_t {
+    char magic[8];        ///< "URBTRACE"
+    uint32_t version;     ///< 1
+    uint32_t record_size; ///< sizeof(binary_record_t)
+    uint64_t timestamp;   ///< timestamp when the trace started
+    uint64_t clock_ns;    ///< steady clock when the trace started
+};
+
+struct binary_block_header_t {
+    uint32_t thread; ///< index of the thread that wrote the records
+    uint32_t count;  ///< number of records that follow
+};
+
+struct binary_file_trailer_t {
+    uint64_t timestamp; ///< timestamp when the trace stopped
+    uint64_t clock_ns;  ///< steady clock when the trace stopped
+    uint64_t dropped;   ///< records lost because a buffer was full
+};
+
+constexpr uint32_t BINARY_BLOCK_TRAILER = UINT32_MAX;
+
+///////////////////////////////////////////////////////////////////////////////
+/// always-on binary tracing backend
+///
+/// every thread writes its records into its own single-producer,
+/// single-consumer ring buffer, without locks and without formatting,
+/// a background thread drains the rings into the trace file
+///
+/// when a ring is full the record is dropped and counted, the calling
+/// thread is never blocked
+class binary_trace_t {
+  public:
+    binary_trace_t() = default;
+    binary_trace_t(const binary_trace_t &) = delete;
+    binary_trace_t &operator=(const binary_trace_t &) = delete;
+    ~binary_trace_t();
+
+    /// opens the trace file and starts the writer thread
+    bool start(const std::string &path);
+
+    /// drains the remaining records, completes the file and closes it
+    void stop();
+
+    bool is_active() const noexcept {
+        return active.load(std::memory_order_relaxed);
+    }
+
+    /// writes a record into the ring of the calling thread, timestamped now
+    /// unless a time taken earlier with timestamp() is given
+    void record(binary_record_type_t type, uint32_t function_id,
+                uint64_t instance, uint64_t handle, int32_t result,
+                uint64_t time = timestamp()) {
+        auto ring = get_ring();
+        if (nullptr == ring) {
+            return;
+        }
+
+        auto head = ring->head.load(std::memory_order_relaxed);
+        if (head - ring->tail.load(std::memory_order_acquire) >=
+            ring_t::capacity) {
+            ring->dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        auto &rec = ring->records[head & (ring_t::capacity - 1)];
+        rec.timestamp = time;
+        rec.instance = instance;
+        rec.handle = handle;
+        rec.result = result;
+        rec.function_id = static_cast<uint16_t>(function_id);
+        rec.type = type;
+        ring->head.store(head + 1, std::memory_order_release);
+    }
+
+    /// current value of the clock used for the records
+    static uint64_t timestamp();
+
+  private:
+    struct ring_t {
+        /// number of records, must be a power of two
+        static constexpr size_t capacity = 4096;
+
+        alignas(64) std::atomic<size_t> head = 0; ///< advanced by the owner
+        alignas(64) std::atomic<size_t> tail = 0; ///< advanced by the writer
+        std::atomic<uint64_t> dropped = 0;
+        std::atomic<bool> owned = false; ///< a live thread writes into it
+        uint32_t thread = 0;
+        binary_record_t records[capacity];
+    };
+
+    /// the ring a thread writes into, shared with the trace so that neither
+    /// outlives the other's use of it, released when the thread exits
+    struct ring_owner_t {
+        std::shared_ptr<ring_t> ring;
+        uint64_t session = 0;
+        ~ring_owner_t() { release(); }
+        void release();
+    };
+
+    ring_t *get_ring() {
+        thread_local ring_owner_t owner;
+        if (owner.session != session.load(std::memory_order_relaxed)) {
+            if (!is_active()) {
+                return nullptr;
+            }
+            owner.release();
+            owner.ring = acquire_ring();
+            owner.session = session.load(std::memory_order_relaxed);
+        }
+        return owner.ring.get();
+    }
+
+    std::shared_ptr<ring_t> acquire_ring();
+    bool drain();
+    void write_loop();
+
+    std::atomic<bool> active = false;
+    std::atomic<bool> stopping = false;
+    std::atomic<uint64_t> session = 0; ///< identifies the current start()
+    std::mutex rings_mut; ///< guards the list of rings and the file
+    std::vector<std::shared_ptr<ring_t>> rings;
+    uint32_t next_thread = 0;
+    FILE *file = nullptr;
+    std::thread writer;
+};
+
+} // namespace ur_tracing_layer
+
+#endif /* UR_BINARY_TRACE_H */
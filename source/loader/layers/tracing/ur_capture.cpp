@@ -0,0 +1,263 @@
+/*
+ *
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file ur_capture.cpp
+ *
+ */
+#include "ur_capture.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+namespace ur_tracing_layer {
+
+using ur_params::capture_param_t;
+using ur_params::param_kind_t;
+
+/// value of a pointer, handle or function pointer argument
+static uintptr_t pointer_value(const void *arg) {
+    uintptr_t value = 0;
+    std::memcpy(&value, arg, sizeof(value));
+    return value;
+}
+
+/// number of elements of an array argument, 1 if it has no count
+static uint64_t get_count(const capture_param_t *descs, int32_t index,
+                          void *const *args) {
+    if (index < 0) {
+        return 1;
+    }
+
+    switch (descs[index].size) {
+    case sizeof(uint32_t): {
+        uint32_t count = 0;
+        std::memcpy(&count, args[index], sizeof(count));
+        return count;
+    }
+    case sizeof(uint64_t): {
+        uint64_t count = 0;
+        std::memcpy(&count, args[index], sizeof(count));
+        return count;
+    }
+    default:
+        return 0;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+capture_t::~capture_t() { stop(); }
+
+bool capture_t::start(const std::string &path) {
+    std::scoped_lock<std::mutex> lock(mut);
+    if (nullptr != file) {
+        return false;
+    }
+
+    file = fopen(path.c_str(), "wb");
+    if (nullptr == file) {
+        return false;
+    }
+
+    capture_file_header_t header = {};
+    std::memcpy(header.magic, "URCAPTUR", sizeof(header.magic));
+    header.version = 1;
+    if (fwrite(&header, sizeof(header), 1, file) != 1) {
+        fclose(file);
+        file = nullptr;
+        return false;
+    }
+
+    allocations.clear();
+    active = true;
+    return true;
+}
+
+void capture_t::stop() {
+    std::scoped_lock<std::mutex> lock(mut);
+    active = false;
+    if (nullptr != file) {
+        fclose(file);
+        file = nullptr;
+    }
+}
+
+void capture_t::put(const void *data, size_t size) {
+    auto bytes = static_cast<const uint8_t *>(data);
+    buffer.insert(buffer.end(), bytes, bytes + size);
+}
+
+void capture_t::record(uint32_t function, const void *params,
+                       ur_result_t result) {
+    size_t count = 0;
+    auto descs = ur_params::getCaptureParams(function, &count);
+    if (nullptr == descs) {
+        return;
+    }
+    // every member of a params struct points to an argument
+    auto args = static_cast<void *const *>(params);
+
+    std::scoped_lock<std::mutex> lock(mut);
+    if (nullptr == file) {
+        return;
+    }
+
+    buffer.clear();
+    uint32_t flags = 0;
+    for (size_t i = 0; i < count; ++i) {
+        encode(descs, i, args, flags);
+    }
+    if (buffer.size() > UINT32_MAX) {
+        buffer.clear();
+        flags |= CAPTURE_RECORD_INCOMPLETE;
+    }
+
+    capture_record_t record = {function, result, flags,
+                               static_cast<uint32_t>(buffer.size())};
+    fwrite(&record, sizeof(record), 1, file);
+    fwrite(buffer.data(), 1, buffer.size(), file);
+
+    if (result == UR_RESULT_SUCCESS) {
+        track_allocations(function, params, descs, count);
+    }
+}
+
+void capture_t::encode(const capture_param_t *descs, size_t index,
+                       void *const *args, uint32_t &flags) {
+    const auto &desc = descs[index];
+    const void *arg = args[index];
+    auto ptr = reinterpret_cast<const void *>(pointer_value(arg));
+
+    switch (desc.kind) {
+    case param_kind_t::value:
+        put(arg, desc.size);
+        break;
+    case param_kind_t::handle:
+        put<uint64_t>(pointer_value(arg));
+        break;
+    case param_kind_t::handle_array:
+    case param_kind_t::handle_out: {
+        if (nullptr == ptr) {
+            put(CAPTURE_NULL);
+            break;
+        }
+        auto handles = static_cast<const uintptr_t *>(ptr);
+        uint64_t count = get_count(descs, desc.count, args);
+        put(count);
+        for (uint64_t i = 0; i < count; ++i) {
+            put<uint64_t>(handles[i]);
+        }
+    } break;
+    case param_kind_t::data:
+    case param_kind_t::desc: {
+        if (nullptr == ptr) {
+            put(CAPTURE_NULL);
+            break;
+        }
+        uint64_t count = get_count(descs, desc.count, args);
+        put(count);
+        size_t offset = buffer.size();
+        put(ptr, count * desc.size);
+        if (desc.kind == param_kind_t::desc) {
+            // the extension structs are not captured
+            for (uint64_t i = 0; i < count; ++i) {
+                std::memset(buffer.data() + offset + i * desc.size +
+                                offsetof(ur_base_desc_t, pNext),
+                            0, sizeof(void *));
+            }
+        }
+    } break;
+    case param_kind_t::string: {
+        if (nullptr == ptr) {
+            put(CAPTURE_NULL);
+            break;
+        }
+        uint64_t length = strlen(static_cast<const char *>(ptr));
+        put(length);
+        put(ptr, length);
+    } break;
+    case param_kind_t::memory:
+    case param_kind_t::memory_out:
+        encode_memory(desc,
+                      desc.count < 0 ? CAPTURE_NULL
+                                     : get_count(descs, desc.count, args),
+                      ptr, flags);
+        break;
+    case param_kind_t::alloc_out:
+        put<uint64_t>(ptr ? pointer_value(ptr) : 0);
+        break;
+    case param_kind_t::out:
+        put(ptr ? get_count(descs, desc.count, args) * desc.size
+                : CAPTURE_NULL);
+        break;
+    case param_kind_t::unsupported: {
+        uint8_t present = nullptr != ptr;
+        if (present) {
+            flags |= CAPTURE_RECORD_INCOMPLETE;
+        }
+        put(present);
+    } break;
+    case param_kind_t::ignored:
+        break;
+    }
+}
+
+void capture_t::encode_memory(const capture_param_t &desc, uint64_t count,
+                              const void *ptr, uint32_t &flags) {
+    if (nullptr == ptr) {
+        put(CAPTURE_MEMORY_NULL);
+        return;
+    }
+
+    auto address = reinterpret_cast<uintptr_t>(ptr);
+    auto it = allocations.upper_bound(address);
+    if (it != allocations.begin()) {
+        --it;
+        if (address - it->first < std::max<uint64_t>(it->second, 1)) {
+            put(CAPTURE_MEMORY_ALLOCATION);
+            put<uint64_t>(it->first);
+            put<uint64_t>(address - it->first);
+            return;
+        }
+    }
+
+    if (count == CAPTURE_NULL) {
+        // host memory the spec gives no size for, e.g. of the rect copies
+        put(CAPTURE_MEMORY_UNKNOWN);
+        flags |= CAPTURE_RECORD_INCOMPLETE;
+    } else if (desc.kind == param_kind_t::memory_out) {
+        put(CAPTURE_MEMORY_HOST_OUTPUT);
+        put(count);
+    } else {
+        put(CAPTURE_MEMORY_HOST_DATA);
+        put(count);
+        put(ptr, count);
+    }
+}
+
+void capture_t::track_allocations(uint32_t function, const void *params,
+                                  const capture_param_t *descs,
+                                  size_t count) {
+    auto args = static_cast<void *const *>(params);
+    for (size_t i = 0; i < count; ++i) {
+        auto out = reinterpret_cast<const void *>(pointer_value(args[i]));
+        if (descs[i].kind == param_kind_t::alloc_out && nullptr != out) {
+            if (auto address = pointer_value(out)) {
+                allocations[address] = get_count(descs, descs[i].count, args);
+            }
+        }
+    }
+
+    if (function == UR_FUNCTION_USM_FREE) {
+        auto p = static_cast<const ur_usm_free_params_t *>(params);
+        allocations.erase(reinterpret_cast<uintptr_t>(*p->ppMem));
+    } else if (function == UR_FUNCTION_ENQUEUE_MEM_UNMAP) {
+        auto p = static_cast<const ur_enqueue_mem_unmap_params_t *>(params);
+        allocations.erase(reinterpret_cast<uintptr_t>(*p->ppMappedPtr));
+    }
+}
+
+} // namespace ur_tracing_layer
@@ -0,0 +1,127 @@
+/*
+ *
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file ur_capture.hpp
+ *
+ */
+
+#ifndef UR_CAPTURE_H
+#define UR_CAPTURE_H 1
+
+#include "ur_api.h"
+#include "ur_params.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ur_tracing_layer {
+
+///////////////////////////////////////////////////////////////////////////////
+/// layout of the capture file
+///
+/// the file starts with a capture_file_header_t, followed by a record of each
+/// call, in the order the calls returned: a capture_record_t and `size` bytes
+/// with the arguments of the call, one after the other in the order of the
+/// parameters, as described by ur_params::getCaptureParams:
+///
+/// - value: the bytes of the value
+/// - handle: the handle, as a u64
+/// - handle_array, handle_out: u64 count and the handles as u64s
+/// - data, desc, string: u64 count and the bytes of the elements, without the
+///   terminating null of a string and with the pNext of a desc cleared
+/// - memory, memory_out: u8 capture_memory_t, followed by
+///   - CAPTURE_MEMORY_ALLOCATION: u64 address returned by the allocation and
+///     u64 offset from it
+///   - CAPTURE_MEMORY_HOST_DATA: u64 count and the bytes
+///   - CAPTURE_MEMORY_HOST_OUTPUT: u64 count
+/// - alloc_out: the returned address, as a u64
+/// - out: u64 number of bytes
+/// - unsupported: u8, 1 if the argument is not null
+/// - ignored: nothing
+///
+/// the counts of null pointers are CAPTURE_NULL
+struct capture_file_header_t {
+    char magic[8];    ///< "URCAPTUR"
+    uint32_t version; ///< 1
+    uint32_t reserved;
+};
+
+struct capture_record_t {
+    uint32_t function; ///< ur_function_t of the call
+    int32_t result;    ///< result of the call
+    uint32_t flags;    ///< capture_record_flags_t
+    uint32_t size;     ///< number of bytes of arguments that follow
+};
+
+enum capture_record_flags_t : uint32_t {
+    /// an argument could not be captured, the call cannot be replayed
+    CAPTURE_RECORD_INCOMPLETE = 1,
+};
+
+enum capture_memory_t : uint8_t {
+    CAPTURE_MEMORY_NULL = 0,
+    CAPTURE_MEMORY_ALLOCATION = 1,  ///< points into memory returned by a call
+    CAPTURE_MEMORY_HOST_DATA = 2,   ///< host memory the call reads
+    CAPTURE_MEMORY_HOST_OUTPUT = 3, ///< host memory the call writes
+    CAPTURE_MEMORY_UNKNOWN = 4,     ///< host memory of unknown size
+};
+
+constexpr uint64_t CAPTURE_NULL = UINT64_MAX;
+
+///////////////////////////////////////////////////////////////////////////////
+/// replayable record of the API calls, with their inputs
+///
+/// the calls are encoded and written as they return, under a lock, so the
+/// capture serializes the calls of the process, it is meant for reproducing
+/// a workload rather than for measuring it
+class capture_t {
+  public:
+    capture_t() = default;
+    capture_t(const capture_t &) = delete;
+    capture_t &operator=(const capture_t &) = delete;
+    ~capture_t();
+
+    /// opens the capture file
+    bool start(const std::string &path);
+
+    /// completes the file and closes it
+    void stop();
+
+    bool is_active() const noexcept {
+        return active.load(std::memory_order_relaxed);
+    }
+
+    /// writes the record of a call that returned
+    void record(uint32_t function, const void *params, ur_result_t result);
+
+  private:
+    void encode(const ur_params::capture_param_t *descs, size_t index,
+                void *const *args, uint32_t &flags);
+    void encode_memory(const ur_params::capture_param_t &desc,
+                       uint64_t count, const void *ptr, uint32_t &flags);
+    void track_allocations(uint32_t function, const void *params,
+                           const ur_params::capture_param_t *descs,
+                           size_t count);
+    void put(const void *data, size_t size);
+    template <typename T> void put(T value) { put(&value, sizeof(value)); }
+
+    std::atomic<bool> active = false;
+    std::mutex mut; ///< guards everything below
+    FILE *file = nullptr;
+    /// arguments of the record being written
+    std::vector<uint8_t> buffer;
+    /// memory returned by the calls, by address, with its size
+    std::map<uintptr_t, uint64_t> allocations;
+};
+
+} // namespace ur_tracing_layer
+
+#endif /* UR_CAPTURE_H */
@@ -8,10 +8,12 @@
  *
  */
 #include "ur_tracing_layer.hpp"
+#include "logger/ur_logger.hpp"
 #include "ur_api.h"
 #include "ur_util.hpp"
 #include "xpti/xpti_data_types.h"
 #include "xpti/xpti_trace_framework.h"
+#include <chrono>
 #include <sstream>
 
 namespace ur_tracing_layer {
@@ -20,6 +22,15 @@ context_t context;
 constexpr auto CALL_STREAM_NAME = "ur";
 constexpr auto STREAM_VER_MAJOR = UR_MAJOR_VERSION(UR_API_VERSION_CURRENT);
 constexpr auto STREAM_VER_MINOR = UR_MINOR_VERSION(UR_API_VERSION_CURRENT);
+constexpr auto BINARY_TRACE_FILE_ENV = "UR_BINARY_TRACE_FILE";
+constexpr auto SAMPLING_ENV = "UR_TRACE_SAMPLING";
+constexpr auto CAPTURE_FILE_ENV = "UR_CAPTURE_FILE";
+
+static uint64_t steady_clock_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
 
 ///////////////////////////////////////////////////////////////////////////////
 context_t::context_t() {
@@ -30,32 +41,235 @@ context_t::context_t() {
     streamv << STREAM_VER_MAJOR << "." << STREAM_VER_MINOR;
     xptiInitialize(CALL_STREAM_NAME, STREAM_VER_MAJOR, STREAM_VER_MINOR,
                    streamv.str().data());
+
+    // the subscribers register their callbacks in xptiTraceInit, which is
+    // called from xptiInitialize
+    refresh_subscriptions();
+}
+
+void context_t::refresh_subscriptions() {
+    // XPTI callbacks are registered per trace point type, not per function,
+    // so a subscription to either of the function trace points covers all
+    // the functions
+    xpti_subscribed =
+        xptiCheckTraceEnabled(
+            call_stream_id,
+            (uint16_t)xpti::trace_point_type_t::function_with_args_begin) ||
+        xptiCheckTraceEnabled(
+            call_stream_id,
+            (uint16_t)xpti::trace_point_type_t::function_with_args_end);
+
+    // the binary trace and the capture record every function
+    bool traced =
+        xpti_subscribed || binary_trace.is_active() || capture.is_active();
+
+    for (auto &word : subscribed) {
+        word.store(traced ? ~uint64_t(0) : 0, std::memory_order_relaxed);
+    }
+}
+
+void context_t::parse_sampling() {
+    std::optional<EnvVarMap> options;
+    try {
+        options = getenv_to_map(SAMPLING_ENV);
+    } catch (const std::invalid_argument &e) {
+        logger::error("{}", e.what());
+        return;
+    }
+    if (!options) {
+        return;
+    }
+
+    for (auto &[mode, values] : *options) {
+        uint64_t value = 0;
+        try {
+            if (values.size() != 1) {
+                throw std::invalid_argument(mode);
+            }
+            value = std::stoull(values.front());
+        } catch (const std::exception &) {
+            logger::error("{}: {} requires a single integer value",
+                          SAMPLING_ENV, mode);
+            continue;
+        }
+
+        if (sampling != sampling_t::all) {
+            logger::error(
+                "{}: only one sampling mode can be used, ignoring {}",
+                SAMPLING_ENV, mode);
+        } else if (mode == "rate" && value > 0) {
+            sampling = sampling_t::rate;
+            sample_rate = value;
+        } else if (mode == "period") {
+            sampling = sampling_t::period;
+            sample_period_ns = value * 1000 * 1000;
+        } else if (mode == "slow") {
+            sampling = sampling_t::slow;
+            slow_threshold_ns = value * 1000;
+        } else {
+            logger::error("{}: invalid sampling mode {}:{}", SAMPLING_ENV,
+                          mode, value);
+        }
+    }
 }
 
-bool context_t::isEnabled() { return xptiTraceEnabled(); }
+bool context_t::isEnabled() {
+    // read here rather than in the ctor, so that errors are reported through
+    // the loader's logger, which is set up by now
+    if (sampling == sampling_t::all) {
+        parse_sampling();
+    }
+
+    auto path = ur_getenv(BINARY_TRACE_FILE_ENV);
+    if (path && !binary_trace.is_active() && !binary_trace.start(*path)) {
+        logger::error("Failed to open the binary trace file {}", *path);
+    }
+
+    auto capture_path = ur_getenv(CAPTURE_FILE_ENV);
+    if (capture_path && !capture.is_active() &&
+        !capture.start(*capture_path)) {
+        logger::error("Failed to open the capture file {}", *capture_path);
+    }
+
+    return xptiTraceEnabled() || binary_trace.is_active() ||
+           capture.is_active();
+}
 
 void context_t::notify(uint16_t trace_type, uint32_t id, const char *name,
-                       void *args, ur_result_t *resultp, uint64_t instance) {
-    xpti::function_with_args_t payload{id, name, args, resultp, nullptr};
+                       void *args, ur_result_t *resultp, uint64_t instance,
+                       const uint64_t *time) {
+    // a subscriber that finds the time of the trace point in the user data
+    // uses it instead of taking its own, as the trace points of the slow
+    // calls are notified only after they return
+    xpti::function_with_args_t payload{id, name, args, resultp,
+                                       const_cast<uint64_t *>(time)};
     xptiNotifySubscribers(call_stream_id, trace_type, nullptr, nullptr,
                           instance, &payload);
 }
 
-uint64_t context_t::notify_begin(uint32_t id, const char *name, void *args) {
-    uint64_t instance = xptiGetUniqueId();
-    notify((uint16_t)xpti::trace_point_type_t::function_with_args_begin, id,
-           name, args, nullptr, instance);
+uint64_t context_t::new_instance() {
+    if (xpti_subscribed.load(std::memory_order_relaxed)) {
+        return xptiGetUniqueId();
+    }
+    return next_instance.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::vector<context_t::pending_call_t> &context_t::pending_calls() {
+    thread_local std::vector<pending_call_t> calls;
+    return calls;
+}
+
+bool context_t::sample(uint32_t id) {
+    if (id >= max_function_id) {
+        return true;
+    }
+
+    switch (sampling) {
+    case sampling_t::rate: {
+        // per thread, so that the calls of a function on different threads
+        // do not contend on a counter
+        thread_local std::array<uint64_t, max_function_id> calls = {};
+        return calls[id]++ % sample_rate == 0;
+    }
+    case sampling_t::period: {
+        auto now = steady_clock_ns();
+        auto next = next_sample_ns[id].load(std::memory_order_relaxed);
+        return now >= next &&
+               next_sample_ns[id].compare_exchange_strong(
+                   next, now + sample_period_ns, std::memory_order_relaxed);
+    }
+    default:
+        return true;
+    }
+}
+
+uint64_t context_t::notify_begin(uint32_t id, const char *name, void *args,
+                                 const void *handle) {
+    if (sampling == sampling_t::slow) {
+        uint64_t begin_timestamp =
+            binary_trace.is_active() ? binary_trace_t::timestamp() : 0;
+        pending_calls().push_back(
+            {steady_clock_ns(), begin_timestamp, handle});
+        return new_instance();
+    }
+
+    if (!sample(id)) {
+        return 0;
+    }
+
+    uint64_t instance = new_instance();
+    if (xpti_subscribed.load(std::memory_order_relaxed)) {
+        notify((uint16_t)xpti::trace_point_type_t::function_with_args_begin,
+               id, name, args, nullptr, instance);
+    }
+
+    if (binary_trace.is_active()) {
+        binary_trace.record(BINARY_RECORD_BEGIN, id, instance,
+                            reinterpret_cast<uintptr_t>(handle), 0);
+    }
     return instance;
 }
 
+void context_t::notify_slow_call(uint32_t id, const char *name, void *args,
+                                 ur_result_t *resultp, uint64_t instance) {
+    auto &calls = pending_calls();
+    if (calls.empty()) {
+        return;
+    }
+    auto call = calls.back();
+    calls.pop_back();
+
+    uint64_t end_ns = steady_clock_ns();
+    if (end_ns - call.begin_ns < slow_threshold_ns) {
+        return;
+    }
+
+    if (xpti_subscribed.load(std::memory_order_relaxed)) {
+        notify((uint16_t)xpti::trace_point_type_t::function_with_args_begin,
+               id, name, args, nullptr, instance, &call.begin_ns);
+        notify((uint16_t)xpti::trace_point_type_t::function_with_args_end, id,
+               name, args, resultp, instance, &end_ns);
+    }
+
+    if (binary_trace.is_active()) {
+        binary_trace.record(BINARY_RECORD_BEGIN, id, instance,
+                            reinterpret_cast<uintptr_t>(call.handle), 0,
+                            call.begin_timestamp);
+        binary_trace.record(BINARY_RECORD_END, id, instance, 0, *resultp);
+    }
+}
+
 void context_t::notify_end(uint32_t id, const char *name, void *args,
                            ur_result_t *resultp, uint64_t instance) {
-    notify((uint16_t)xpti::trace_point_type_t::function_with_args_end, id, name,
-           args, resultp, instance);
+    // the capture records every call, whether it is sampled or not
+    if (capture.is_active()) {
+        capture.record(id, args, *resultp);
+    }
+
+    if (sampling == sampling_t::slow) {
+        notify_slow_call(id, name, args, resultp, instance);
+        return;
+    }
+
+    if (instance == 0) {
+        return;
+    }
+
+    if (xpti_subscribed.load(std::memory_order_relaxed)) {
+        notify((uint16_t)xpti::trace_point_type_t::function_with_args_end, id,
+               name, args, resultp, instance);
+    }
+
+    if (binary_trace.is_active()) {
+        binary_trace.record(BINARY_RECORD_END, id, instance, 0, *resultp);
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 context_t::~context_t() {
+    binary_trace.stop();
+    capture.stop();
+
     xptiFinalize(CALL_STREAM_NAME);
 
     xptiFrameworkFinalize();
@@ -11,10 +11,16 @@
 #ifndef UR_TRACING_LAYER_H
 #define UR_TRACING_LAYER_H 1
 
+#include "ur_binary_trace.hpp"
+#include "ur_capture.hpp"
 #include "ur_ddi.h"
 #include "ur_proxy_layer.hpp"
 #include "ur_util.hpp"
 
+#include <array>
+#include <atomic>
+#include <vector>
+
 #define TRACING_COMP_NAME "tracing layer"
 
 namespace ur_tracing_layer {
@@ -28,14 +34,77 @@ class __urdlllocal context_t : public proxy_layer_context_t {
 
     bool isEnabled() override;
     ur_result_t init(ur_dditable_t *dditable) override;
-    uint64_t notify_begin(uint32_t id, const char *name, void *args);
+    /// returns the instance id of the call, or 0 if the call is not sampled,
+    /// in which case notify_end does nothing
+    uint64_t notify_begin(uint32_t id, const char *name, void *args,
+                          const void *handle = nullptr);
     void notify_end(uint32_t id, const char *name, void *args,
                     ur_result_t *resultp, uint64_t instance);
 
+    /// whether any subscriber wants the trace points of the function,
+    /// the intercepts call straight through to the next layer if not
+    bool is_subscribed(uint32_t id) const {
+        if (id >= max_function_id) {
+            return true;
+        }
+        return (subscribed[id / 64].load(std::memory_order_relaxed) >>
+                (id % 64)) &
+               1;
+    }
+
+    /// rebuilds the subscription bitmap from the callbacks registered with
+    /// the XPTI dispatcher, XPTI does not report new registrations, so this
+    /// only runs when the layer is created and in urInit, callbacks
+    /// registered later are not notified
+    void refresh_subscriptions();
+
   private:
     void notify(uint16_t trace_type, uint32_t id, const char *name, void *args,
-                ur_result_t *resultp, uint64_t instance);
+                ur_result_t *resultp, uint64_t instance,
+                const uint64_t *time = nullptr);
+    uint64_t new_instance();
+    bool sample(uint32_t id);
+    void notify_slow_call(uint32_t id, const char *name, void *args,
+                          ur_result_t *resultp, uint64_t instance);
+    void parse_sampling();
     uint8_t call_stream_id;
+
+    /// whether the XPTI dispatcher has subscribers for the call stream
+    std::atomic<bool> xpti_subscribed = false;
+    /// instance ids of the calls when there is no XPTI subscriber
+    std::atomic<uint64_t> next_instance = 1;
+    /// records of the calls, enabled with UR_BINARY_TRACE_FILE
+    binary_trace_t binary_trace;
+    /// replayable record of the calls, enabled with UR_CAPTURE_FILE
+    capture_t capture;
+
+    /// function ids past this one are always treated as subscribed
+    static constexpr uint32_t max_function_id = 256;
+    std::array<std::atomic<uint64_t>, max_function_id / 64> subscribed = {};
+
+    /// which calls are traced, set with UR_TRACE_SAMPLING
+    enum class sampling_t {
+        all,    ///< every call
+        rate,   ///< 1 in sample_rate calls of each function, on each thread
+        period, ///< the first call of each function in every sample period
+        slow,   ///< the calls that take at least slow_threshold, reported
+                ///< once they return
+    };
+    sampling_t sampling = sampling_t::all;
+    uint64_t sample_rate = 1;
+    uint64_t sample_period_ns = 0;
+    uint64_t slow_threshold_ns = 0;
+    /// steady clock time from which a function is sampled again
+    std::array<std::atomic<uint64_t>, max_function_id> next_sample_ns = {};
+
+    /// a call in progress, when only the slow calls are traced
+    struct pending_call_t {
+        uint64_t begin_ns;
+        uint64_t begin_timestamp; ///< of the binary trace
+        const void *handle;
+    };
+    /// the calls in progress on the calling thread, innermost last
+    static std::vector<pending_call_t> &pending_calls();
 };
 
 extern context_t context;
@@ -25,6 +25,10 @@ __urdlllocal ur_result_t UR_APICALL urInit(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_INIT)) {
+        return pfnInit(device_flags);
+    }
+
     ur_init_params_t params = {&device_flags};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_INIT, "urInit", &params);
@@ -47,6 +51,10 @@ __urdlllocal ur_result_t UR_APICALL urTearDown(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_TEAR_DOWN)) {
+        return pfnTearDown(pParams);
+    }
+
     ur_tear_down_params_t params = {&pParams};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_TEAR_DOWN, "urTearDown", &params);
@@ -80,6 +88,10 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGet(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_PLATFORM_GET)) {
+        return pfnGet(NumEntries, phPlatforms, pNumPlatforms);
+    }
+
     ur_platform_get_params_t params = {&NumEntries, &phPlatforms,
                                        &pNumPlatforms};
     uint64_t instance = context.notify_begin(UR_FUNCTION_PLATFORM_GET,
@@ -114,10 +126,14 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_PLATFORM_GET_INFO)) {
+        return pfnGetInfo(hPlatform, propName, propSize, pPropValue, pSizeRet);
+    }
+
     ur_platform_get_info_params_t params = {&hPlatform, &propName, &propSize,
                                             &pPropValue, &pSizeRet};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_PLATFORM_GET_INFO,
-                                             "urPlatformGetInfo", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_PLATFORM_GET_INFO, "urPlatformGetInfo", &params, hPlatform);
 
     ur_result_t result =
         pfnGetInfo(hPlatform, propName, propSize, pPropValue, pSizeRet);
@@ -140,10 +156,14 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetApiVersion(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_PLATFORM_GET_API_VERSION)) {
+        return pfnGetApiVersion(hDriver, pVersion);
+    }
+
     ur_platform_get_api_version_params_t params = {&hDriver, &pVersion};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_PLATFORM_GET_API_VERSION,
-                             "urPlatformGetApiVersion", &params);
+                             "urPlatformGetApiVersion", &params, hDriver);
 
     ur_result_t result = pfnGetApiVersion(hDriver, pVersion);
 
@@ -166,11 +186,15 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hPlatform, phNativePlatform);
+    }
+
     ur_platform_get_native_handle_params_t params = {&hPlatform,
                                                      &phNativePlatform};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE,
-                             "urPlatformGetNativeHandle", &params);
+                             "urPlatformGetNativeHandle", &params, hPlatform);
 
     ur_result_t result = pfnGetNativeHandle(hPlatform, phNativePlatform);
 
@@ -195,11 +219,17 @@ __urdlllocal ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(
+            UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativePlatform, phPlatform);
+    }
+
     ur_platform_create_with_native_handle_params_t params = {&hNativePlatform,
                                                              &phPlatform};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE,
-                             "urPlatformCreateWithNativeHandle", &params);
+                             "urPlatformCreateWithNativeHandle", &params,
+                             hNativePlatform);
 
     ur_result_t result = pfnCreateWithNativeHandle(hNativePlatform, phPlatform);
 
@@ -226,11 +256,16 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetBackendOption(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION)) {
+        return pfnGetBackendOption(hPlatform, pFrontendOption,
+                                   ppPlatformOption);
+    }
+
     ur_platform_get_backend_option_params_t params = {
         &hPlatform, &pFrontendOption, &ppPlatformOption};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION,
-                             "urPlatformGetBackendOption", &params);
+                             "urPlatformGetBackendOption", &params, hPlatform);
 
     ur_result_t result =
         pfnGetBackendOption(hPlatform, pFrontendOption, ppPlatformOption);
@@ -256,9 +291,13 @@ __urdlllocal ur_result_t UR_APICALL urGetLastResult(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_GET_LAST_RESULT)) {
+        return pfnGetLastResult(hPlatform, ppMessage);
+    }
+
     ur_get_last_result_params_t params = {&hPlatform, &ppMessage};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_GET_LAST_RESULT,
-                                             "urGetLastResult", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_GET_LAST_RESULT, "urGetLastResult", &params, hPlatform);
 
     ur_result_t result = pfnGetLastResult(hPlatform, ppMessage);
 
@@ -291,10 +330,15 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGet(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_DEVICE_GET)) {
+        return pfnGet(hPlatform, DeviceType, NumEntries, phDevices,
+                      pNumDevices);
+    }
+
     ur_device_get_params_t params = {&hPlatform, &DeviceType, &NumEntries,
                                      &phDevices, &pNumDevices};
-    uint64_t instance =
-        context.notify_begin(UR_FUNCTION_DEVICE_GET, "urDeviceGet", &params);
+    uint64_t instance = context.notify_begin(UR_FUNCTION_DEVICE_GET,
+                                             "urDeviceGet", &params, hPlatform);
 
     ur_result_t result =
         pfnGet(hPlatform, DeviceType, NumEntries, phDevices, pNumDevices);
@@ -327,10 +371,15 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_DEVICE_GET_INFO)) {
+        return pfnGetInfo(hDevice, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
     ur_device_get_info_params_t params = {&hDevice, &propName, &propSize,
                                           &pPropValue, &pPropSizeRet};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_DEVICE_GET_INFO,
-                                             "urDeviceGetInfo", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_DEVICE_GET_INFO, "urDeviceGetInfo", &params, hDevice);
 
     ur_result_t result =
         pfnGetInfo(hDevice, propName, propSize, pPropValue, pPropSizeRet);
@@ -353,9 +402,13 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_DEVICE_RETAIN)) {
+        return pfnRetain(hDevice);
+    }
+
     ur_device_retain_params_t params = {&hDevice};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_DEVICE_RETAIN,
-                                             "urDeviceRetain", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_DEVICE_RETAIN, "urDeviceRetain", &params, hDevice);
 
     ur_result_t result = pfnRetain(hDevice);
 
@@ -376,9 +429,13 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_DEVICE_RELEASE)) {
+        return pfnRelease(hDevice);
+    }
+
     ur_device_release_params_t params = {&hDevice};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_DEVICE_RELEASE,
-                                             "urDeviceRelease", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_DEVICE_RELEASE, "urDeviceRelease", &params, hDevice);
 
     ur_result_t result = pfnRelease(hDevice);
 
@@ -409,10 +466,15 @@ __urdlllocal ur_result_t UR_APICALL urDevicePartition(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_DEVICE_PARTITION)) {
+        return pfnPartition(hDevice, pProperties, NumDevices, phSubDevices,
+                            pNumDevicesRet);
+    }
+
     ur_device_partition_params_t params = {&hDevice, &pProperties, &NumDevices,
                                            &phSubDevices, &pNumDevicesRet};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_DEVICE_PARTITION,
-                                             "urDevicePartition", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_DEVICE_PARTITION, "urDevicePartition", &params, hDevice);
 
     ur_result_t result = pfnPartition(hDevice, pProperties, NumDevices,
                                       phSubDevices, pNumDevicesRet);
@@ -443,10 +505,16 @@ __urdlllocal ur_result_t UR_APICALL urDeviceSelectBinary(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_DEVICE_SELECT_BINARY)) {
+        return pfnSelectBinary(hDevice, pBinaries, NumBinaries,
+                               pSelectedBinary);
+    }
+
     ur_device_select_binary_params_t params = {&hDevice, &pBinaries,
                                                &NumBinaries, &pSelectedBinary};
     uint64_t instance = context.notify_begin(UR_FUNCTION_DEVICE_SELECT_BINARY,
-                                             "urDeviceSelectBinary", &params);
+                                             "urDeviceSelectBinary", &params,
+                                             hDevice);
 
     ur_result_t result =
         pfnSelectBinary(hDevice, pBinaries, NumBinaries, pSelectedBinary);
@@ -470,10 +538,14 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hDevice, phNativeDevice);
+    }
+
     ur_device_get_native_handle_params_t params = {&hDevice, &phNativeDevice};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE,
-                             "urDeviceGetNativeHandle", &params);
+                             "urDeviceGetNativeHandle", &params, hDevice);
 
     ur_result_t result = pfnGetNativeHandle(hDevice, phNativeDevice);
 
@@ -498,11 +570,16 @@ __urdlllocal ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativeDevice, hPlatform, phDevice);
+    }
+
     ur_device_create_with_native_handle_params_t params = {
         &hNativeDevice, &hPlatform, &phDevice};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE,
-                             "urDeviceCreateWithNativeHandle", &params);
+                             "urDeviceCreateWithNativeHandle", &params,
+                             hNativeDevice);
 
     ur_result_t result =
         pfnCreateWithNativeHandle(hNativeDevice, hPlatform, phDevice);
@@ -532,11 +609,16 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS)) {
+        return pfnGetGlobalTimestamps(hDevice, pDeviceTimestamp,
+                                      pHostTimestamp);
+    }
+
     ur_device_get_global_timestamps_params_t params = {
         &hDevice, &pDeviceTimestamp, &pHostTimestamp};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS,
-                             "urDeviceGetGlobalTimestamps", &params);
+                             "urDeviceGetGlobalTimestamps", &params, hDevice);
 
     ur_result_t result =
         pfnGetGlobalTimestamps(hDevice, pDeviceTimestamp, pHostTimestamp);
@@ -565,6 +647,10 @@ __urdlllocal ur_result_t UR_APICALL urContextCreate(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_CONTEXT_CREATE)) {
+        return pfnCreate(DeviceCount, phDevices, pProperties, phContext);
+    }
+
     ur_context_create_params_t params = {&DeviceCount, &phDevices, &pProperties,
                                          &phContext};
     uint64_t instance = context.notify_begin(UR_FUNCTION_CONTEXT_CREATE,
@@ -591,9 +677,13 @@ __urdlllocal ur_result_t UR_APICALL urContextRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_CONTEXT_RETAIN)) {
+        return pfnRetain(hContext);
+    }
+
     ur_context_retain_params_t params = {&hContext};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_CONTEXT_RETAIN,
-                                             "urContextRetain", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_CONTEXT_RETAIN, "urContextRetain", &params, hContext);
 
     ur_result_t result = pfnRetain(hContext);
 
@@ -614,9 +704,13 @@ __urdlllocal ur_result_t UR_APICALL urContextRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_CONTEXT_RELEASE)) {
+        return pfnRelease(hContext);
+    }
+
     ur_context_release_params_t params = {&hContext};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_CONTEXT_RELEASE,
-                                             "urContextRelease", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_CONTEXT_RELEASE, "urContextRelease", &params, hContext);
 
     ur_result_t result = pfnRelease(hContext);
 
@@ -649,10 +743,15 @@ __urdlllocal ur_result_t UR_APICALL urContextGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_CONTEXT_GET_INFO)) {
+        return pfnGetInfo(hContext, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
     ur_context_get_info_params_t params = {&hContext, &propName, &propSize,
                                            &pPropValue, &pPropSizeRet};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_CONTEXT_GET_INFO,
-                                             "urContextGetInfo", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_CONTEXT_GET_INFO, "urContextGetInfo", &params, hContext);
 
     ur_result_t result =
         pfnGetInfo(hContext, propName, propSize, pPropValue, pPropSizeRet);
@@ -676,11 +775,15 @@ __urdlllocal ur_result_t UR_APICALL urContextGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hContext, phNativeContext);
+    }
+
     ur_context_get_native_handle_params_t params = {&hContext,
                                                     &phNativeContext};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE,
-                             "urContextGetNativeHandle", &params);
+                             "urContextGetNativeHandle", &params, hContext);
 
     ur_result_t result = pfnGetNativeHandle(hContext, phNativeContext);
 
@@ -710,11 +813,17 @@ __urdlllocal ur_result_t UR_APICALL urContextCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativeContext, numDevices, phDevices,
+                                         pProperties, phContext);
+    }
+
     ur_context_create_with_native_handle_params_t params = {
         &hNativeContext, &numDevices, &phDevices, &pProperties, &phContext};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE,
-                             "urContextCreateWithNativeHandle", &params);
+                             "urContextCreateWithNativeHandle", &params,
+                             hNativeContext);
 
     ur_result_t result = pfnCreateWithNativeHandle(
         hNativeContext, numDevices, phDevices, pProperties, phContext);
@@ -742,11 +851,15 @@ __urdlllocal ur_result_t UR_APICALL urContextSetExtendedDeleter(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER)) {
+        return pfnSetExtendedDeleter(hContext, pfnDeleter, pUserData);
+    }
+
     ur_context_set_extended_deleter_params_t params = {&hContext, &pfnDeleter,
                                                        &pUserData};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER,
-                             "urContextSetExtendedDeleter", &params);
+                             "urContextSetExtendedDeleter", &params, hContext);
 
     ur_result_t result = pfnSetExtendedDeleter(hContext, pfnDeleter, pUserData);
 
@@ -774,10 +887,15 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreate(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_MEM_IMAGE_CREATE)) {
+        return pfnImageCreate(hContext, flags, pImageFormat, pImageDesc, pHost,
+                              phMem);
+    }
+
     ur_mem_image_create_params_t params = {&hContext,   &flags, &pImageFormat,
                                            &pImageDesc, &pHost, &phMem};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_MEM_IMAGE_CREATE,
-                                             "urMemImageCreate", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_MEM_IMAGE_CREATE, "urMemImageCreate", &params, hContext);
 
     ur_result_t result =
         pfnImageCreate(hContext, flags, pImageFormat, pImageDesc, pHost, phMem);
@@ -805,10 +923,14 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreate(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_MEM_BUFFER_CREATE)) {
+        return pfnBufferCreate(hContext, flags, size, pProperties, phBuffer);
+    }
+
     ur_mem_buffer_create_params_t params = {&hContext, &flags, &size,
                                             &pProperties, &phBuffer};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_MEM_BUFFER_CREATE,
-                                             "urMemBufferCreate", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_MEM_BUFFER_CREATE, "urMemBufferCreate", &params, hContext);
 
     ur_result_t result =
         pfnBufferCreate(hContext, flags, size, pProperties, phBuffer);
@@ -830,9 +952,13 @@ __urdlllocal ur_result_t UR_APICALL urMemRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_MEM_RETAIN)) {
+        return pfnRetain(hMem);
+    }
+
     ur_mem_retain_params_t params = {&hMem};
-    uint64_t instance =
-        context.notify_begin(UR_FUNCTION_MEM_RETAIN, "urMemRetain", &params);
+    uint64_t instance = context.notify_begin(UR_FUNCTION_MEM_RETAIN,
+                                             "urMemRetain", &params, hMem);
 
     ur_result_t result = pfnRetain(hMem);
 
@@ -853,9 +979,13 @@ __urdlllocal ur_result_t UR_APICALL urMemRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_MEM_RELEASE)) {
+        return pfnRelease(hMem);
+    }
+
     ur_mem_release_params_t params = {&hMem};
-    uint64_t instance =
-        context.notify_begin(UR_FUNCTION_MEM_RELEASE, "urMemRelease", &params);
+    uint64_t instance = context.notify_begin(UR_FUNCTION_MEM_RELEASE,
+                                             "urMemRelease", &params, hMem);
 
     ur_result_t result = pfnRelease(hMem);
 
@@ -883,10 +1013,16 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferPartition(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_MEM_BUFFER_PARTITION)) {
+        return pfnBufferPartition(hBuffer, flags, bufferCreateType, pRegion,
+                                  phMem);
+    }
+
     ur_mem_buffer_partition_params_t params = {
         &hBuffer, &flags, &bufferCreateType, &pRegion, &phMem};
     uint64_t instance = context.notify_begin(UR_FUNCTION_MEM_BUFFER_PARTITION,
-                                             "urMemBufferPartition", &params);
+                                             "urMemBufferPartition", &params,
+                                             hBuffer);
 
     ur_result_t result =
         pfnBufferPartition(hBuffer, flags, bufferCreateType, pRegion, phMem);
@@ -910,9 +1046,14 @@ __urdlllocal ur_result_t UR_APICALL urMemGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_MEM_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hMem, phNativeMem);
+    }
+
     ur_mem_get_native_handle_params_t params = {&hMem, &phNativeMem};
     uint64_t instance = context.notify_begin(UR_FUNCTION_MEM_GET_NATIVE_HANDLE,
-                                             "urMemGetNativeHandle", &params);
+                                             "urMemGetNativeHandle", &params,
+                                             hMem);
 
     ur_result_t result = pfnGetNativeHandle(hMem, phNativeMem);
 
@@ -937,11 +1078,16 @@ __urdlllocal ur_result_t UR_APICALL urMemCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_MEM_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativeMem, hContext, phMem);
+    }
+
     ur_mem_create_with_native_handle_params_t params = {&hNativeMem, &hContext,
                                                         &phMem};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_MEM_CREATE_WITH_NATIVE_HANDLE,
-                             "urMemCreateWithNativeHandle", &params);
+                             "urMemCreateWithNativeHandle", &params,
+                             hNativeMem);
 
     ur_result_t result = pfnCreateWithNativeHandle(hNativeMem, hContext, phMem);
 
@@ -975,10 +1121,15 @@ __urdlllocal ur_result_t UR_APICALL urMemGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_MEM_GET_INFO)) {
+        return pfnGetInfo(hMemory, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
     ur_mem_get_info_params_t params = {&hMemory, &propName, &propSize,
                                        &pPropValue, &pPropSizeRet};
-    uint64_t instance =
-        context.notify_begin(UR_FUNCTION_MEM_GET_INFO, "urMemGetInfo", &params);
+    uint64_t instance = context.notify_begin(UR_FUNCTION_MEM_GET_INFO,
+                                             "urMemGetInfo", &params, hMemory);
 
     ur_result_t result =
         pfnGetInfo(hMemory, propName, propSize, pPropValue, pPropSizeRet);
@@ -1011,10 +1162,15 @@ __urdlllocal ur_result_t UR_APICALL urMemImageGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_MEM_IMAGE_GET_INFO)) {
+        return pfnImageGetInfo(hMemory, propName, propSize, pPropValue,
+                               pPropSizeRet);
+    }
+
     ur_mem_image_get_info_params_t params = {&hMemory, &propName, &propSize,
                                              &pPropValue, &pPropSizeRet};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_MEM_IMAGE_GET_INFO,
-                                             "urMemImageGetInfo", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_MEM_IMAGE_GET_INFO, "urMemImageGetInfo", &params, hMemory);
 
     ur_result_t result =
         pfnImageGetInfo(hMemory, propName, propSize, pPropValue, pPropSizeRet);
@@ -1039,9 +1195,13 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreate(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_SAMPLER_CREATE)) {
+        return pfnCreate(hContext, pDesc, phSampler);
+    }
+
     ur_sampler_create_params_t params = {&hContext, &pDesc, &phSampler};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_SAMPLER_CREATE,
-                                             "urSamplerCreate", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_SAMPLER_CREATE, "urSamplerCreate", &params, hContext);
 
     ur_result_t result = pfnCreate(hContext, pDesc, phSampler);
 
@@ -1063,9 +1223,13 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_SAMPLER_RETAIN)) {
+        return pfnRetain(hSampler);
+    }
+
     ur_sampler_retain_params_t params = {&hSampler};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_SAMPLER_RETAIN,
-                                             "urSamplerRetain", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_SAMPLER_RETAIN, "urSamplerRetain", &params, hSampler);
 
     ur_result_t result = pfnRetain(hSampler);
 
@@ -1087,9 +1251,13 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_SAMPLER_RELEASE)) {
+        return pfnRelease(hSampler);
+    }
+
     ur_sampler_release_params_t params = {&hSampler};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_SAMPLER_RELEASE,
-                                             "urSamplerRelease", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_SAMPLER_RELEASE, "urSamplerRelease", &params, hSampler);
 
     ur_result_t result = pfnRelease(hSampler);
 
@@ -1117,10 +1285,15 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_SAMPLER_GET_INFO)) {
+        return pfnGetInfo(hSampler, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
     ur_sampler_get_info_params_t params = {&hSampler, &propName, &propSize,
                                            &pPropValue, &pPropSizeRet};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_SAMPLER_GET_INFO,
-                                             "urSamplerGetInfo", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_SAMPLER_GET_INFO, "urSamplerGetInfo", &params, hSampler);
 
     ur_result_t result =
         pfnGetInfo(hSampler, propName, propSize, pPropValue, pPropSizeRet);
@@ -1144,11 +1317,15 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hSampler, phNativeSampler);
+    }
+
     ur_sampler_get_native_handle_params_t params = {&hSampler,
                                                     &phNativeSampler};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE,
-                             "urSamplerGetNativeHandle", &params);
+                             "urSamplerGetNativeHandle", &params, hSampler);
 
     ur_result_t result = pfnGetNativeHandle(hSampler, phNativeSampler);
 
@@ -1174,11 +1351,16 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativeSampler, hContext, phSampler);
+    }
+
     ur_sampler_create_with_native_handle_params_t params = {
         &hNativeSampler, &hContext, &phSampler};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE,
-                             "urSamplerCreateWithNativeHandle", &params);
+                             "urSamplerCreateWithNativeHandle", &params,
+                             hNativeSampler);
 
     ur_result_t result =
         pfnCreateWithNativeHandle(hNativeSampler, hContext, phSampler);
@@ -1208,10 +1390,14 @@ __urdlllocal ur_result_t UR_APICALL urUSMHostAlloc(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_USM_HOST_ALLOC)) {
+        return pfnHostAlloc(hContext, pUSMDesc, pool, size, ppMem);
+    }
+
     ur_usm_host_alloc_params_t params = {&hContext, &pUSMDesc, &pool, &size,
                                          &ppMem};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_USM_HOST_ALLOC,
-                                             "urUSMHostAlloc", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_USM_HOST_ALLOC, "urUSMHostAlloc", &params, hContext);
 
     ur_result_t result = pfnHostAlloc(hContext, pUSMDesc, pool, size, ppMem);
 
@@ -1240,10 +1426,14 @@ __urdlllocal ur_result_t UR_APICALL urUSMDeviceAlloc(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_USM_DEVICE_ALLOC)) {
+        return pfnDeviceAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
+    }
+
     ur_usm_device_alloc_params_t params = {&hContext, &hDevice, &pUSMDesc,
                                            &pool,     &size,    &ppMem};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_USM_DEVICE_ALLOC,
-                                             "urUSMDeviceAlloc", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_USM_DEVICE_ALLOC, "urUSMDeviceAlloc", &params, hContext);
 
     ur_result_t result =
         pfnDeviceAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
@@ -1273,10 +1463,14 @@ __urdlllocal ur_result_t UR_APICALL urUSMSharedAlloc(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_USM_SHARED_ALLOC)) {
+        return pfnSharedAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
+    }
+
     ur_usm_shared_alloc_params_t params = {&hContext, &hDevice, &pUSMDesc,
                                            &pool,     &size,    &ppMem};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_USM_SHARED_ALLOC,
-                                             "urUSMSharedAlloc", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_USM_SHARED_ALLOC, "urUSMSharedAlloc", &params, hContext);
 
     ur_result_t result =
         pfnSharedAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
@@ -1299,9 +1493,13 @@ __urdlllocal ur_result_t UR_APICALL urUSMFree(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_USM_FREE)) {
+        return pfnFree(hContext, pMem);
+    }
+
     ur_usm_free_params_t params = {&hContext, &pMem};
-    uint64_t instance =
-        context.notify_begin(UR_FUNCTION_USM_FREE, "urUSMFree", &params);
+    uint64_t instance = context.notify_begin(UR_FUNCTION_USM_FREE, "urUSMFree",
+                                             &params, hContext);
 
     ur_result_t result = pfnFree(hContext, pMem);
 
@@ -1332,10 +1530,16 @@ __urdlllocal ur_result_t UR_APICALL urUSMGetMemAllocInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_USM_GET_MEM_ALLOC_INFO)) {
+        return pfnGetMemAllocInfo(hContext, pMem, propName, propSize,
+                                  pPropValue, pPropSizeRet);
+    }
+
     ur_usm_get_mem_alloc_info_params_t params = {
         &hContext, &pMem, &propName, &propSize, &pPropValue, &pPropSizeRet};
     uint64_t instance = context.notify_begin(UR_FUNCTION_USM_GET_MEM_ALLOC_INFO,
-                                             "urUSMGetMemAllocInfo", &params);
+                                             "urUSMGetMemAllocInfo", &params,
+                                             hContext);
 
     ur_result_t result = pfnGetMemAllocInfo(hContext, pMem, propName, propSize,
                                             pPropValue, pPropSizeRet);
@@ -1361,9 +1565,13 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolCreate(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_USM_POOL_CREATE)) {
+        return pfnPoolCreate(hContext, pPoolDesc, ppPool);
+    }
+
     ur_usm_pool_create_params_t params = {&hContext, &pPoolDesc, &ppPool};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_USM_POOL_CREATE,
-                                             "urUSMPoolCreate", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_USM_POOL_CREATE, "urUSMPoolCreate", &params, hContext);
 
     ur_result_t result = pfnPoolCreate(hContext, pPoolDesc, ppPool);
 
@@ -1385,9 +1593,13 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolDestroy(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_USM_POOL_DESTROY)) {
+        return pfnPoolDestroy(hContext, pPool);
+    }
+
     ur_usm_pool_destroy_params_t params = {&hContext, &pPool};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_USM_POOL_DESTROY,
-                                             "urUSMPoolDestroy", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_USM_POOL_DESTROY, "urUSMPoolDestroy", &params, hContext);
 
     ur_result_t result = pfnPoolDestroy(hContext, pPool);
 
@@ -1414,10 +1626,15 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithIL(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_PROGRAM_CREATE_WITH_IL)) {
+        return pfnCreateWithIL(hContext, pIL, length, pProperties, phProgram);
+    }
+
     ur_program_create_with_il_params_t params = {&hContext, &pIL, &length,
                                                  &pProperties, &phProgram};
     uint64_t instance = context.notify_begin(UR_FUNCTION_PROGRAM_CREATE_WITH_IL,
-                                             "urProgramCreateWithIL", &params);
+                                             "urProgramCreateWithIL", &params,
+                                             hContext);
 
     ur_result_t result =
         pfnCreateWithIL(hContext, pIL, length, pProperties, phProgram);
@@ -1447,11 +1664,16 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithBinary(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY)) {
+        return pfnCreateWithBinary(hContext, hDevice, size, pBinary,
+                                   pProperties, phProgram);
+    }
+
     ur_program_create_with_binary_params_t params = {
         &hContext, &hDevice, &size, &pBinary, &pProperties, &phProgram};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY,
-                             "urProgramCreateWithBinary", &params);
+                             "urProgramCreateWithBinary", &params, hContext);
 
     ur_result_t result = pfnCreateWithBinary(hContext, hDevice, size, pBinary,
                                              pProperties, phProgram);
@@ -1476,9 +1698,13 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuild(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_PROGRAM_BUILD)) {
+        return pfnBuild(hContext, hProgram, pOptions);
+    }
+
     ur_program_build_params_t params = {&hContext, &hProgram, &pOptions};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_PROGRAM_BUILD,
-                                             "urProgramBuild", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_PROGRAM_BUILD, "urProgramBuild", &params, hContext);
 
     ur_result_t result = pfnBuild(hContext, hProgram, pOptions);
 
@@ -1503,9 +1729,13 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompile(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_PROGRAM_COMPILE)) {
+        return pfnCompile(hContext, hProgram, pOptions);
+    }
+
     ur_program_compile_params_t params = {&hContext, &hProgram, &pOptions};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_PROGRAM_COMPILE,
-                                             "urProgramCompile", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_PROGRAM_COMPILE, "urProgramCompile", &params, hContext);
 
     ur_result_t result = pfnCompile(hContext, hProgram, pOptions);
 
@@ -1533,10 +1763,14 @@ __urdlllocal ur_result_t UR_APICALL urProgramLink(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_PROGRAM_LINK)) {
+        return pfnLink(hContext, count, phPrograms, pOptions, phProgram);
+    }
+
     ur_program_link_params_t params = {&hContext, &count, &phPrograms,
                                        &pOptions, &phProgram};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_PROGRAM_LINK,
-                                             "urProgramLink", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_PROGRAM_LINK, "urProgramLink", &params, hContext);
 
     ur_result_t result =
         pfnLink(hContext, count, phPrograms, pOptions, phProgram);
@@ -1558,9 +1792,13 @@ __urdlllocal ur_result_t UR_APICALL urProgramRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_PROGRAM_RETAIN)) {
+        return pfnRetain(hProgram);
+    }
+
     ur_program_retain_params_t params = {&hProgram};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_PROGRAM_RETAIN,
-                                             "urProgramRetain", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_PROGRAM_RETAIN, "urProgramRetain", &params, hProgram);
 
     ur_result_t result = pfnRetain(hProgram);
 
@@ -1581,9 +1819,13 @@ __urdlllocal ur_result_t UR_APICALL urProgramRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_PROGRAM_RELEASE)) {
+        return pfnRelease(hProgram);
+    }
+
     ur_program_release_params_t params = {&hProgram};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_PROGRAM_RELEASE,
-                                             "urProgramRelease", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_PROGRAM_RELEASE, "urProgramRelease", &params, hProgram);
 
     ur_result_t result = pfnRelease(hProgram);
 
@@ -1614,11 +1856,16 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetFunctionPointer(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER)) {
+        return pfnGetFunctionPointer(hDevice, hProgram, pFunctionName,
+                                     ppFunctionPointer);
+    }
+
     ur_program_get_function_pointer_params_t params = {
         &hDevice, &hProgram, &pFunctionName, &ppFunctionPointer};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER,
-                             "urProgramGetFunctionPointer", &params);
+                             "urProgramGetFunctionPointer", &params, hDevice);
 
     ur_result_t result = pfnGetFunctionPointer(hDevice, hProgram, pFunctionName,
                                                ppFunctionPointer);
@@ -1652,10 +1899,15 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_PROGRAM_GET_INFO)) {
+        return pfnGetInfo(hProgram, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
     ur_program_get_info_params_t params = {&hProgram, &propName, &propSize,
                                            &pPropValue, &pPropSizeRet};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_PROGRAM_GET_INFO,
-                                             "urProgramGetInfo", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_PROGRAM_GET_INFO, "urProgramGetInfo", &params, hProgram);
 
     ur_result_t result =
         pfnGetInfo(hProgram, propName, propSize, pPropValue, pPropSizeRet);
@@ -1690,10 +1942,16 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetBuildInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_PROGRAM_GET_BUILD_INFO)) {
+        return pfnGetBuildInfo(hProgram, hDevice, propName, propSize,
+                               pPropValue, pPropSizeRet);
+    }
+
     ur_program_get_build_info_params_t params = {
         &hProgram, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
     uint64_t instance = context.notify_begin(UR_FUNCTION_PROGRAM_GET_BUILD_INFO,
-                                             "urProgramGetBuildInfo", &params);
+                                             "urProgramGetBuildInfo", &params,
+                                             hProgram);
 
     ur_result_t result = pfnGetBuildInfo(hProgram, hDevice, propName, propSize,
                                          pPropValue, pPropSizeRet);
@@ -1720,11 +1978,17 @@ __urdlllocal ur_result_t UR_APICALL urProgramSetSpecializationConstants(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(
+            UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS)) {
+        return pfnSetSpecializationConstants(hProgram, count, pSpecConstants);
+    }
+
     ur_program_set_specialization_constants_params_t params = {
         &hProgram, &count, &pSpecConstants};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS,
-                             "urProgramSetSpecializationConstants", &params);
+                             "urProgramSetSpecializationConstants", &params,
+                             hProgram);
 
     ur_result_t result =
         pfnSetSpecializationConstants(hProgram, count, pSpecConstants);
@@ -1749,11 +2013,15 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hProgram, phNativeProgram);
+    }
+
     ur_program_get_native_handle_params_t params = {&hProgram,
                                                     &phNativeProgram};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE,
-                             "urProgramGetNativeHandle", &params);
+                             "urProgramGetNativeHandle", &params, hProgram);
 
     ur_result_t result = pfnGetNativeHandle(hProgram, phNativeProgram);
 
@@ -1779,11 +2047,16 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativeProgram, hContext, phProgram);
+    }
+
     ur_program_create_with_native_handle_params_t params = {
         &hNativeProgram, &hContext, &phProgram};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE,
-                             "urProgramCreateWithNativeHandle", &params);
+                             "urProgramCreateWithNativeHandle", &params,
+                             hNativeProgram);
 
     ur_result_t result =
         pfnCreateWithNativeHandle(hNativeProgram, hContext, phProgram);
@@ -1809,9 +2082,13 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreate(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_KERNEL_CREATE)) {
+        return pfnCreate(hProgram, pKernelName, phKernel);
+    }
+
     ur_kernel_create_params_t params = {&hProgram, &pKernelName, &phKernel};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_KERNEL_CREATE,
-                                             "urKernelCreate", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_KERNEL_CREATE, "urKernelCreate", &params, hProgram);
 
     ur_result_t result = pfnCreate(hProgram, pKernelName, phKernel);
 
@@ -1836,10 +2113,15 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgValue(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_KERNEL_SET_ARG_VALUE)) {
+        return pfnSetArgValue(hKernel, argIndex, argSize, pArgValue);
+    }
+
     ur_kernel_set_arg_value_params_t params = {&hKernel, &argIndex, &argSize,
                                                &pArgValue};
     uint64_t instance = context.notify_begin(UR_FUNCTION_KERNEL_SET_ARG_VALUE,
-                                             "urKernelSetArgValue", &params);
+                                             "urKernelSetArgValue", &params,
+                                             hKernel);
 
     ur_result_t result = pfnSetArgValue(hKernel, argIndex, argSize, pArgValue);
 
@@ -1863,9 +2145,14 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgLocal(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_KERNEL_SET_ARG_LOCAL)) {
+        return pfnSetArgLocal(hKernel, argIndex, argSize);
+    }
+
     ur_kernel_set_arg_local_params_t params = {&hKernel, &argIndex, &argSize};
     uint64_t instance = context.notify_begin(UR_FUNCTION_KERNEL_SET_ARG_LOCAL,
-                                             "urKernelSetArgLocal", &params);
+                                             "urKernelSetArgLocal", &params,
+                                             hKernel);
 
     ur_result_t result = pfnSetArgLocal(hKernel, argIndex, argSize);
 
@@ -1898,10 +2185,15 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_KERNEL_GET_INFO)) {
+        return pfnGetInfo(hKernel, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
     ur_kernel_get_info_params_t params = {&hKernel, &propName, &propSize,
                                           &pPropValue, &pPropSizeRet};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_KERNEL_GET_INFO,
-                                             "urKernelGetInfo", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_KERNEL_GET_INFO, "urKernelGetInfo", &params, hKernel);
 
     ur_result_t result =
         pfnGetInfo(hKernel, propName, propSize, pPropValue, pPropSizeRet);
@@ -1933,10 +2225,16 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetGroupInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_KERNEL_GET_GROUP_INFO)) {
+        return pfnGetGroupInfo(hKernel, hDevice, propName, propSize, pPropValue,
+                               pPropSizeRet);
+    }
+
     ur_kernel_get_group_info_params_t params = {
         &hKernel, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
     uint64_t instance = context.notify_begin(UR_FUNCTION_KERNEL_GET_GROUP_INFO,
-                                             "urKernelGetGroupInfo", &params);
+                                             "urKernelGetGroupInfo", &params,
+                                             hKernel);
 
     ur_result_t result = pfnGetGroupInfo(hKernel, hDevice, propName, propSize,
                                          pPropValue, pPropSizeRet);
@@ -1968,11 +2266,16 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSubGroupInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO)) {
+        return pfnGetSubGroupInfo(hKernel, hDevice, propName, propSize,
+                                  pPropValue, pPropSizeRet);
+    }
+
     ur_kernel_get_sub_group_info_params_t params = {
         &hKernel, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO,
-                             "urKernelGetSubGroupInfo", &params);
+                             "urKernelGetSubGroupInfo", &params, hKernel);
 
     ur_result_t result = pfnGetSubGroupInfo(hKernel, hDevice, propName,
                                             propSize, pPropValue, pPropSizeRet);
@@ -1994,9 +2297,13 @@ __urdlllocal ur_result_t UR_APICALL urKernelRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_KERNEL_RETAIN)) {
+        return pfnRetain(hKernel);
+    }
+
     ur_kernel_retain_params_t params = {&hKernel};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_KERNEL_RETAIN,
-                                             "urKernelRetain", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_KERNEL_RETAIN, "urKernelRetain", &params, hKernel);
 
     ur_result_t result = pfnRetain(hKernel);
 
@@ -2017,9 +2324,13 @@ __urdlllocal ur_result_t UR_APICALL urKernelRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_KERNEL_RELEASE)) {
+        return pfnRelease(hKernel);
+    }
+
     ur_kernel_release_params_t params = {&hKernel};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_KERNEL_RELEASE,
-                                             "urKernelRelease", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_KERNEL_RELEASE, "urKernelRelease", &params, hKernel);
 
     ur_result_t result = pfnRelease(hKernel);
 
@@ -2044,10 +2355,15 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgPointer(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_KERNEL_SET_ARG_POINTER)) {
+        return pfnSetArgPointer(hKernel, argIndex, pArgValue);
+    }
+
     ur_kernel_set_arg_pointer_params_t params = {&hKernel, &argIndex,
                                                  &pArgValue};
     uint64_t instance = context.notify_begin(UR_FUNCTION_KERNEL_SET_ARG_POINTER,
-                                             "urKernelSetArgPointer", &params);
+                                             "urKernelSetArgPointer", &params,
+                                             hKernel);
 
     ur_result_t result = pfnSetArgPointer(hKernel, argIndex, pArgValue);
 
@@ -2073,10 +2389,15 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetExecInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_KERNEL_SET_EXEC_INFO)) {
+        return pfnSetExecInfo(hKernel, propName, propSize, pPropValue);
+    }
+
     ur_kernel_set_exec_info_params_t params = {&hKernel, &propName, &propSize,
                                                &pPropValue};
     uint64_t instance = context.notify_begin(UR_FUNCTION_KERNEL_SET_EXEC_INFO,
-                                             "urKernelSetExecInfo", &params);
+                                             "urKernelSetExecInfo", &params,
+                                             hKernel);
 
     ur_result_t result =
         pfnSetExecInfo(hKernel, propName, propSize, pPropValue);
@@ -2100,10 +2421,15 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgSampler(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_KERNEL_SET_ARG_SAMPLER)) {
+        return pfnSetArgSampler(hKernel, argIndex, hArgValue);
+    }
+
     ur_kernel_set_arg_sampler_params_t params = {&hKernel, &argIndex,
                                                  &hArgValue};
     uint64_t instance = context.notify_begin(UR_FUNCTION_KERNEL_SET_ARG_SAMPLER,
-                                             "urKernelSetArgSampler", &params);
+                                             "urKernelSetArgSampler", &params,
+                                             hKernel);
 
     ur_result_t result = pfnSetArgSampler(hKernel, argIndex, hArgValue);
 
@@ -2126,10 +2452,15 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgMemObj(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ)) {
+        return pfnSetArgMemObj(hKernel, argIndex, hArgValue);
+    }
+
     ur_kernel_set_arg_mem_obj_params_t params = {&hKernel, &argIndex,
                                                  &hArgValue};
     uint64_t instance = context.notify_begin(UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ,
-                                             "urKernelSetArgMemObj", &params);
+                                             "urKernelSetArgMemObj", &params,
+                                             hKernel);
 
     ur_result_t result = pfnSetArgMemObj(hKernel, argIndex, hArgValue);
 
@@ -2154,11 +2485,17 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetSpecializationConstants(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(
+            UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS)) {
+        return pfnSetSpecializationConstants(hKernel, count, pSpecConstants);
+    }
+
     ur_kernel_set_specialization_constants_params_t params = {&hKernel, &count,
                                                               &pSpecConstants};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS,
-                             "urKernelSetSpecializationConstants", &params);
+                             "urKernelSetSpecializationConstants", &params,
+                             hKernel);
 
     ur_result_t result =
         pfnSetSpecializationConstants(hKernel, count, pSpecConstants);
@@ -2183,10 +2520,14 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hKernel, phNativeKernel);
+    }
+
     ur_kernel_get_native_handle_params_t params = {&hKernel, &phNativeKernel};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE,
-                             "urKernelGetNativeHandle", &params);
+                             "urKernelGetNativeHandle", &params, hKernel);
 
     ur_result_t result = pfnGetNativeHandle(hKernel, phNativeKernel);
 
@@ -2215,11 +2556,17 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativeKernel, hContext, hProgram,
+                                         pProperties, phKernel);
+    }
+
     ur_kernel_create_with_native_handle_params_t params = {
         &hNativeKernel, &hContext, &hProgram, &pProperties, &phKernel};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE,
-                             "urKernelCreateWithNativeHandle", &params);
+                             "urKernelCreateWithNativeHandle", &params,
+                             hNativeKernel);
 
     ur_result_t result = pfnCreateWithNativeHandle(
         hNativeKernel, hContext, hProgram, pProperties, phKernel);
@@ -2250,10 +2597,14 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_QUEUE_GET_INFO)) {
+        return pfnGetInfo(hQueue, propName, propSize, pPropValue, pPropSizeRet);
+    }
+
     ur_queue_get_info_params_t params = {&hQueue, &propName, &propSize,
                                          &pPropValue, &pPropSizeRet};
     uint64_t instance = context.notify_begin(UR_FUNCTION_QUEUE_GET_INFO,
-                                             "urQueueGetInfo", &params);
+                                             "urQueueGetInfo", &params, hQueue);
 
     ur_result_t result =
         pfnGetInfo(hQueue, propName, propSize, pPropValue, pPropSizeRet);
@@ -2280,10 +2631,14 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreate(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_QUEUE_CREATE)) {
+        return pfnCreate(hContext, hDevice, pProperties, phQueue);
+    }
+
     ur_queue_create_params_t params = {&hContext, &hDevice, &pProperties,
                                        &phQueue};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_QUEUE_CREATE,
-                                             "urQueueCreate", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_QUEUE_CREATE, "urQueueCreate", &params, hContext);
 
     ur_result_t result = pfnCreate(hContext, hDevice, pProperties, phQueue);
 
@@ -2304,9 +2659,13 @@ __urdlllocal ur_result_t UR_APICALL urQueueRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_QUEUE_RETAIN)) {
+        return pfnRetain(hQueue);
+    }
+
     ur_queue_retain_params_t params = {&hQueue};
     uint64_t instance = context.notify_begin(UR_FUNCTION_QUEUE_RETAIN,
-                                             "urQueueRetain", &params);
+                                             "urQueueRetain", &params, hQueue);
 
     ur_result_t result = pfnRetain(hQueue);
 
@@ -2327,9 +2686,13 @@ __urdlllocal ur_result_t UR_APICALL urQueueRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_QUEUE_RELEASE)) {
+        return pfnRelease(hQueue);
+    }
+
     ur_queue_release_params_t params = {&hQueue};
     uint64_t instance = context.notify_begin(UR_FUNCTION_QUEUE_RELEASE,
-                                             "urQueueRelease", &params);
+                                             "urQueueRelease", &params, hQueue);
 
     ur_result_t result = pfnRelease(hQueue);
 
@@ -2352,9 +2715,14 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hQueue, phNativeQueue);
+    }
+
     ur_queue_get_native_handle_params_t params = {&hQueue, &phNativeQueue};
-    uint64_t instance = context.notify_begin(
-        UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE, "urQueueGetNativeHandle", &params);
+    uint64_t instance =
+        context.notify_begin(UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE,
+                             "urQueueGetNativeHandle", &params, hQueue);
 
     ur_result_t result = pfnGetNativeHandle(hQueue, phNativeQueue);
 
@@ -2379,11 +2747,16 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativeQueue, hContext, phQueue);
+    }
+
     ur_queue_create_with_native_handle_params_t params = {&hNativeQueue,
                                                           &hContext, &phQueue};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE,
-                             "urQueueCreateWithNativeHandle", &params);
+                             "urQueueCreateWithNativeHandle", &params,
+                             hNativeQueue);
 
     ur_result_t result =
         pfnCreateWithNativeHandle(hNativeQueue, hContext, phQueue);
@@ -2406,9 +2779,13 @@ __urdlllocal ur_result_t UR_APICALL urQueueFinish(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_QUEUE_FINISH)) {
+        return pfnFinish(hQueue);
+    }
+
     ur_queue_finish_params_t params = {&hQueue};
     uint64_t instance = context.notify_begin(UR_FUNCTION_QUEUE_FINISH,
-                                             "urQueueFinish", &params);
+                                             "urQueueFinish", &params, hQueue);
 
     ur_result_t result = pfnFinish(hQueue);
 
@@ -2429,9 +2806,13 @@ __urdlllocal ur_result_t UR_APICALL urQueueFlush(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_QUEUE_FLUSH)) {
+        return pfnFlush(hQueue);
+    }
+
     ur_queue_flush_params_t params = {&hQueue};
-    uint64_t instance =
-        context.notify_begin(UR_FUNCTION_QUEUE_FLUSH, "urQueueFlush", &params);
+    uint64_t instance = context.notify_begin(UR_FUNCTION_QUEUE_FLUSH,
+                                             "urQueueFlush", &params, hQueue);
 
     ur_result_t result = pfnFlush(hQueue);
 
@@ -2458,10 +2839,14 @@ __urdlllocal ur_result_t UR_APICALL urEventGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_EVENT_GET_INFO)) {
+        return pfnGetInfo(hEvent, propName, propSize, pPropValue, pPropSizeRet);
+    }
+
     ur_event_get_info_params_t params = {&hEvent, &propName, &propSize,
                                          &pPropValue, &pPropSizeRet};
     uint64_t instance = context.notify_begin(UR_FUNCTION_EVENT_GET_INFO,
-                                             "urEventGetInfo", &params);
+                                             "urEventGetInfo", &params, hEvent);
 
     ur_result_t result =
         pfnGetInfo(hEvent, propName, propSize, pPropValue, pPropSizeRet);
@@ -2492,11 +2877,16 @@ __urdlllocal ur_result_t UR_APICALL urEventGetProfilingInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_EVENT_GET_PROFILING_INFO)) {
+        return pfnGetProfilingInfo(hEvent, propName, propSize, pPropValue,
+                                   pPropSizeRet);
+    }
+
     ur_event_get_profiling_info_params_t params = {
         &hEvent, &propName, &propSize, &pPropValue, &pPropSizeRet};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_EVENT_GET_PROFILING_INFO,
-                             "urEventGetProfilingInfo", &params);
+                             "urEventGetProfilingInfo", &params, hEvent);
 
     ur_result_t result = pfnGetProfilingInfo(hEvent, propName, propSize,
                                              pPropValue, pPropSizeRet);
@@ -2521,6 +2911,10 @@ __urdlllocal ur_result_t UR_APICALL urEventWait(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_EVENT_WAIT)) {
+        return pfnWait(numEvents, phEventWaitList);
+    }
+
     ur_event_wait_params_t params = {&numEvents, &phEventWaitList};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_EVENT_WAIT, "urEventWait", &params);
@@ -2544,9 +2938,13 @@ __urdlllocal ur_result_t UR_APICALL urEventRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_EVENT_RETAIN)) {
+        return pfnRetain(hEvent);
+    }
+
     ur_event_retain_params_t params = {&hEvent};
     uint64_t instance = context.notify_begin(UR_FUNCTION_EVENT_RETAIN,
-                                             "urEventRetain", &params);
+                                             "urEventRetain", &params, hEvent);
 
     ur_result_t result = pfnRetain(hEvent);
 
@@ -2567,9 +2965,13 @@ __urdlllocal ur_result_t UR_APICALL urEventRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_EVENT_RELEASE)) {
+        return pfnRelease(hEvent);
+    }
+
     ur_event_release_params_t params = {&hEvent};
     uint64_t instance = context.notify_begin(UR_FUNCTION_EVENT_RELEASE,
-                                             "urEventRelease", &params);
+                                             "urEventRelease", &params, hEvent);
 
     ur_result_t result = pfnRelease(hEvent);
 
@@ -2592,9 +2994,14 @@ __urdlllocal ur_result_t UR_APICALL urEventGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_EVENT_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hEvent, phNativeEvent);
+    }
+
     ur_event_get_native_handle_params_t params = {&hEvent, &phNativeEvent};
-    uint64_t instance = context.notify_begin(
-        UR_FUNCTION_EVENT_GET_NATIVE_HANDLE, "urEventGetNativeHandle", &params);
+    uint64_t instance =
+        context.notify_begin(UR_FUNCTION_EVENT_GET_NATIVE_HANDLE,
+                             "urEventGetNativeHandle", &params, hEvent);
 
     ur_result_t result = pfnGetNativeHandle(hEvent, phNativeEvent);
 
@@ -2619,11 +3026,16 @@ __urdlllocal ur_result_t UR_APICALL urEventCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativeEvent, hContext, phEvent);
+    }
+
     ur_event_create_with_native_handle_params_t params = {&hNativeEvent,
                                                           &hContext, &phEvent};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE,
-                             "urEventCreateWithNativeHandle", &params);
+                             "urEventCreateWithNativeHandle", &params,
+                             hNativeEvent);
 
     ur_result_t result =
         pfnCreateWithNativeHandle(hNativeEvent, hContext, phEvent);
@@ -2650,10 +3062,14 @@ __urdlllocal ur_result_t UR_APICALL urEventSetCallback(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_EVENT_SET_CALLBACK)) {
+        return pfnSetCallback(hEvent, execStatus, pfnNotify, pUserData);
+    }
+
     ur_event_set_callback_params_t params = {&hEvent, &execStatus, &pfnNotify,
                                              &pUserData};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_EVENT_SET_CALLBACK,
-                                             "urEventSetCallback", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_EVENT_SET_CALLBACK, "urEventSetCallback", &params, hEvent);
 
     ur_result_t result =
         pfnSetCallback(hEvent, execStatus, pfnNotify, pUserData);
@@ -2701,6 +3117,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH)) {
+        return pfnKernelLaunch(hQueue, hKernel, workDim, pGlobalWorkOffset,
+                               pGlobalWorkSize, pLocalWorkSize,
+                               numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
     ur_enqueue_kernel_launch_params_t params = {&hQueue,
                                                 &hKernel,
                                                 &workDim,
@@ -2711,7 +3133,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
                                                 &phEventWaitList,
                                                 &phEvent};
     uint64_t instance = context.notify_begin(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH,
-                                             "urEnqueueKernelLaunch", &params);
+                                             "urEnqueueKernelLaunch", &params,
+                                             hQueue);
 
     ur_result_t result = pfnKernelLaunch(
         hQueue, hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize,
@@ -2744,10 +3167,16 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWait(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_ENQUEUE_EVENTS_WAIT)) {
+        return pfnEventsWait(hQueue, numEventsInWaitList, phEventWaitList,
+                             phEvent);
+    }
+
     ur_enqueue_events_wait_params_t params = {&hQueue, &numEventsInWaitList,
                                               &phEventWaitList, &phEvent};
     uint64_t instance = context.notify_begin(UR_FUNCTION_ENQUEUE_EVENTS_WAIT,
-                                             "urEnqueueEventsWait", &params);
+                                             "urEnqueueEventsWait", &params,
+                                             hQueue);
 
     ur_result_t result =
         pfnEventsWait(hQueue, numEventsInWaitList, phEventWaitList, phEvent);
@@ -2780,11 +3209,16 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER)) {
+        return pfnEventsWaitWithBarrier(hQueue, numEventsInWaitList,
+                                        phEventWaitList, phEvent);
+    }
+
     ur_enqueue_events_wait_with_barrier_params_t params = {
         &hQueue, &numEventsInWaitList, &phEventWaitList, &phEvent};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER,
-                             "urEnqueueEventsWaitWithBarrier", &params);
+                             "urEnqueueEventsWaitWithBarrier", &params, hQueue);
 
     ur_result_t result = pfnEventsWaitWithBarrier(hQueue, numEventsInWaitList,
                                                   phEventWaitList, phEvent);
@@ -2821,12 +3255,19 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ)) {
+        return pfnMemBufferRead(hQueue, hBuffer, blockingRead, offset, size,
+                                pDst, numEventsInWaitList, phEventWaitList,
+                                phEvent);
+    }
+
     ur_enqueue_mem_buffer_read_params_t params = {
         &hQueue, &hBuffer, &blockingRead,        &offset,
         &size,   &pDst,    &numEventsInWaitList, &phEventWaitList,
         &phEvent};
-    uint64_t instance = context.notify_begin(
-        UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ, "urEnqueueMemBufferRead", &params);
+    uint64_t instance =
+        context.notify_begin(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ,
+                             "urEnqueueMemBufferRead", &params, hQueue);
 
     ur_result_t result =
         pfnMemBufferRead(hQueue, hBuffer, blockingRead, offset, size, pDst,
@@ -2865,13 +3306,19 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE)) {
+        return pfnMemBufferWrite(hQueue, hBuffer, blockingWrite, offset, size,
+                                 pSrc, numEventsInWaitList, phEventWaitList,
+                                 phEvent);
+    }
+
     ur_enqueue_mem_buffer_write_params_t params = {
         &hQueue, &hBuffer, &blockingWrite,       &offset,
         &size,   &pSrc,    &numEventsInWaitList, &phEventWaitList,
         &phEvent};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE,
-                             "urEnqueueMemBufferWrite", &params);
+                             "urEnqueueMemBufferWrite", &params, hQueue);
 
     ur_result_t result =
         pfnMemBufferWrite(hQueue, hBuffer, blockingWrite, offset, size, pSrc,
@@ -2920,6 +3367,14 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT)) {
+        return pfnMemBufferReadRect(hQueue, hBuffer, blockingRead, bufferOrigin,
+                                    hostOrigin, region, bufferRowPitch,
+                                    bufferSlicePitch, hostRowPitch,
+                                    hostSlicePitch, pDst, numEventsInWaitList,
+                                    phEventWaitList, phEvent);
+    }
+
     ur_enqueue_mem_buffer_read_rect_params_t params = {&hQueue,
                                                        &hBuffer,
                                                        &blockingRead,
@@ -2936,7 +3391,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
                                                        &phEvent};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT,
-                             "urEnqueueMemBufferReadRect", &params);
+                             "urEnqueueMemBufferReadRect", &params, hQueue);
 
     ur_result_t result = pfnMemBufferReadRect(
         hQueue, hBuffer, blockingRead, bufferOrigin, hostOrigin, region,
@@ -2991,6 +3446,15 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT)) {
+        return pfnMemBufferWriteRect(hQueue, hBuffer, blockingWrite,
+                                     bufferOrigin, hostOrigin, region,
+                                     bufferRowPitch, bufferSlicePitch,
+                                     hostRowPitch, hostSlicePitch, pSrc,
+                                     numEventsInWaitList, phEventWaitList,
+                                     phEvent);
+    }
+
     ur_enqueue_mem_buffer_write_rect_params_t params = {&hQueue,
                                                         &hBuffer,
                                                         &blockingWrite,
@@ -3007,7 +3471,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
                                                         &phEvent};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT,
-                             "urEnqueueMemBufferWriteRect", &params);
+                             "urEnqueueMemBufferWriteRect", &params, hQueue);
 
     ur_result_t result = pfnMemBufferWriteRect(
         hQueue, hBuffer, blockingWrite, bufferOrigin, hostOrigin, region,
@@ -3046,11 +3510,18 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY)) {
+        return pfnMemBufferCopy(hQueue, hBufferSrc, hBufferDst, srcOffset,
+                                dstOffset, size, numEventsInWaitList,
+                                phEventWaitList, phEvent);
+    }
+
     ur_enqueue_mem_buffer_copy_params_t params = {
         &hQueue, &hBufferSrc,          &hBufferDst,      &srcOffset, &dstOffset,
         &size,   &numEventsInWaitList, &phEventWaitList, &phEvent};
-    uint64_t instance = context.notify_begin(
-        UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY, "urEnqueueMemBufferCopy", &params);
+    uint64_t instance =
+        context.notify_begin(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY,
+                             "urEnqueueMemBufferCopy", &params, hQueue);
 
     ur_result_t result =
         pfnMemBufferCopy(hQueue, hBufferSrc, hBufferDst, srcOffset, dstOffset,
@@ -3096,6 +3567,14 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT)) {
+        return pfnMemBufferCopyRect(hQueue, hBufferSrc, hBufferDst, srcOrigin,
+                                    dstOrigin, region, srcRowPitch,
+                                    srcSlicePitch, dstRowPitch, dstSlicePitch,
+                                    numEventsInWaitList, phEventWaitList,
+                                    phEvent);
+    }
+
     ur_enqueue_mem_buffer_copy_rect_params_t params = {
         &hQueue,      &hBufferSrc,    &hBufferDst,          &srcOrigin,
         &dstOrigin,   &region,        &srcRowPitch,         &srcSlicePitch,
@@ -3103,7 +3582,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
         &phEvent};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT,
-                             "urEnqueueMemBufferCopyRect", &params);
+                             "urEnqueueMemBufferCopyRect", &params, hQueue);
 
     ur_result_t result = pfnMemBufferCopyRect(
         hQueue, hBufferSrc, hBufferDst, srcOrigin, dstOrigin, region,
@@ -3142,6 +3621,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL)) {
+        return pfnMemBufferFill(hQueue, hBuffer, pPattern, patternSize, offset,
+                                size, numEventsInWaitList, phEventWaitList,
+                                phEvent);
+    }
+
     ur_enqueue_mem_buffer_fill_params_t params = {&hQueue,
                                                   &hBuffer,
                                                   &pPattern,
@@ -3151,8 +3636,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
                                                   &numEventsInWaitList,
                                                   &phEventWaitList,
                                                   &phEvent};
-    uint64_t instance = context.notify_begin(
-        UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL, "urEnqueueMemBufferFill", &params);
+    uint64_t instance =
+        context.notify_begin(UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL,
+                             "urEnqueueMemBufferFill", &params, hQueue);
 
     ur_result_t result =
         pfnMemBufferFill(hQueue, hBuffer, pPattern, patternSize, offset, size,
@@ -3194,13 +3680,20 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ)) {
+        return pfnMemImageRead(hQueue, hImage, blockingRead, origin, region,
+                               rowPitch, slicePitch, pDst, numEventsInWaitList,
+                               phEventWaitList, phEvent);
+    }
+
     ur_enqueue_mem_image_read_params_t params = {
         &hQueue,          &hImage, &blockingRead,
         &origin,          &region, &rowPitch,
         &slicePitch,      &pDst,   &numEventsInWaitList,
         &phEventWaitList, &phEvent};
     uint64_t instance = context.notify_begin(UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ,
-                                             "urEnqueueMemImageRead", &params);
+                                             "urEnqueueMemImageRead", &params,
+                                             hQueue);
 
     ur_result_t result = pfnMemImageRead(
         hQueue, hImage, blockingRead, origin, region, rowPitch, slicePitch,
@@ -3243,13 +3736,20 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE)) {
+        return pfnMemImageWrite(hQueue, hImage, blockingWrite, origin, region,
+                                rowPitch, slicePitch, pSrc, numEventsInWaitList,
+                                phEventWaitList, phEvent);
+    }
+
     ur_enqueue_mem_image_write_params_t params = {
         &hQueue,          &hImage, &blockingWrite,
         &origin,          &region, &rowPitch,
         &slicePitch,      &pSrc,   &numEventsInWaitList,
         &phEventWaitList, &phEvent};
-    uint64_t instance = context.notify_begin(
-        UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE, "urEnqueueMemImageWrite", &params);
+    uint64_t instance =
+        context.notify_begin(UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE,
+                             "urEnqueueMemImageWrite", &params, hQueue);
 
     ur_result_t result = pfnMemImageWrite(
         hQueue, hImage, blockingWrite, origin, region, rowPitch, slicePitch,
@@ -3292,11 +3792,18 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageCopy(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY)) {
+        return pfnMemImageCopy(hQueue, hImageSrc, hImageDst, srcOrigin,
+                               dstOrigin, region, numEventsInWaitList,
+                               phEventWaitList, phEvent);
+    }
+
     ur_enqueue_mem_image_copy_params_t params = {
         &hQueue, &hImageSrc,           &hImageDst,       &srcOrigin, &dstOrigin,
         &region, &numEventsInWaitList, &phEventWaitList, &phEvent};
     uint64_t instance = context.notify_begin(UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY,
-                                             "urEnqueueMemImageCopy", &params);
+                                             "urEnqueueMemImageCopy", &params,
+                                             hQueue);
 
     ur_result_t result =
         pfnMemImageCopy(hQueue, hImageSrc, hImageDst, srcOrigin, dstOrigin,
@@ -3335,12 +3842,19 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP)) {
+        return pfnMemBufferMap(hQueue, hBuffer, blockingMap, mapFlags, offset,
+                               size, numEventsInWaitList, phEventWaitList,
+                               phEvent, ppRetMap);
+    }
+
     ur_enqueue_mem_buffer_map_params_t params = {
         &hQueue,  &hBuffer, &blockingMap,         &mapFlags,
         &offset,  &size,    &numEventsInWaitList, &phEventWaitList,
         &phEvent, &ppRetMap};
     uint64_t instance = context.notify_begin(UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP,
-                                             "urEnqueueMemBufferMap", &params);
+                                             "urEnqueueMemBufferMap", &params,
+                                             hQueue);
 
     ur_result_t result = pfnMemBufferMap(hQueue, hBuffer, blockingMap, mapFlags,
                                          offset, size, numEventsInWaitList,
@@ -3375,11 +3889,16 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_ENQUEUE_MEM_UNMAP)) {
+        return pfnMemUnmap(hQueue, hMem, pMappedPtr, numEventsInWaitList,
+                           phEventWaitList, phEvent);
+    }
+
     ur_enqueue_mem_unmap_params_t params = {
         &hQueue,          &hMem,   &pMappedPtr, &numEventsInWaitList,
         &phEventWaitList, &phEvent};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_ENQUEUE_MEM_UNMAP,
-                                             "urEnqueueMemUnmap", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_ENQUEUE_MEM_UNMAP, "urEnqueueMemUnmap", &params, hQueue);
 
     ur_result_t result =
         pfnMemUnmap(hQueue, hMem, pMappedPtr, numEventsInWaitList,
@@ -3419,12 +3938,17 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_ENQUEUE_USM_FILL)) {
+        return pfnUSMFill(hQueue, ptr, patternSize, pPattern, size,
+                          numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
     ur_enqueue_usm_fill_params_t params = {
         &hQueue,          &ptr,    &patternSize,
         &pPattern,        &size,   &numEventsInWaitList,
         &phEventWaitList, &phEvent};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_ENQUEUE_USM_FILL,
-                                             "urEnqueueUSMFill", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_ENQUEUE_USM_FILL, "urEnqueueUSMFill", &params, hQueue);
 
     ur_result_t result =
         pfnUSMFill(hQueue, ptr, patternSize, pPattern, size,
@@ -3460,11 +3984,16 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_ENQUEUE_USM_MEMCPY)) {
+        return pfnUSMMemcpy(hQueue, blocking, pDst, pSrc, size,
+                            numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
     ur_enqueue_usm_memcpy_params_t params = {
         &hQueue,          &blocking, &pDst, &pSrc, &size, &numEventsInWaitList,
         &phEventWaitList, &phEvent};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_ENQUEUE_USM_MEMCPY,
-                                             "urEnqueueUSMMemcpy", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_ENQUEUE_USM_MEMCPY, "urEnqueueUSMMemcpy", &params, hQueue);
 
     ur_result_t result =
         pfnUSMMemcpy(hQueue, blocking, pDst, pSrc, size, numEventsInWaitList,
@@ -3499,11 +4028,17 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_ENQUEUE_USM_PREFETCH)) {
+        return pfnUSMPrefetch(hQueue, pMem, size, flags, numEventsInWaitList,
+                              phEventWaitList, phEvent);
+    }
+
     ur_enqueue_usm_prefetch_params_t params = {
         &hQueue,          &pMem,   &size, &flags, &numEventsInWaitList,
         &phEventWaitList, &phEvent};
     uint64_t instance = context.notify_begin(UR_FUNCTION_ENQUEUE_USM_PREFETCH,
-                                             "urEnqueueUSMPrefetch", &params);
+                                             "urEnqueueUSMPrefetch", &params,
+                                             hQueue);
 
     ur_result_t result =
         pfnUSMPrefetch(hQueue, pMem, size, flags, numEventsInWaitList,
@@ -3532,10 +4067,14 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMAdvise(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_ENQUEUE_USM_ADVISE)) {
+        return pfnUSMAdvise(hQueue, pMem, size, advice, phEvent);
+    }
+
     ur_enqueue_usm_advise_params_t params = {&hQueue, &pMem, &size, &advice,
                                              &phEvent};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_ENQUEUE_USM_ADVISE,
-                                             "urEnqueueUSMAdvise", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_ENQUEUE_USM_ADVISE, "urEnqueueUSMAdvise", &params, hQueue);
 
     ur_result_t result = pfnUSMAdvise(hQueue, pMem, size, advice, phEvent);
 
@@ -3577,12 +4116,18 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_ENQUEUE_USM_FILL2_D)) {
+        return pfnUSMFill2D(hQueue, pMem, pitch, patternSize, pPattern, width,
+                            height, numEventsInWaitList, phEventWaitList,
+                            phEvent);
+    }
+
     ur_enqueue_usm_fill2_d_params_t params = {
         &hQueue,          &pMem,   &pitch,  &patternSize,
         &pPattern,        &width,  &height, &numEventsInWaitList,
         &phEventWaitList, &phEvent};
-    uint64_t instance = context.notify_begin(UR_FUNCTION_ENQUEUE_USM_FILL2_D,
-                                             "urEnqueueUSMFill2D", &params);
+    uint64_t instance = context.notify_begin(
+        UR_FUNCTION_ENQUEUE_USM_FILL2_D, "urEnqueueUSMFill2D", &params, hQueue);
 
     ur_result_t result =
         pfnUSMFill2D(hQueue, pMem, pitch, patternSize, pPattern, width, height,
@@ -3623,13 +4168,20 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(UR_FUNCTION_ENQUEUE_USM_MEMCPY2_D)) {
+        return pfnUSMMemcpy2D(hQueue, blocking, pDst, dstPitch, pSrc, srcPitch,
+                              width, height, numEventsInWaitList,
+                              phEventWaitList, phEvent);
+    }
+
     ur_enqueue_usm_memcpy2_d_params_t params = {
         &hQueue,          &blocking, &pDst,
         &dstPitch,        &pSrc,     &srcPitch,
         &width,           &height,   &numEventsInWaitList,
         &phEventWaitList, &phEvent};
     uint64_t instance = context.notify_begin(UR_FUNCTION_ENQUEUE_USM_MEMCPY2_D,
-                                             "urEnqueueUSMMemcpy2D", &params);
+                                             "urEnqueueUSMMemcpy2D", &params,
+                                             hQueue);
 
     ur_result_t result =
         pfnUSMMemcpy2D(hQueue, blocking, pDst, dstPitch, pSrc, srcPitch, width,
@@ -3671,13 +4223,22 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(
+            UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE)) {
+        return pfnDeviceGlobalVariableWrite(hQueue, hProgram, name,
+                                            blockingWrite, count, offset, pSrc,
+                                            numEventsInWaitList,
+                                            phEventWaitList, phEvent);
+    }
+
     ur_enqueue_device_global_variable_write_params_t params = {
         &hQueue,          &hProgram, &name, &blockingWrite,
         &count,           &offset,   &pSrc, &numEventsInWaitList,
         &phEventWaitList, &phEvent};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE,
-                             "urEnqueueDeviceGlobalVariableWrite", &params);
+                             "urEnqueueDeviceGlobalVariableWrite", &params,
+                             hQueue);
 
     ur_result_t result = pfnDeviceGlobalVariableWrite(
         hQueue, hProgram, name, blockingWrite, count, offset, pSrc,
@@ -3720,13 +4281,22 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!context.is_subscribed(
+            UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ)) {
+        return pfnDeviceGlobalVariableRead(hQueue, hProgram, name, blockingRead,
+                                           count, offset, pDst,
+                                           numEventsInWaitList, phEventWaitList,
+                                           phEvent);
+    }
+
     ur_enqueue_device_global_variable_read_params_t params = {
         &hQueue,          &hProgram, &name, &blockingRead,
         &count,           &offset,   &pDst, &numEventsInWaitList,
         &phEventWaitList, &phEvent};
     uint64_t instance =
         context.notify_begin(UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ,
-                             "urEnqueueDeviceGlobalVariableRead", &params);
+                             "urEnqueueDeviceGlobalVariableRead", &params,
+                             hQueue);
 
     ur_result_t result = pfnDeviceGlobalVariableRead(
         hQueue, hProgram, name, blockingRead, count, offset, pDst,
@@ -4531,6 +5101,9 @@ ur_result_t context_t::init(ur_dditable_t *dditable) {
             UR_API_VERSION_CURRENT, &dditable->Device);
     }
 
+    // pick up the subscribers registered since the layer was created
+    refresh_subscriptions();
+
     return result;
 }
 } /* namespace ur_tracing_layer */
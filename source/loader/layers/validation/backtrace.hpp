@@ -10,7 +10,26 @@
 namespace ur_validation_layer {
 
 using BacktraceLine = std::string;
-std::vector<BacktraceLine> getCurrentBacktrace();
+
+/// return addresses of the frames of a call stack
+using BacktraceFrames = std::vector<void *>;
+
+/// captures the call stack without symbolizing it, which is left to
+/// symbolizeBacktrace once the backtrace has to be printed
+BacktraceFrames getCurrentBacktrace();
+
+std::vector<BacktraceLine> symbolizeBacktrace(const BacktraceFrames &frames);
+
+struct BacktraceHash {
+    size_t operator()(const BacktraceFrames &frames) const {
+        uint64_t hash = frames.size();
+        for (void *frame : frames) {
+            hash = (hash ^ reinterpret_cast<uintptr_t>(frame)) *
+                   0x100000001B3ull;
+        }
+        return static_cast<size_t>(hash);
+    }
+};
 
 } // namespace ur_validation_layer
 
@@ -68,14 +68,48 @@ int backtrace_cb(void *data, uintptr_t pc, const char *filename, int lineno,
     return 0;
 }
 
-std::vector<BacktraceLine> getCurrentBacktrace() {
-    backtrace_state *state = backtrace_create_state(NULL, 0, NULL, NULL);
+/// the state is created once, libbacktrace never frees it
+backtrace_state *getBacktraceState() {
+    static backtrace_state *state =
+        backtrace_create_state(NULL, 1 /* threaded */, NULL, NULL);
+    return state;
+}
+
+int backtrace_simple_cb(void *data, uintptr_t pc) {
+    BacktraceFrames *frames = reinterpret_cast<BacktraceFrames *>(data);
+    frames->push_back(reinterpret_cast<void *>(pc));
+    return frames->size() < MAX_BACKTRACE_FRAMES ? 0 : 1;
+}
+
+BacktraceFrames getCurrentBacktrace() {
+    BacktraceFrames frames;
+    backtrace_state *state = getBacktraceState();
+    if (state == NULL) {
+        return frames;
+    }
+
+    // the callback stops at the reserved size, so that it never allocates
+    try {
+        frames.reserve(MAX_BACKTRACE_FRAMES);
+    } catch (std::bad_alloc &) {
+        return frames;
+    }
+    backtrace_simple(state, 0, backtrace_simple_cb, NULL, &frames);
+
+    return frames;
+}
+
+std::vector<BacktraceLine> symbolizeBacktrace(const BacktraceFrames &frames) {
+    backtrace_state *state = getBacktraceState();
     if (state == NULL) {
         return std::vector<std::string>(1, "Failed to acquire a backtrace");
     }
 
     std::vector<BacktraceLine> backtrace;
-    backtrace_full(state, 0, backtrace_cb, NULL, &backtrace);
+    for (void *frame : frames) {
+        backtrace_pcinfo(state, reinterpret_cast<uintptr_t>(frame),
+                         backtrace_cb, NULL, &backtrace);
+    }
     if (backtrace.empty()) {
         return std::vector<std::string>(1, "Failed to acquire a backtrace");
     }
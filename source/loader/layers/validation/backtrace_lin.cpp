@@ -12,10 +12,20 @@
 
 namespace ur_validation_layer {
 
-std::vector<BacktraceLine> getCurrentBacktrace() {
+BacktraceFrames getCurrentBacktrace() {
     void *backtraceFrames[MAX_BACKTRACE_FRAMES];
     int frameCount = backtrace(backtraceFrames, MAX_BACKTRACE_FRAMES);
-    char **backtraceStr = backtrace_symbols(backtraceFrames, frameCount);
+
+    return BacktraceFrames(backtraceFrames, backtraceFrames + frameCount);
+}
+
+std::vector<BacktraceLine> symbolizeBacktrace(const BacktraceFrames &frames) {
+    if (frames.empty()) {
+        return std::vector<BacktraceLine>(1, "Failed to acquire a backtrace");
+    }
+
+    char **backtraceStr = backtrace_symbols(const_cast<void **>(frames.data()),
+                                            static_cast<int>(frames.size()));
 
     if (backtraceStr == nullptr) {
         return std::vector<BacktraceLine>(1, "Failed to acquire a backtrace");
@@ -23,7 +33,7 @@ std::vector<BacktraceLine> getCurrentBacktrace() {
 
     std::vector<BacktraceLine> backtrace;
     try {
-        for (int i = 0; i < frameCount; i++) {
+        for (size_t i = 0; i < frames.size(); i++) {
             backtrace.emplace_back(backtraceStr[i]);
         }
     } catch (std::bad_alloc &) {
@@ -4,11 +4,17 @@
 #define UR_LEAK_CHECK_H 1
 
 #include "backtrace.hpp"
+#include "ur_live_handles.hpp"
 #include "ur_validation_layer.hpp"
 
+#include <algorithm>
+#include <array>
 #include <mutex>
+#include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 #define MAX_BACKTRACE_FRAMES 64
 
@@ -18,60 +24,130 @@ struct RefCountContext {
   private:
     struct RefRuntimeInfo {
         int64_t refCount;
-        std::vector<BacktraceLine> backtrace;
+        /// the interned backtrace of where the handle was first recorded
+        const BacktraceFrames *backtrace;
     };
 
     enum RefCountUpdateType {
         REFCOUNT_CREATE,
         REFCOUNT_INCREASE,
         REFCOUNT_DECREASE,
+        REFCOUNT_RESTORE,
     };
 
-    std::mutex mutex;
-    std::unordered_map<void *, struct RefRuntimeInfo> counts;
+    /// the handles are spread over shards with their own lock, so that the
+    /// threads updating different handles do not contend
+    static constexpr unsigned SHARD_BITS = 6;
+    static constexpr size_t SHARD_COUNT = 1 << SHARD_BITS;
+
+    /// the handles listed for a call site in the leak report
+    static constexpr size_t MAX_REPORTED_HANDLES_PER_SITE = 16;
+
+    struct alignas(64) Shard {
+        std::mutex mutex;
+        std::unordered_map<void *, struct RefRuntimeInfo> counts;
+        /// the handles of the shard with a positive reference count, which
+        /// the lifetime validation looks up without taking the lock
+        LiveHandleSet live;
+    };
+
+    std::array<Shard, SHARD_COUNT> shards;
+
+    /// every distinct backtrace is stored once, and shared by all the handles
+    /// created from the same call site, also spread over shards
+    struct alignas(64) BacktraceShard {
+        std::mutex mutex;
+        std::unordered_set<BacktraceFrames, BacktraceHash> backtraces;
+    };
+
+    std::array<BacktraceShard, SHARD_COUNT> backtraceShards;
+
+    static size_t getShardIndex(uint64_t hash) {
+        return (hash * 0x9E3779B97F4A7C15ull) >> (64 - SHARD_BITS);
+    }
+
+    Shard &getShard(void *ptr) {
+        // handles are aligned allocations, the low bits do not tell them apart
+        return shards[getShardIndex(reinterpret_cast<uintptr_t>(ptr))];
+    }
+
+    /// the interned backtraces are kept until the context is destroyed, so
+    /// that the handles can refer to them without a reference count
+    const BacktraceFrames *internBacktrace(BacktraceFrames &&frames) {
+        auto &shard = backtraceShards[getShardIndex(BacktraceHash()(frames))];
+        std::scoped_lock<std::mutex> lock(shard.mutex);
+        return &*shard.backtraces.insert(std::move(frames)).first;
+    }
 
     void updateRefCount(void *ptr, enum RefCountUpdateType type) {
-        std::unique_lock<std::mutex> ulock(mutex);
+        // the backtrace is captured before taking the lock, and it is only
+        // symbolized if the handle leaks
+        const BacktraceFrames *backtrace = nullptr;
+        if (type == REFCOUNT_CREATE) {
+            backtrace = internBacktrace(getCurrentBacktrace());
+        }
 
-        auto it = counts.find(ptr);
+        auto &shard = getShard(ptr);
+        std::unique_lock<std::mutex> ulock(shard.mutex);
 
+        // a single lookup of the handle per update
+        auto it = shard.counts.end();
         switch (type) {
-        case REFCOUNT_CREATE:
-            if (it == counts.end()) {
-                counts[ptr] = {1, getCurrentBacktrace()};
-            } else {
+        case REFCOUNT_CREATE: {
+            bool inserted = false;
+            std::tie(it, inserted) =
+                shard.counts.try_emplace(ptr, RefRuntimeInfo{1, backtrace});
+            if (!inserted) {
                 context.logger.error("Handle {} already exists", ptr);
                 return;
             }
-            break;
+            shard.live.insert(ptr);
+        } break;
         case REFCOUNT_INCREASE:
-            if (it == counts.end()) {
+            it = shard.counts.find(ptr);
+            if (it == shard.counts.end()) {
                 context.logger.error(
                     "Attempting to retain nonexistent handle {}", ptr);
                 return;
             } else {
-                counts[ptr].refCount++;
+                it->second.refCount++;
             }
             break;
-        case REFCOUNT_DECREASE:
-            if (it == counts.end()) {
-                counts[ptr] = {-1, getCurrentBacktrace()};
-            } else {
-                counts[ptr].refCount--;
+        case REFCOUNT_DECREASE: {
+            bool inserted = false;
+            std::tie(it, inserted) =
+                shard.counts.try_emplace(ptr, RefRuntimeInfo{0, nullptr});
+            if (inserted) {
+                it->second.backtrace = internBacktrace(getCurrentBacktrace());
             }
+            it->second.refCount--;
 
-            if (counts[ptr].refCount < 0) {
+            if (it->second.refCount < 0) {
                 context.logger.error(
                     "Attempting to release nonexistent handle {}", ptr);
             }
-            break;
+        } break;
+        case REFCOUNT_RESTORE: {
+            // the release the reference count was decreased for failed
+            bool inserted = false;
+            std::tie(it, inserted) =
+                shard.counts.try_emplace(ptr, RefRuntimeInfo{0, nullptr});
+            if (inserted) {
+                it->second.backtrace = internBacktrace(getCurrentBacktrace());
+            }
+            it->second.refCount++;
+            if (it->second.refCount > 0) {
+                shard.live.insert(ptr);
+            }
+        } break;
         }
 
         context.logger.debug("Reference count for handle {} changed to {}", ptr,
-                             counts[ptr].refCount);
+                             it->second.refCount);
 
-        if (counts[ptr].refCount == 0) {
-            counts.erase(ptr);
+        if (it->second.refCount == 0) {
+            shard.counts.erase(it);
+            shard.live.erase(ptr);
         }
     }
 
@@ -86,17 +162,81 @@ struct RefCountContext {
         updateRefCount(ptr, REFCOUNT_DECREASE);
     }
 
-    void clear() { counts.clear(); }
+    void restoreRefCount(void *ptr) { updateRefCount(ptr, REFCOUNT_RESTORE); }
+
+    /// whether a handle was created and not released yet, which only reads
+    /// the set of live handles of its shard
+    bool isLive(void *ptr, const char *function) {
+        if (getShard(ptr).live.contains(ptr)) {
+            return true;
+        }
+        context.logger.error(
+            "{} called with handle {}, which was released or never created",
+            function, ptr);
+        return false;
+    }
 
+    void clear() {
+        for (auto &shard : shards) {
+            std::scoped_lock<std::mutex> lock(shard.mutex);
+            shard.counts.clear();
+            shard.live.clear();
+        }
+    }
+
+    /// the leaked handles are reported grouped by the backtrace of where
+    /// they were first recorded, the call sites with the most handles first
     void logInvalidReferences() {
-        for (auto &[ptr, refRuntimeInfo] : counts) {
-            context.logger.error("Retained {} reference(s) to handle {}",
-                                 refRuntimeInfo.refCount, ptr);
-            context.logger.error("Handle {} was recorded for first time here:",
-                                 ptr);
-            for (size_t i = 0; i < refRuntimeInfo.backtrace.size(); i++) {
-                context.logger.error("#{} {}", i,
-                                     refRuntimeInfo.backtrace[i].c_str());
+        struct LeakSite {
+            const BacktraceFrames *backtrace;
+            std::vector<std::pair<void *, int64_t>> handles;
+            int64_t refCount = 0;
+        };
+
+        std::unordered_map<const BacktraceFrames *, LeakSite> sitesMap;
+        for (auto &shard : shards) {
+            std::scoped_lock<std::mutex> lock(shard.mutex);
+            for (auto &[ptr, refRuntimeInfo] : shard.counts) {
+                auto &site = sitesMap[refRuntimeInfo.backtrace];
+                site.backtrace = refRuntimeInfo.backtrace;
+                site.handles.emplace_back(ptr, refRuntimeInfo.refCount);
+                site.refCount += refRuntimeInfo.refCount;
+            }
+        }
+
+        std::vector<LeakSite *> sites;
+        for (auto &[backtrace, site] : sitesMap) {
+            sites.push_back(&site);
+        }
+        std::sort(sites.begin(), sites.end(), [](auto *a, auto *b) {
+            return a->handles.size() > b->handles.size();
+        });
+
+        for (auto *site : sites) {
+            size_t reported =
+                std::min(site->handles.size(), MAX_REPORTED_HANDLES_PER_SITE);
+            for (size_t i = 0; i < reported; i++) {
+                context.logger.error("Retained {} reference(s) to handle {}",
+                                     site->handles[i].second,
+                                     site->handles[i].first);
+            }
+            if (site->handles.size() > reported) {
+                context.logger.error("... and {} more handle(s)",
+                                     site->handles.size() - reported);
+            }
+
+            if (site->handles.size() == 1) {
+                context.logger.error(
+                    "Handle {} was recorded for first time here:",
+                    site->handles[0].first);
+            } else {
+                context.logger.error("{} handles with {} retained reference(s) "
+                                     "were recorded for first time here:",
+                                     site->handles.size(), site->refCount);
+            }
+            auto backtrace = symbolizeBacktrace(*site->backtrace);
+            for (size_t i = 0; i < backtrace.size(); i++) {
+                context.logger.error("#{} {}", i, backtrace[i].c_str());
             }
         }
     }
@@ -0,0 +1,217 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: MIT
+#ifndef UR_LIVE_HANDLES_H
+#define UR_LIVE_HANDLES_H 1
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ur_validation_layer {
+
+/// counts the threads reading the live handle sets, so that their retired
+/// tables are only freed once no thread can still be probing them
+///
+/// the count is spread over cache lines by thread, so that the readers do
+/// not contend on it
+class LiveHandleReaders {
+    static constexpr size_t STRIPE_COUNT = 64;
+
+    struct alignas(64) Stripe {
+        std::atomic<uint32_t> count{0};
+    };
+
+    std::array<Stripe, STRIPE_COUNT> stripes;
+
+    static size_t getStripeIndex() {
+        static std::atomic<size_t> threads{0};
+        thread_local size_t index = threads++ % STRIPE_COUNT;
+        return index;
+    }
+
+  public:
+    class Guard {
+        std::atomic<uint32_t> &count;
+
+      public:
+        explicit Guard(LiveHandleReaders &readers)
+            : count(readers.stripes[getStripeIndex()].count) {
+            count.fetch_add(1);
+        }
+        ~Guard() { count.fetch_sub(1); }
+        Guard(const Guard &) = delete;
+        Guard &operator=(const Guard &) = delete;
+    };
+
+    /// whether no thread, that could have loaded a table before it was
+    /// replaced, is still reading
+    bool idle() const {
+        for (auto &stripe : stripes) {
+            if (stripe.count.load() != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+/// set of the handles with a positive reference count, which is read without
+/// a lock
+///
+/// the writers are serialized by the caller, and they only turn an empty slot
+/// of the open addressing table into a handle, and a handle into a tombstone,
+/// so that a reader probing the table concurrently sees each slot either
+/// before or after the update. When the handles and the tombstones fill half
+/// of the table, the live handles are copied to a new table, which replaces
+/// the old one for the readers that come after.
+class LiveHandleSet {
+    static constexpr uintptr_t EMPTY = 0;
+    static constexpr uintptr_t TOMBSTONE = 1;
+    static constexpr size_t MIN_CAPACITY = 16;
+
+    struct Table {
+        explicit Table(size_t capacity)
+            : mask(capacity - 1),
+              slots(new std::atomic<uintptr_t>[capacity]()) {}
+
+        size_t capacity() const { return mask + 1; }
+
+        size_t mask;
+        std::unique_ptr<std::atomic<uintptr_t>[]> slots;
+    };
+
+    /// shared by all the sets, a reader only probes a single one at a time
+    static inline LiveHandleReaders readers;
+    std::atomic<Table *> table{nullptr};
+    std::unique_ptr<Table> current;
+    /// the replaced tables that readers may still be probing
+    std::vector<std::unique_ptr<Table>> retired;
+    /// slots holding a handle, and holding a handle or a tombstone
+    size_t live = 0;
+    size_t used = 0;
+
+    static size_t hash(uintptr_t handle) {
+        // the shard of the handle was picked from the high bits of the same
+        // product, the table slot comes from the bits below them
+        return static_cast<size_t>((handle * 0x9E3779B97F4A7C15ull) >> 24);
+    }
+
+    /// makes a table the one the readers probe, and frees the replaced ones
+    /// if no reader is left
+    void publish(std::unique_ptr<Table> next) {
+        table.store(next.get());
+        if (current) {
+            retired.push_back(std::move(current));
+        }
+        current = std::move(next);
+        if (readers.idle()) {
+            retired.clear();
+        }
+    }
+
+    void rebuild(size_t capacity) {
+        auto rebuilt = std::make_unique<Table>(capacity);
+        for (size_t i = 0; current && i < current->capacity(); i++) {
+            uintptr_t handle = current->slots[i].load();
+            if (handle == EMPTY || handle == TOMBSTONE) {
+                continue;
+            }
+            size_t slot = hash(handle) & rebuilt->mask;
+            while (rebuilt->slots[slot].load() != EMPTY) {
+                slot = (slot + 1) & rebuilt->mask;
+            }
+            rebuilt->slots[slot].store(handle);
+        }
+        used = live;
+        publish(std::move(rebuilt));
+    }
+
+  public:
+    bool contains(void *ptr) {
+        auto handle = reinterpret_cast<uintptr_t>(ptr);
+        LiveHandleReaders::Guard guard(readers);
+        const Table *t = table.load();
+        if (t == nullptr || handle == EMPTY || handle == TOMBSTONE) {
+            return false;
+        }
+        // there is always an empty slot ending the probe
+        for (size_t slot = hash(handle) & t->mask;;
+             slot = (slot + 1) & t->mask) {
+            uintptr_t value = t->slots[slot].load(std::memory_order_acquire);
+            if (value == handle) {
+                return true;
+            }
+            if (value == EMPTY) {
+                return false;
+            }
+        }
+    }
+
+    void insert(void *ptr) {
+        auto handle = reinterpret_cast<uintptr_t>(ptr);
+        if (handle == EMPTY || handle == TOMBSTONE) {
+            return;
+        }
+        if (!current || (used + 1) * 2 > current->capacity()) {
+            size_t capacity = MIN_CAPACITY;
+            while (capacity < (live + 1) * 4) {
+                capacity *= 2;
+            }
+            rebuild(capacity);
+        }
+
+        std::atomic<uintptr_t> *free = nullptr;
+        size_t slot = hash(handle) & current->mask;
+        for (;; slot = (slot + 1) & current->mask) {
+            uintptr_t value = current->slots[slot].load();
+            if (value == handle) {
+                return;
+            }
+            if (value == TOMBSTONE && free == nullptr) {
+                free = &current->slots[slot];
+            }
+            if (value == EMPTY) {
+                break;
+            }
+        }
+        if (free == nullptr) {
+            free = &current->slots[slot];
+            used++;
+        }
+        free->store(handle, std::memory_order_release);
+        live++;
+    }
+
+    void erase(void *ptr) {
+        auto handle = reinterpret_cast<uintptr_t>(ptr);
+        if (!current || handle == EMPTY || handle == TOMBSTONE) {
+            return;
+        }
+        for (size_t slot = hash(handle) & current->mask;;
+             slot = (slot + 1) & current->mask) {
+            uintptr_t value = current->slots[slot].load();
+            if (value == handle) {
+                current->slots[slot].store(TOMBSTONE,
+                                           std::memory_order_release);
+                live--;
+                return;
+            }
+            if (value == EMPTY) {
+                return;
+            }
+        }
+    }
+
+    void clear() {
+        live = 0;
+        used = 0;
+        publish(std::make_unique<Table>(MIN_CAPACITY));
+    }
+};
+
+} // namespace ur_validation_layer
+
+#endif /* UR_LIVE_HANDLES_H */
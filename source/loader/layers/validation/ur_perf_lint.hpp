@@ -0,0 +1,243 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: MIT
+#ifndef UR_PERF_LINT_H
+#define UR_PERF_LINT_H 1
+
+#include "backtrace.hpp"
+#include "ur_validation_layer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace ur_validation_layer {
+
+struct PerfLintContext {
+  private:
+    enum LintKind {
+        LINT_REPEATED_BLOCKING_READ,
+        LINT_FINISH_AFTER_EACH_ENQUEUE,
+        LINT_UNCHANGED_ARG_VALUE,
+        LINT_REPEATED_TINY_COPY,
+        LINT_IDENTICAL_PROGRAM_IL,
+        LINT_KIND_COUNT,
+    };
+
+    /// the copies worth batching with the ones around them
+    static constexpr size_t TINY_COPY_SIZE = 256;
+
+    struct Finding {
+        uint64_t count = 0;
+        BacktraceFrames firstBacktrace;
+    };
+
+    std::mutex mutex;
+    std::array<Finding, LINT_KIND_COUNT> findings;
+    /// calls per call site, for the patterns that are only slow when they
+    /// are repeated from the same place, e.g. in a loop
+    std::array<std::unordered_map<BacktraceFrames, uint64_t, BacktraceHash>,
+               LINT_KIND_COUNT>
+        sites;
+    std::unordered_map<void *, uint64_t> enqueuesSinceFinish;
+    std::unordered_map<void *,
+                       std::unordered_map<uint32_t, std::vector<uint8_t>>>
+        argValues;
+    /// the program of each kernel, to forget the argument values of its
+    /// kernels when it is released
+    std::unordered_map<void *, void *> kernelPrograms;
+    /// hashes of the IL the programs of each context were created with
+    std::unordered_map<void *, std::unordered_set<uint64_t>> programILs;
+
+    static const char *getDescription(LintKind kind) {
+        switch (kind) {
+        case LINT_REPEATED_BLOCKING_READ:
+            return "blocking urEnqueueMemBufferRead issued again from the "
+                   "same call site";
+        case LINT_FINISH_AFTER_EACH_ENQUEUE:
+            return "urQueueFinish called after a single enqueue, again from "
+                   "the same call site";
+        case LINT_UNCHANGED_ARG_VALUE:
+            return "urKernelSetArgValue set an argument to its current value";
+        case LINT_REPEATED_TINY_COPY:
+            return "urEnqueueUSMMemcpy of less than 256 bytes issued again "
+                   "from the same call site";
+        case LINT_IDENTICAL_PROGRAM_IL:
+            return "urProgramCreateWithIL called with IL already used in the "
+                   "context";
+        default:
+            return "unknown";
+        }
+    }
+
+    void record(LintKind kind, BacktraceFrames &&backtrace) {
+        std::scoped_lock<std::mutex> lock(mutex);
+        auto &finding = findings[kind];
+        if (finding.count++ == 0) {
+            finding.firstBacktrace = std::move(backtrace);
+        }
+    }
+
+    /// records the call if its call site made the same call before
+    void recordRepeated(LintKind kind) {
+        // the backtrace is captured before taking the lock
+        auto backtrace = getCurrentBacktrace();
+        std::scoped_lock<std::mutex> lock(mutex);
+        if (sites[kind][backtrace]++ == 0) {
+            return;
+        }
+        auto &finding = findings[kind];
+        if (finding.count++ == 0) {
+            finding.firstBacktrace = std::move(backtrace);
+        }
+    }
+
+  public:
+    void onEnqueue(void *queue) {
+        std::scoped_lock<std::mutex> lock(mutex);
+        enqueuesSinceFinish[queue]++;
+    }
+
+    void onQueueFinish(void *queue) {
+        bool single = false;
+        {
+            std::scoped_lock<std::mutex> lock(mutex);
+            auto &enqueues = enqueuesSinceFinish[queue];
+            single = enqueues == 1;
+            enqueues = 0;
+        }
+        if (single) {
+            recordRepeated(LINT_FINISH_AFTER_EACH_ENQUEUE);
+        }
+    }
+
+    void onQueueRelease(void *queue) {
+        std::scoped_lock<std::mutex> lock(mutex);
+        enqueuesSinceFinish.erase(queue);
+    }
+
+    void onMemBufferRead(bool blocking) {
+        if (blocking) {
+            recordRepeated(LINT_REPEATED_BLOCKING_READ);
+        }
+    }
+
+    void onUSMMemcpy(size_t size) {
+        if (size < TINY_COPY_SIZE) {
+            recordRepeated(LINT_REPEATED_TINY_COPY);
+        }
+    }
+
+    void onKernelSetArgValue(void *kernel, uint32_t index, size_t size,
+                             const void *value) {
+        auto bytes = static_cast<const uint8_t *>(value);
+        bool unchanged = false;
+        {
+            std::scoped_lock<std::mutex> lock(mutex);
+            auto &current = argValues[kernel][index];
+            unchanged = current.size() == size &&
+                        std::equal(current.begin(), current.end(), bytes);
+            if (!unchanged) {
+                current.assign(bytes, bytes + size);
+            }
+        }
+        if (unchanged) {
+            record(LINT_UNCHANGED_ARG_VALUE, getCurrentBacktrace());
+        }
+    }
+
+    /// an argument set by other means no longer holds the value
+    void onKernelSetArg(void *kernel, uint32_t index) {
+        std::scoped_lock<std::mutex> lock(mutex);
+        auto values = argValues.find(kernel);
+        if (values != argValues.end()) {
+            values->second.erase(index);
+        }
+    }
+
+    void onKernelCreate(void *program, void *kernel) {
+        std::scoped_lock<std::mutex> lock(mutex);
+        kernelPrograms[kernel] = program;
+    }
+
+    /// the values are forgotten at any release, so that a kernel created
+    /// at the address of a destroyed one does not inherit them
+    void onKernelRelease(void *kernel) {
+        std::scoped_lock<std::mutex> lock(mutex);
+        argValues.erase(kernel);
+        kernelPrograms.erase(kernel);
+    }
+
+    void onProgramRelease(void *program) {
+        std::scoped_lock<std::mutex> lock(mutex);
+        for (auto it = kernelPrograms.begin(); it != kernelPrograms.end();) {
+            if (it->second == program) {
+                argValues.erase(it->first);
+                it = kernelPrograms.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    void onProgramCreateWithIL(void *context, const void *il, size_t length) {
+        auto bytes = static_cast<const uint8_t *>(il);
+        uint64_t hash = 0xCBF29CE484222325ull ^ length;
+        for (size_t i = 0; i < length; i++) {
+            hash = (hash ^ bytes[i]) * 0x100000001B3ull;
+        }
+
+        bool seen = false;
+        {
+            std::scoped_lock<std::mutex> lock(mutex);
+            seen = !programILs[context].insert(hash).second;
+        }
+        if (seen) {
+            record(LINT_IDENTICAL_PROGRAM_IL, getCurrentBacktrace());
+        }
+    }
+
+    /// likewise for the IL of the programs of a context
+    void onContextRelease(void *context) {
+        std::scoped_lock<std::mutex> lock(mutex);
+        programILs.erase(context);
+    }
+
+    void clear() {
+        std::scoped_lock<std::mutex> lock(mutex);
+        findings = {};
+        for (auto &site : sites) {
+            site.clear();
+        }
+        enqueuesSinceFinish.clear();
+        argValues.clear();
+        kernelPrograms.clear();
+        programILs.clear();
+    }
+
+    void logFindings() {
+        std::scoped_lock<std::mutex> lock(mutex);
+        for (size_t kind = 0; kind < LINT_KIND_COUNT; kind++) {
+            auto &finding = findings[kind];
+            if (finding.count == 0) {
+                continue;
+            }
+            context.logger.warning(
+                "Performance: {}, {} time(s), first here:",
+                getDescription(static_cast<LintKind>(kind)), finding.count);
+            auto backtrace = symbolizeBacktrace(finding.firstBacktrace);
+            for (size_t i = 0; i < backtrace.size(); i++) {
+                context.logger.warning("#{} {}", i, backtrace[i].c_str());
+            }
+        }
+    }
+
+} perfLintContext;
+
+} // namespace ur_validation_layer
+
+#endif /* UR_PERF_LINT_H */
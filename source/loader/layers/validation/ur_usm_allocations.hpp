@@ -0,0 +1,93 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: MIT
+#ifndef UR_USM_ALLOCATIONS_H
+#define UR_USM_ALLOCATIONS_H 1
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+
+namespace ur_validation_layer {
+
+/// whether the ranges [a, a + size) and [b, b + size) overlap
+inline bool rangesOverlap(const void *a, const void *b, size_t size) {
+    auto first = reinterpret_cast<uintptr_t>(a);
+    auto second = reinterpret_cast<uintptr_t>(b);
+    return first < second + size && second < first + size;
+}
+
+/// whether a row of the 2D region at dst overlaps a row of the one at src,
+/// the pitches are at least width, and height is not 0
+inline bool regionsOverlap2D(const void *dst, size_t dstPitch,
+                             const void *src, size_t srcPitch, size_t width,
+                             size_t height) {
+    auto d = reinterpret_cast<uintptr_t>(dst);
+    auto s = reinterpret_cast<uintptr_t>(src);
+    uintptr_t dstEnd = d + dstPitch * (height - 1) + width;
+    uintptr_t srcEnd = s + srcPitch * (height - 1) + width;
+    if (d >= srcEnd || s >= dstEnd) {
+        return false;
+    }
+
+    for (size_t row = 0; row < height; row++) {
+        uintptr_t begin = d + row * dstPitch;
+        // the first source row ending after the beginning of the row
+        size_t first =
+            s + width > begin ? 0 : (begin - s - width) / srcPitch + 1;
+        if (first < height && s + first * srcPitch < begin + width) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// the USM allocations made through the layer, ordered by address as in the
+/// memory tracker of UMA, so that the allocation holding a pointer is found
+/// in O(log n) under a lock shared by the readers
+struct USMAllocations {
+  private:
+    std::shared_mutex mutex;
+    std::map<uintptr_t, size_t> allocations;
+
+  public:
+    void add(const void *ptr, size_t size) {
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        // an address freed by another thread may be returned before it
+        // was removed
+        allocations[reinterpret_cast<uintptr_t>(ptr)] = size;
+    }
+
+    void remove(const void *ptr) {
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        allocations.erase(reinterpret_cast<uintptr_t>(ptr));
+    }
+
+    /// whether [ptr, ptr + size) ends within the allocation ptr points into,
+    /// a pointer to memory not allocated through the layer, e.g. to host
+    /// memory, is not checked
+    bool inBounds(const void *ptr, size_t size) {
+        auto address = reinterpret_cast<uintptr_t>(ptr);
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        auto it = allocations.upper_bound(address);
+        if (it == allocations.begin()) {
+            return true;
+        }
+        --it;
+        size_t offset = address - it->first;
+        if (offset >= it->second) {
+            return true;
+        }
+        return size <= it->second - offset;
+    }
+
+    void clear() {
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        allocations.clear();
+    }
+} usmAllocations;
+
+} // namespace ur_validation_layer
+
+#endif /* UR_USM_ALLOCATIONS_H */
@@ -8,6 +8,8 @@
  *
  */
 #include "ur_leak_check.hpp"
+#include "ur_perf_lint.hpp"
+#include "ur_usm_allocations.hpp"
 #include "ur_validation_layer.hpp"
 
 namespace ur_validation_layer {
@@ -54,11 +56,22 @@ __urdlllocal ur_result_t UR_APICALL urTearDown(
 
     ur_result_t result = pfnTearDown(pParams);
 
-    if (context.enableLeakChecking) {
-        refCountContext.logInvalidReferences();
+    if (context.enableHandleTracking) {
+        if (context.enableLeakChecking) {
+            refCountContext.logInvalidReferences();
+        }
         refCountContext.clear();
     }
 
+    if (context.enableParameterValidation) {
+        usmAllocations.clear();
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.logFindings();
+        perfLintContext.clear();
+    }
+
     return result;
 }
 
@@ -375,7 +388,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRetain(
 
     ur_result_t result = pfnRetain(hDevice);
 
-    if (context.enableLeakChecking && result == UR_RESULT_SUCCESS) {
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS) {
         refCountContext.incrementRefCount(hDevice);
     }
 
@@ -399,10 +412,16 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRelease(
         }
     }
 
+    if (context.enableHandleTracking) {
+        // the handle is forgotten before the adapter releases it, which
+        // may hand out its address to a create on another thread at once
+        refCountContext.decrementRefCount(hDevice);
+    }
+
     ur_result_t result = pfnRelease(hDevice);
 
-    if (context.enableLeakChecking && result == UR_RESULT_SUCCESS) {
-        refCountContext.decrementRefCount(hDevice);
+    if (context.enableHandleTracking && result != UR_RESULT_SUCCESS) {
+        refCountContext.restoreRefCount(hDevice);
     }
 
     return result;
@@ -549,7 +568,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
     ur_result_t result =
         pfnCreateWithNativeHandle(hNativeDevice, hPlatform, phDevice);
 
-    if (context.enableLeakChecking && result == UR_RESULT_SUCCESS) {
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS) {
         refCountContext.createRefCount(*phDevice);
     }
 
@@ -616,7 +635,7 @@ __urdlllocal ur_result_t UR_APICALL urContextCreate(
     ur_result_t result =
         pfnCreate(DeviceCount, phDevices, pProperties, phContext);
 
-    if (context.enableLeakChecking && result == UR_RESULT_SUCCESS) {
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS) {
         refCountContext.createRefCount(*phContext);
     }
 
@@ -641,9 +660,15 @@ __urdlllocal ur_result_t UR_APICALL urContextRetain(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hContext && !refCountContext.isLive(hContext, __func__)) {
+            return UR_RESULT_ERROR_INVALID_CONTEXT;
+        }
+    }
+
     ur_result_t result = pfnRetain(hContext);
 
-    if (context.enableLeakChecking && result == UR_RESULT_SUCCESS) {
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS) {
         refCountContext.incrementRefCount(hContext);
     }
 
@@ -667,12 +692,28 @@ __urdlllocal ur_result_t UR_APICALL urContextRelease(
         }
     }
 
-    ur_result_t result = pfnRelease(hContext);
+    if (context.enableLifetimeValidation) {
+        if (hContext && !refCountContext.isLive(hContext, __func__)) {
+            return UR_RESULT_ERROR_INVALID_CONTEXT;
+        }
+    }
 
-    if (context.enableLeakChecking && result == UR_RESULT_SUCCESS) {
+    if (context.enablePerfLint) {
+        perfLintContext.onContextRelease(hContext);
+    }
+
+    if (context.enableHandleTracking) {
+        // the handle is forgotten before the adapter releases it, which
+        // may hand out its address to a create on another thread at once
         refCountContext.decrementRefCount(hContext);
     }
 
+    ur_result_t result = pfnRelease(hContext);
+
+    if (context.enableHandleTracking && result != UR_RESULT_SUCCESS) {
+        refCountContext.restoreRefCount(hContext);
+    }
+
     return result;
 }
 
@@ -709,6 +750,12 @@ __urdlllocal ur_result_t UR_APICALL urContextGetInfo(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hContext && !refCountContext.isLive(hContext, __func__)) {
+            return UR_RESULT_ERROR_INVALID_CONTEXT;
+        }
+    }
+
     ur_result_t result =
         pfnGetInfo(hContext, propName, propSize, pPropValue, pPropSizeRet);
 
@@ -738,6 +785,12 @@ __urdlllocal ur_result_t UR_APICALL urContextGetNativeHandle(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hContext && !refCountContext.isLive(hContext, __func__)) {
+            return UR_RESULT_ERROR_INVALID_CONTEXT;
+        }
+    }
+
     ur_result_t result = pfnGetNativeHandle(hContext, phNativeContext);
 
     return result;
@@ -784,7 +837,7 @@ __urdlllocal ur_result_t UR_APICALL urContextCreateWithNativeHandle(
     ur_result_t result = pfnCreateWithNativeHandle(
         hNativeContext, numDevices, phDevices, pProperties, phContext);
 
-    if (context.enableLeakChecking && result == UR_RESULT_SUCCESS) {
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS) {
         refCountContext.createRefCount(*phContext);
     }
 
@@ -817,6 +870,12 @@ __urdlllocal ur_result_t UR_APICALL urContextSetExtendedDeleter(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hContext && !refCountContext.isLive(hContext, __func__)) {
+            return UR_RESULT_ERROR_INVALID_CONTEXT;
+        }
+    }
+
     ur_result_t result = pfnSetExtendedDeleter(hContext, pfnDeleter, pUserData);
 
     return result;
@@ -877,9 +936,19 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreate(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hContext && !refCountContext.isLive(hContext, __func__)) {
+            return UR_RESULT_ERROR_INVALID_CONTEXT;
+        }
+    }
+
     ur_result_t result =
         pfnImageCreate(hContext, flags, pImageFormat, pImageDesc, pHost, phMem);
 
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS) {
+        refCountContext.createRefCount(*phMem);
+    }
+
     return result;
 }
 
@@ -932,9 +1001,19 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreate(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hContext && !refCountContext.isLive(hContext, __func__)) {
+            return UR_RESULT_ERROR_INVALID_CONTEXT;
+        }
+    }
+
     ur_result_t result =
         pfnBufferCreate(hContext, flags, size, pProperties, phBuffer);
 
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS) {
+        refCountContext.createRefCount(*phBuffer);
+    }
+
     return result;
 }
 
@@ -955,9 +1034,15 @@ __urdlllocal ur_result_t UR_APICALL urMemRetain(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hMem && !refCountContext.isLive(hMem, __func__)) {
+            return UR_RESULT_ERROR_INVALID_MEM_OBJECT;
+        }
+    }
+
     ur_result_t result = pfnRetain(hMem);
 
-    if (context.enableLeakChecking && result == UR_RESULT_SUCCESS) {
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS) {
         refCountContext.incrementRefCount(hMem);
     }
 
@@ -981,12 +1066,24 @@ __urdlllocal ur_result_t UR_APICALL urMemRelease(
         }
     }
 
-    ur_result_t result = pfnRelease(hMem);
+    if (context.enableLifetimeValidation) {
+        if (hMem && !refCountContext.isLive(hMem, __func__)) {
+            return UR_RESULT_ERROR_INVALID_MEM_OBJECT;
+        }
+    }
 
-    if (context.enableLeakChecking && result == UR_RESULT_SUCCESS) {
+    if (context.enableHandleTracking) {
+        // the handle is forgotten before the adapter releases it, which
+        // may hand out its address to a create on another thread at once
         refCountContext.decrementRefCount(hMem);
     }
 
+    ur_result_t result = pfnRelease(hMem);
+
+    if (context.enableHandleTracking && result != UR_RESULT_SUCCESS) {
+        refCountContext.restoreRefCount(hMem);
+    }
+
     return result;
 }
 
@@ -1030,9 +1127,19 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferPartition(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hBuffer && !refCountContext.isLive(hBuffer, __func__)) {
+            return UR_RESULT_ERROR_INVALID_MEM_OBJECT;
+        }
+    }
+
     ur_result_t result =
         pfnBufferPartition(hBuffer, flags, bufferCreateType, pRegion, phMem);
 
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS) {
+        refCountContext.createRefCount(*phMem);
+    }
+
     return result;
 }
 
@@ -1059,6 +1166,12 @@ __urdlllocal ur_result_t UR_APICALL urMemGetNativeHandle(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hMem && !refCountContext.isLive(hMem, __func__)) {
+            return UR_RESULT_ERROR_INVALID_MEM_OBJECT;
+        }
+    }
+
     ur_result_t result = pfnGetNativeHandle(hMem, phNativeMem);
 
     return result;
@@ -1093,9 +1206,15 @@ __urdlllocal ur_result_t UR_APICALL urMemCreateWithNativeHandle(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hContext && !refCountContext.isLive(hContext, __func__)) {
+            return UR_RESULT_ERROR_INVALID_CONTEXT;
+        }
+    }
+
     ur_result_t result = pfnCreateWithNativeHandle(hNativeMem, hContext, phMem);
 
-    if (context.enableLeakChecking && result == UR_RESULT_SUCCESS) {
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS) {
         refCountContext.createRefCount(*phMem);
     }
 
@@ -1135,6 +1254,12 @@ __urdlllocal ur_result_t UR_APICALL urMemGetInfo(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hMemory && !refCountContext.isLive(hMemory, __func__)) {
+            return UR_RESULT_ERROR_INVALID_MEM_OBJECT;
+        }
+    }
+
     ur_result_t result =
         pfnGetInfo(hMemory, propName, propSize, pPropValue, pPropSizeRet);
 
@@ -1173,6 +1298,12 @@ __urdlllocal ur_result_t UR_APICALL urMemImageGetInfo(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hMemory && !refCountContext.isLive(hMemory, __func__)) {
+            return UR_RESULT_ERROR_INVALID_MEM_OBJECT;
+        }
+    }
+
     ur_result_t result =
         pfnImageGetInfo(hMemory, propName, propSize, pPropValue, pPropSizeRet);
 
@@ -1216,9 +1347,15 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreate(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hContext && !refCountContext.isLive(hContext, __func__)) {
+            return UR_RESULT_ERROR_INVALID_CONTEXT;
+        }
+    }
+
     ur_result_t result = pfnCreate(hContext, pDesc, phSampler);
 
-    if (context.enableLeakChecking && result == UR_RESULT_SUCCESS) {
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS) {
         refCountContext.createRefCount(*phSampler);
     }
 
@@ -1243,9 +1380,15 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRetain(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hSampler && !refCountContext.isLive(hSampler, __func__)) {
+            return UR_RESULT_ERROR_INVALID_SAMPLER;
+        }
+    }
+
     ur_result_t result = pfnRetain(hSampler);
 
-    if (context.enableLeakChecking && result == UR_RESULT_SUCCESS) {
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS) {
         refCountContext.incrementRefCount(hSampler);
     }
 
@@ -1270,12 +1413,24 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRelease(
         }
     }
 
-    ur_result_t result = pfnRelease(hSampler);
+    if (context.enableLifetimeValidation) {
+        if (hSampler && !refCountContext.isLive(hSampler, __func__)) {
+            return UR_RESULT_ERROR_INVALID_SAMPLER;
+        }
+    }
 
-    if (context.enableLeakChecking && result == UR_RESULT_SUCCESS) {
+    if (context.enableHandleTracking) {
+        // the handle is forgotten before the adapter releases it, which
+        // may hand out its address to a create on another thread at once
         refCountContext.decrementRefCount(hSampler);
     }
 
+    ur_result_t result = pfnRelease(hSampler);
+
+    if (context.enableHandleTracking && result != UR_RESULT_SUCCESS) {
+        refCountContext.restoreRefCount(hSampler);
+    }
+
     return result;
 }
 
@@ -1315,6 +1470,12 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetInfo(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hSampler && !refCountContext.isLive(hSampler, __func__)) {
+            return UR_RESULT_ERROR_INVALID_SAMPLER;
+        }
+    }
+
     ur_result_t result =
         pfnGetInfo(hSampler, propName, propSize, pPropValue, pPropSizeRet);
 
@@ -1344,6 +1505,12 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetNativeHandle(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hSampler && !refCountContext.isLive(hSampler, __func__)) {
+            return UR_RESULT_ERROR_INVALID_SAMPLER;
+        }
+    }
+
     ur_result_t result = pfnGetNativeHandle(hSampler, phNativeSampler);
 
     return result;
@@ -1379,10 +1546,16 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hContext && !refCountContext.isLive(hContext, __func__)) {
+            return UR_RESULT_ERROR_INVALID_CONTEXT;
+        }
+    }
+
     ur_result_t result =
         pfnCreateWithNativeHandle(hNativeSampler, hContext, phSampler);
 
-    if (context.enableLeakChecking && result == UR_RESULT_SUCCESS) {
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS) {
         refCountContext.createRefCount(*phSampler);
     }
 
@@ -1426,8 +1599,22 @@ __urdlllocal ur_result_t UR_APICALL urUSMHostAlloc(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hContext && !refCountContext.isLive(hContext, __func__)) {
+            return UR_RESULT_ERROR_INVALID_CONTEXT;
+        }
+
+        if (pool && !refCountContext.isLive(pool, __func__)) {
+            return UR_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+    }
+
     ur_result_t result = pfnHostAlloc(hContext, pUSMDesc, pool, size, ppMem);
 
+    if (context.enableParameterValidation && result == UR_RESULT_SUCCESS) {
+        usmAllocations.add(*ppMem, size);
+    }
+
     return result;
 }
 
@@ -1473,9 +1660,23 @@ __urdlllocal ur_result_t UR_APICALL urUSMDeviceAlloc(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hContext && !refCountContext.isLive(hContext, __func__)) {
+            return UR_RESULT_ERROR_INVALID_CONTEXT;
+        }
+
+        if (pool && !refCountContext.isLive(pool, __func__)) {
+            return UR_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+    }
+
     ur_result_t result =
         pfnDeviceAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
 
+    if (context.enableParameterValidation && result == UR_RESULT_SUCCESS) {
+        usmAllocations.add(*ppMem, size);
+    }
+
     return result;
 }
 
@@ -1521,9 +1722,23 @@ __urdlllocal ur_result_t UR_APICALL urUSMSharedAlloc(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hContext && !refCountContext.isLive(hContext, __func__)) {
+            return UR_RESULT_ERROR_INVALID_CONTEXT;
+        }
+
+        if (pool && !refCountContext.isLive(pool, __func__)) {
+            return UR_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+    }
+
     ur_result_t result =
         pfnSharedAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
 
+    if (context.enableParameterValidation && result == UR_RESULT_SUCCESS) {
+        usmAllocations.add(*ppMem, size);
+    }
+
     return result;
 }
 
@@ -1549,6 +1764,16 @@ __urdlllocal ur_result_t UR_APICALL urUSMFree(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hContext && !refCountContext.isLive(hContext, __func__)) {
+            return UR_RESULT_ERROR_INVALID_CONTEXT;
+        }
+    }
+
+    if (context.enableParameterValidation) {
+        usmAllocations.remove(pMem);
+    }
+
     ur_result_t result = pfnFree(hContext, pMem);
 
     return result;
@@ -1589,6 +1814,12 @@ __urdlllocal ur_result_t UR_APICALL urUSMGetMemAllocInfo(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hContext && !refCountContext.isLive(hContext, __func__)) {
+            return UR_RESULT_ERROR_INVALID_CONTEXT;
+        }
+    }
+
     ur_result_t result = pfnGetMemAllocInfo(hContext, pMem, propName, propSize,
                                             pPropValue, pPropSizeRet);
 
@@ -1628,8 +1859,18 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolCreate(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hContext && !refCountContext.isLive(hContext, __func__)) {
+            return UR_RESULT_ERROR_INVALID_CONTEXT;
+        }
+    }
+
     ur_result_t result = pfnPoolCreate(hContext, pPoolDesc, ppPool);
 
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS) {
+        refCountContext.createRefCount(*ppPool);
+    }
+
     return result;
 }
 
@@ -1655,8 +1896,28 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolDestroy(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hContext && !refCountContext.isLive(hContext, __func__)) {
+            return UR_RESULT_ERROR_INVALID_CONTEXT;
+        }
+
+        if (pPool && !refCountContext.isLive(pPool, __func__)) {
+            return UR_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+    }
+
+    if (context.enableHandleTracking) {
+        // the handle is forgotten before the adapter releases it, which
+        // may hand out its address to a create on another thread at once
+        refCountContext.decrementRefCount(pPool);
+    }
+
     ur_result_t result = pfnPoolDestroy(hContext, pPool);
 
+    if (context.enableHandleTracking && result != UR_RESULT_SUCCESS) {
+        refCountContext.restoreRefCount(pPool);
+    }
+
     return result;
 }
 
@@ -1701,10 +1962,20 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithIL(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hContext && !refCountContext.isLive(hContext, __func__)) {
+            return UR_RESULT_ERROR_INVALID_CONTEXT;
+        }
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.onProgramCreateWithIL(hContext, pIL, length);
+    }
+
     ur_result_t result =
         pfnCreateWithIL(hContext, pIL, length, pProperties, phProgram);
 
-    if (context.enableLeakChecking && result == UR_RESULT_SUCCESS) {
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS) {
         refCountContext.createRefCount(*phProgram);
     }
 
@@ -1758,10 +2029,16 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithBinary(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hContext && !refCountContext.isLive(hContext, __func__)) {
+            return UR_RESULT_ERROR_INVALID_CONTEXT;
+        }
+    }
+
     ur_result_t result = pfnCreateWithBinary(hContext, hDevice, size, pBinary,
                                              pProperties, phProgram);
 
-    if (context.enableLeakChecking && result == UR_RESULT_SUCCESS) {
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS) {
         refCountContext.createRefCount(*phProgram);
     }
 
@@ -1792,6 +2069,16 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuild(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hContext && !refCountContext.isLive(hContext, __func__)) {
+            return UR_RESULT_ERROR_INVALID_CONTEXT;
+        }
+
+        if (hProgram && !refCountContext.isLive(hProgram, __func__)) {
+            return UR_RESULT_ERROR_INVALID_PROGRAM;
+        }
+    }
+
     ur_result_t result = pfnBuild(hContext, hProgram, pOptions);
 
     return result;
@@ -1822,6 +2109,16 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompile(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hContext && !refCountContext.isLive(hContext, __func__)) {
+            return UR_RESULT_ERROR_INVALID_CONTEXT;
+        }
+
+        if (hProgram && !refCountContext.isLive(hProgram, __func__)) {
+            return UR_RESULT_ERROR_INVALID_PROGRAM;
+        }
+    }
+
     ur_result_t result = pfnCompile(hContext, hProgram, pOptions);
 
     return result;
@@ -1863,9 +2160,25 @@ __urdlllocal ur_result_t UR_APICALL urProgramLink(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hContext && !refCountContext.isLive(hContext, __func__)) {
+            return UR_RESULT_ERROR_INVALID_CONTEXT;
+        }
+
+        for (uint32_t i = 0; phPrograms && i < count; ++i) {
+            if (!refCountContext.isLive(phPrograms[i], __func__)) {
+                return UR_RESULT_ERROR_INVALID_PROGRAM;
+            }
+        }
+    }
+
     ur_result_t result =
         pfnLink(hContext, count, phPrograms, pOptions, phProgram);
 
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS) {
+        refCountContext.createRefCount(*phProgram);
+    }
+
     return result;
 }
 
@@ -1886,9 +2199,15 @@ __urdlllocal ur_result_t UR_APICALL urProgramRetain(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hProgram && !refCountContext.isLive(hProgram, __func__)) {
+            return UR_RESULT_ERROR_INVALID_PROGRAM;
+        }
+    }
+
     ur_result_t result = pfnRetain(hProgram);
 
-    if (context.enableLeakChecking && result == UR_RESULT_SUCCESS) {
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS) {
         refCountContext.incrementRefCount(hProgram);
     }
 
@@ -1912,12 +2231,28 @@ __urdlllocal ur_result_t UR_APICALL urProgramRelease(
         }
     }
 
-    ur_result_t result = pfnRelease(hProgram);
+    if (context.enableLifetimeValidation) {
+        if (hProgram && !refCountContext.isLive(hProgram, __func__)) {
+            return UR_RESULT_ERROR_INVALID_PROGRAM;
+        }
+    }
 
-    if (context.enableLeakChecking && result == UR_RESULT_SUCCESS) {
+    if (context.enablePerfLint) {
+        perfLintContext.onProgramRelease(hProgram);
+    }
+
+    if (context.enableHandleTracking) {
+        // the handle is forgotten before the adapter releases it, which
+        // may hand out its address to a create on another thread at once
         refCountContext.decrementRefCount(hProgram);
     }
 
+    ur_result_t result = pfnRelease(hProgram);
+
+    if (context.enableHandleTracking && result != UR_RESULT_SUCCESS) {
+        refCountContext.restoreRefCount(hProgram);
+    }
+
     return result;
 }
 
@@ -1960,6 +2295,12 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetFunctionPointer(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hProgram && !refCountContext.isLive(hProgram, __func__)) {
+            return UR_RESULT_ERROR_INVALID_PROGRAM;
+        }
+    }
+
     ur_result_t result = pfnGetFunctionPointer(hDevice, hProgram, pFunctionName,
                                                ppFunctionPointer);
 
@@ -1998,6 +2339,12 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetInfo(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hProgram && !refCountContext.isLive(hProgram, __func__)) {
+            return UR_RESULT_ERROR_INVALID_PROGRAM;
+        }
+    }
+
     ur_result_t result =
         pfnGetInfo(hProgram, propName, propSize, pPropValue, pPropSizeRet);
 
@@ -2042,6 +2389,12 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetBuildInfo(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hProgram && !refCountContext.isLive(hProgram, __func__)) {
+            return UR_RESULT_ERROR_INVALID_PROGRAM;
+        }
+    }
+
     ur_result_t result = pfnGetBuildInfo(hProgram, hDevice, propName, propSize,
                                          pPropValue, pPropSizeRet);
 
@@ -2078,6 +2431,12 @@ __urdlllocal ur_result_t UR_APICALL urProgramSetSpecializationConstants(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hProgram && !refCountContext.isLive(hProgram, __func__)) {
+            return UR_RESULT_ERROR_INVALID_PROGRAM;
+        }
+    }
+
     ur_result_t result =
         pfnSetSpecializationConstants(hProgram, count, pSpecConstants);
 
@@ -2107,6 +2466,12 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetNativeHandle(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hProgram && !refCountContext.isLive(hProgram, __func__)) {
+            return UR_RESULT_ERROR_INVALID_PROGRAM;
+        }
+    }
+
     ur_result_t result = pfnGetNativeHandle(hProgram, phNativeProgram);
 
     return result;
@@ -2142,10 +2507,16 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hContext && !refCountContext.isLive(hContext, __func__)) {
+            return UR_RESULT_ERROR_INVALID_CONTEXT;
+        }
+    }
+
     ur_result_t result =
         pfnCreateWithNativeHandle(hNativeProgram, hContext, phProgram);
 
-    if (context.enableLeakChecking && result == UR_RESULT_SUCCESS) {
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS) {
         refCountContext.createRefCount(*phProgram);
     }
 
@@ -2180,9 +2551,19 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreate(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hProgram && !refCountContext.isLive(hProgram, __func__)) {
+            return UR_RESULT_ERROR_INVALID_PROGRAM;
+        }
+    }
+
     ur_result_t result = pfnCreate(hProgram, pKernelName, phKernel);
 
-    if (context.enableLeakChecking && result == UR_RESULT_SUCCESS) {
+    if (context.enablePerfLint && result == UR_RESULT_SUCCESS) {
+        perfLintContext.onKernelCreate(hProgram, *phKernel);
+    }
+
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS) {
         refCountContext.createRefCount(*phKernel);
     }
 
@@ -2214,6 +2595,17 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgValue(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hKernel && !refCountContext.isLive(hKernel, __func__)) {
+            return UR_RESULT_ERROR_INVALID_KERNEL;
+        }
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.onKernelSetArgValue(hKernel, argIndex, argSize,
+                                            pArgValue);
+    }
+
     ur_result_t result = pfnSetArgValue(hKernel, argIndex, argSize, pArgValue);
 
     return result;
@@ -2239,6 +2631,16 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgLocal(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hKernel && !refCountContext.isLive(hKernel, __func__)) {
+            return UR_RESULT_ERROR_INVALID_KERNEL;
+        }
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.onKernelSetArg(hKernel, argIndex);
+    }
+
     ur_result_t result = pfnSetArgLocal(hKernel, argIndex, argSize);
 
     return result;
@@ -2277,6 +2679,12 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetInfo(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hKernel && !refCountContext.isLive(hKernel, __func__)) {
+            return UR_RESULT_ERROR_INVALID_KERNEL;
+        }
+    }
+
     ur_result_t result =
         pfnGetInfo(hKernel, propName, propSize, pPropValue, pPropSizeRet);
 
@@ -2318,6 +2726,12 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetGroupInfo(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hKernel && !refCountContext.isLive(hKernel, __func__)) {
+            return UR_RESULT_ERROR_INVALID_KERNEL;
+        }
+    }
+
     ur_result_t result = pfnGetGroupInfo(hKernel, hDevice, propName, propSize,
                                          pPropValue, pPropSizeRet);
 
@@ -2359,6 +2773,12 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSubGroupInfo(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hKernel && !refCountContext.isLive(hKernel, __func__)) {
+            return UR_RESULT_ERROR_INVALID_KERNEL;
+        }
+    }
+
     ur_result_t result = pfnGetSubGroupInfo(hKernel, hDevice, propName,
                                             propSize, pPropValue, pPropSizeRet);
 
@@ -2382,9 +2802,15 @@ __urdlllocal ur_result_t UR_APICALL urKernelRetain(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hKernel && !refCountContext.isLive(hKernel, __func__)) {
+            return UR_RESULT_ERROR_INVALID_KERNEL;
+        }
+    }
+
     ur_result_t result = pfnRetain(hKernel);
 
-    if (context.enableLeakChecking && result == UR_RESULT_SUCCESS) {
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS) {
         refCountContext.incrementRefCount(hKernel);
     }
 
@@ -2408,12 +2834,28 @@ __urdlllocal ur_result_t UR_APICALL urKernelRelease(
         }
     }
 
-    ur_result_t result = pfnRelease(hKernel);
+    if (context.enableLifetimeValidation) {
+        if (hKernel && !refCountContext.isLive(hKernel, __func__)) {
+            return UR_RESULT_ERROR_INVALID_KERNEL;
+        }
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.onKernelRelease(hKernel);
+    }
 
-    if (context.enableLeakChecking && result == UR_RESULT_SUCCESS) {
+    if (context.enableHandleTracking) {
+        // the handle is forgotten before the adapter releases it, which
+        // may hand out its address to a create on another thread at once
         refCountContext.decrementRefCount(hKernel);
     }
 
+    ur_result_t result = pfnRelease(hKernel);
+
+    if (context.enableHandleTracking && result != UR_RESULT_SUCCESS) {
+        refCountContext.restoreRefCount(hKernel);
+    }
+
     return result;
 }
 
@@ -2438,6 +2880,16 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgPointer(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hKernel && !refCountContext.isLive(hKernel, __func__)) {
+            return UR_RESULT_ERROR_INVALID_KERNEL;
+        }
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.onKernelSetArg(hKernel, argIndex);
+    }
+
     ur_result_t result = pfnSetArgPointer(hKernel, argIndex, pArgValue);
 
     return result;
@@ -2473,6 +2925,12 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetExecInfo(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hKernel && !refCountContext.isLive(hKernel, __func__)) {
+            return UR_RESULT_ERROR_INVALID_KERNEL;
+        }
+    }
+
     ur_result_t result =
         pfnSetExecInfo(hKernel, propName, propSize, pPropValue);
 
@@ -2502,6 +2960,20 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgSampler(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hKernel && !refCountContext.isLive(hKernel, __func__)) {
+            return UR_RESULT_ERROR_INVALID_KERNEL;
+        }
+
+        if (hArgValue && !refCountContext.isLive(hArgValue, __func__)) {
+            return UR_RESULT_ERROR_INVALID_SAMPLER;
+        }
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.onKernelSetArg(hKernel, argIndex);
+    }
+
     ur_result_t result = pfnSetArgSampler(hKernel, argIndex, hArgValue);
 
     return result;
@@ -2526,6 +2998,20 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgMemObj(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hKernel && !refCountContext.isLive(hKernel, __func__)) {
+            return UR_RESULT_ERROR_INVALID_KERNEL;
+        }
+
+        if (hArgValue && !refCountContext.isLive(hArgValue, __func__)) {
+            return UR_RESULT_ERROR_INVALID_MEM_OBJECT;
+        }
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.onKernelSetArg(hKernel, argIndex);
+    }
+
     ur_result_t result = pfnSetArgMemObj(hKernel, argIndex, hArgValue);
 
     return result;
@@ -2560,6 +3046,12 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetSpecializationConstants(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hKernel && !refCountContext.isLive(hKernel, __func__)) {
+            return UR_RESULT_ERROR_INVALID_KERNEL;
+        }
+    }
+
     ur_result_t result =
         pfnSetSpecializationConstants(hKernel, count, pSpecConstants);
 
@@ -2589,6 +3081,12 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetNativeHandle(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hKernel && !refCountContext.isLive(hKernel, __func__)) {
+            return UR_RESULT_ERROR_INVALID_KERNEL;
+        }
+    }
+
     ur_result_t result = pfnGetNativeHandle(hKernel, phNativeKernel);
 
     return result;
@@ -2635,10 +3133,20 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hContext && !refCountContext.isLive(hContext, __func__)) {
+            return UR_RESULT_ERROR_INVALID_CONTEXT;
+        }
+
+        if (hProgram && !refCountContext.isLive(hProgram, __func__)) {
+            return UR_RESULT_ERROR_INVALID_PROGRAM;
+        }
+    }
+
     ur_result_t result = pfnCreateWithNativeHandle(
         hNativeKernel, hContext, hProgram, pProperties, phKernel);
 
-    if (context.enableLeakChecking && result == UR_RESULT_SUCCESS) {
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS) {
         refCountContext.createRefCount(*phKernel);
     }
 
@@ -2674,6 +3182,12 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetInfo(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hQueue && !refCountContext.isLive(hQueue, __func__)) {
+            return UR_RESULT_ERROR_INVALID_QUEUE;
+        }
+    }
+
     ur_result_t result =
         pfnGetInfo(hQueue, propName, propSize, pPropValue, pPropSizeRet);
 
@@ -2710,9 +3224,15 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreate(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hContext && !refCountContext.isLive(hContext, __func__)) {
+            return UR_RESULT_ERROR_INVALID_CONTEXT;
+        }
+    }
+
     ur_result_t result = pfnCreate(hContext, hDevice, pProperties, phQueue);
 
-    if (context.enableLeakChecking && result == UR_RESULT_SUCCESS) {
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS) {
         refCountContext.createRefCount(*phQueue);
     }
 
@@ -2736,9 +3256,15 @@ __urdlllocal ur_result_t UR_APICALL urQueueRetain(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hQueue && !refCountContext.isLive(hQueue, __func__)) {
+            return UR_RESULT_ERROR_INVALID_QUEUE;
+        }
+    }
+
     ur_result_t result = pfnRetain(hQueue);
 
-    if (context.enableLeakChecking && result == UR_RESULT_SUCCESS) {
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS) {
         refCountContext.incrementRefCount(hQueue);
     }
 
@@ -2762,12 +3288,28 @@ __urdlllocal ur_result_t UR_APICALL urQueueRelease(
         }
     }
 
-    ur_result_t result = pfnRelease(hQueue);
+    if (context.enableLifetimeValidation) {
+        if (hQueue && !refCountContext.isLive(hQueue, __func__)) {
+            return UR_RESULT_ERROR_INVALID_QUEUE;
+        }
+    }
 
-    if (context.enableLeakChecking && result == UR_RESULT_SUCCESS) {
+    if (context.enablePerfLint) {
+        perfLintContext.onQueueRelease(hQueue);
+    }
+
+    if (context.enableHandleTracking) {
+        // the handle is forgotten before the adapter releases it, which
+        // may hand out its address to a create on another thread at once
         refCountContext.decrementRefCount(hQueue);
     }
 
+    ur_result_t result = pfnRelease(hQueue);
+
+    if (context.enableHandleTracking && result != UR_RESULT_SUCCESS) {
+        refCountContext.restoreRefCount(hQueue);
+    }
+
     return result;
 }
 
@@ -2794,6 +3336,12 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetNativeHandle(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hQueue && !refCountContext.isLive(hQueue, __func__)) {
+            return UR_RESULT_ERROR_INVALID_QUEUE;
+        }
+    }
+
     ur_result_t result = pfnGetNativeHandle(hQueue, phNativeQueue);
 
     return result;
@@ -2828,10 +3376,16 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hContext && !refCountContext.isLive(hContext, __func__)) {
+            return UR_RESULT_ERROR_INVALID_CONTEXT;
+        }
+    }
+
     ur_result_t result =
         pfnCreateWithNativeHandle(hNativeQueue, hContext, phQueue);
 
-    if (context.enableLeakChecking && result == UR_RESULT_SUCCESS) {
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS) {
         refCountContext.createRefCount(*phQueue);
     }
 
@@ -2855,6 +3409,16 @@ __urdlllocal ur_result_t UR_APICALL urQueueFinish(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hQueue && !refCountContext.isLive(hQueue, __func__)) {
+            return UR_RESULT_ERROR_INVALID_QUEUE;
+        }
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.onQueueFinish(hQueue);
+    }
+
     ur_result_t result = pfnFinish(hQueue);
 
     return result;
@@ -2877,6 +3441,12 @@ __urdlllocal ur_result_t UR_APICALL urQueueFlush(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hQueue && !refCountContext.isLive(hQueue, __func__)) {
+            return UR_RESULT_ERROR_INVALID_QUEUE;
+        }
+    }
+
     ur_result_t result = pfnFlush(hQueue);
 
     return result;
@@ -2913,6 +3483,12 @@ __urdlllocal ur_result_t UR_APICALL urEventGetInfo(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hEvent && !refCountContext.isLive(hEvent, __func__)) {
+            return UR_RESULT_ERROR_INVALID_EVENT;
+        }
+    }
+
     ur_result_t result =
         pfnGetInfo(hEvent, propName, propSize, pPropValue, pPropSizeRet);
 
@@ -2953,6 +3529,12 @@ __urdlllocal ur_result_t UR_APICALL urEventGetProfilingInfo(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hEvent && !refCountContext.isLive(hEvent, __func__)) {
+            return UR_RESULT_ERROR_INVALID_EVENT;
+        }
+    }
+
     ur_result_t result = pfnGetProfilingInfo(hEvent, propName, propSize,
                                              pPropValue, pPropSizeRet);
 
@@ -2983,6 +3565,14 @@ __urdlllocal ur_result_t UR_APICALL urEventWait(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        for (uint32_t i = 0; phEventWaitList && i < numEvents; ++i) {
+            if (!refCountContext.isLive(phEventWaitList[i], __func__)) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+            }
+        }
+    }
+
     ur_result_t result = pfnWait(numEvents, phEventWaitList);
 
     return result;
@@ -3005,9 +3595,15 @@ __urdlllocal ur_result_t UR_APICALL urEventRetain(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hEvent && !refCountContext.isLive(hEvent, __func__)) {
+            return UR_RESULT_ERROR_INVALID_EVENT;
+        }
+    }
+
     ur_result_t result = pfnRetain(hEvent);
 
-    if (context.enableLeakChecking && result == UR_RESULT_SUCCESS) {
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS) {
         refCountContext.incrementRefCount(hEvent);
     }
 
@@ -3031,12 +3627,24 @@ __urdlllocal ur_result_t UR_APICALL urEventRelease(
         }
     }
 
-    ur_result_t result = pfnRelease(hEvent);
+    if (context.enableLifetimeValidation) {
+        if (hEvent && !refCountContext.isLive(hEvent, __func__)) {
+            return UR_RESULT_ERROR_INVALID_EVENT;
+        }
+    }
 
-    if (context.enableLeakChecking && result == UR_RESULT_SUCCESS) {
+    if (context.enableHandleTracking) {
+        // the handle is forgotten before the adapter releases it, which
+        // may hand out its address to a create on another thread at once
         refCountContext.decrementRefCount(hEvent);
     }
 
+    ur_result_t result = pfnRelease(hEvent);
+
+    if (context.enableHandleTracking && result != UR_RESULT_SUCCESS) {
+        refCountContext.restoreRefCount(hEvent);
+    }
+
     return result;
 }
 
@@ -3063,6 +3671,12 @@ __urdlllocal ur_result_t UR_APICALL urEventGetNativeHandle(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hEvent && !refCountContext.isLive(hEvent, __func__)) {
+            return UR_RESULT_ERROR_INVALID_EVENT;
+        }
+    }
+
     ur_result_t result = pfnGetNativeHandle(hEvent, phNativeEvent);
 
     return result;
@@ -3097,10 +3711,16 @@ __urdlllocal ur_result_t UR_APICALL urEventCreateWithNativeHandle(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hContext && !refCountContext.isLive(hContext, __func__)) {
+            return UR_RESULT_ERROR_INVALID_CONTEXT;
+        }
+    }
+
     ur_result_t result =
         pfnCreateWithNativeHandle(hNativeEvent, hContext, phEvent);
 
-    if (context.enableLeakChecking && result == UR_RESULT_SUCCESS) {
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS) {
         refCountContext.createRefCount(*phEvent);
     }
 
@@ -3136,6 +3756,12 @@ __urdlllocal ur_result_t UR_APICALL urEventSetCallback(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hEvent && !refCountContext.isLive(hEvent, __func__)) {
+            return UR_RESULT_ERROR_INVALID_EVENT;
+        }
+    }
+
     ur_result_t result =
         pfnSetCallback(hEvent, execStatus, pfnNotify, pUserData);
 
@@ -3205,10 +3831,35 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hQueue && !refCountContext.isLive(hQueue, __func__)) {
+            return UR_RESULT_ERROR_INVALID_QUEUE;
+        }
+
+        if (hKernel && !refCountContext.isLive(hKernel, __func__)) {
+            return UR_RESULT_ERROR_INVALID_KERNEL;
+        }
+
+        for (uint32_t i = 0; phEventWaitList && i < numEventsInWaitList; ++i) {
+            if (!refCountContext.isLive(phEventWaitList[i], __func__)) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+            }
+        }
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.onEnqueue(hQueue);
+    }
+
     ur_result_t result = pfnKernelLaunch(
         hQueue, hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize,
         pLocalWorkSize, numEventsInWaitList, phEventWaitList, phEvent);
 
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS &&
+        phEvent) {
+        refCountContext.createRefCount(*phEvent);
+    }
+
     return result;
 }
 
@@ -3247,9 +3898,30 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWait(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hQueue && !refCountContext.isLive(hQueue, __func__)) {
+            return UR_RESULT_ERROR_INVALID_QUEUE;
+        }
+
+        for (uint32_t i = 0; phEventWaitList && i < numEventsInWaitList; ++i) {
+            if (!refCountContext.isLive(phEventWaitList[i], __func__)) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+            }
+        }
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.onEnqueue(hQueue);
+    }
+
     ur_result_t result =
         pfnEventsWait(hQueue, numEventsInWaitList, phEventWaitList, phEvent);
 
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS &&
+        phEvent) {
+        refCountContext.createRefCount(*phEvent);
+    }
+
     return result;
 }
 
@@ -3289,9 +3961,30 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hQueue && !refCountContext.isLive(hQueue, __func__)) {
+            return UR_RESULT_ERROR_INVALID_QUEUE;
+        }
+
+        for (uint32_t i = 0; phEventWaitList && i < numEventsInWaitList; ++i) {
+            if (!refCountContext.isLive(phEventWaitList[i], __func__)) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+            }
+        }
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.onEnqueue(hQueue);
+    }
+
     ur_result_t result = pfnEventsWaitWithBarrier(hQueue, numEventsInWaitList,
                                                   phEventWaitList, phEvent);
 
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS &&
+        phEvent) {
+        refCountContext.createRefCount(*phEvent);
+    }
+
     return result;
 }
 
@@ -3342,10 +4035,36 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hQueue && !refCountContext.isLive(hQueue, __func__)) {
+            return UR_RESULT_ERROR_INVALID_QUEUE;
+        }
+
+        if (hBuffer && !refCountContext.isLive(hBuffer, __func__)) {
+            return UR_RESULT_ERROR_INVALID_MEM_OBJECT;
+        }
+
+        for (uint32_t i = 0; phEventWaitList && i < numEventsInWaitList; ++i) {
+            if (!refCountContext.isLive(phEventWaitList[i], __func__)) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+            }
+        }
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.onEnqueue(hQueue);
+        perfLintContext.onMemBufferRead(blockingRead);
+    }
+
     ur_result_t result =
         pfnMemBufferRead(hQueue, hBuffer, blockingRead, offset, size, pDst,
                          numEventsInWaitList, phEventWaitList, phEvent);
 
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS &&
+        phEvent) {
+        refCountContext.createRefCount(*phEvent);
+    }
+
     return result;
 }
 
@@ -3398,10 +4117,35 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hQueue && !refCountContext.isLive(hQueue, __func__)) {
+            return UR_RESULT_ERROR_INVALID_QUEUE;
+        }
+
+        if (hBuffer && !refCountContext.isLive(hBuffer, __func__)) {
+            return UR_RESULT_ERROR_INVALID_MEM_OBJECT;
+        }
+
+        for (uint32_t i = 0; phEventWaitList && i < numEventsInWaitList; ++i) {
+            if (!refCountContext.isLive(phEventWaitList[i], __func__)) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+            }
+        }
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.onEnqueue(hQueue);
+    }
+
     ur_result_t result =
         pfnMemBufferWrite(hQueue, hBuffer, blockingWrite, offset, size, pSrc,
                           numEventsInWaitList, phEventWaitList, phEvent);
 
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS &&
+        phEvent) {
+        refCountContext.createRefCount(*phEvent);
+    }
+
     return result;
 }
 
@@ -3494,11 +4238,36 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hQueue && !refCountContext.isLive(hQueue, __func__)) {
+            return UR_RESULT_ERROR_INVALID_QUEUE;
+        }
+
+        if (hBuffer && !refCountContext.isLive(hBuffer, __func__)) {
+            return UR_RESULT_ERROR_INVALID_MEM_OBJECT;
+        }
+
+        for (uint32_t i = 0; phEventWaitList && i < numEventsInWaitList; ++i) {
+            if (!refCountContext.isLive(phEventWaitList[i], __func__)) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+            }
+        }
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.onEnqueue(hQueue);
+    }
+
     ur_result_t result = pfnMemBufferReadRect(
         hQueue, hBuffer, blockingRead, bufferOrigin, hostOrigin, region,
         bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pDst,
         numEventsInWaitList, phEventWaitList, phEvent);
 
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS &&
+        phEvent) {
+        refCountContext.createRefCount(*phEvent);
+    }
+
     return result;
 }
 
@@ -3595,11 +4364,36 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hQueue && !refCountContext.isLive(hQueue, __func__)) {
+            return UR_RESULT_ERROR_INVALID_QUEUE;
+        }
+
+        if (hBuffer && !refCountContext.isLive(hBuffer, __func__)) {
+            return UR_RESULT_ERROR_INVALID_MEM_OBJECT;
+        }
+
+        for (uint32_t i = 0; phEventWaitList && i < numEventsInWaitList; ++i) {
+            if (!refCountContext.isLive(phEventWaitList[i], __func__)) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+            }
+        }
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.onEnqueue(hQueue);
+    }
+
     ur_result_t result = pfnMemBufferWriteRect(
         hQueue, hBuffer, blockingWrite, bufferOrigin, hostOrigin, region,
         bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pSrc,
         numEventsInWaitList, phEventWaitList, phEvent);
 
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS &&
+        phEvent) {
+        refCountContext.createRefCount(*phEvent);
+    }
+
     return result;
 }
 
@@ -3650,10 +4444,39 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hQueue && !refCountContext.isLive(hQueue, __func__)) {
+            return UR_RESULT_ERROR_INVALID_QUEUE;
+        }
+
+        if (hBufferSrc && !refCountContext.isLive(hBufferSrc, __func__)) {
+            return UR_RESULT_ERROR_INVALID_MEM_OBJECT;
+        }
+
+        if (hBufferDst && !refCountContext.isLive(hBufferDst, __func__)) {
+            return UR_RESULT_ERROR_INVALID_MEM_OBJECT;
+        }
+
+        for (uint32_t i = 0; phEventWaitList && i < numEventsInWaitList; ++i) {
+            if (!refCountContext.isLive(phEventWaitList[i], __func__)) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+            }
+        }
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.onEnqueue(hQueue);
+    }
+
     ur_result_t result =
         pfnMemBufferCopy(hQueue, hBufferSrc, hBufferDst, srcOffset, dstOffset,
                          size, numEventsInWaitList, phEventWaitList, phEvent);
 
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS &&
+        phEvent) {
+        refCountContext.createRefCount(*phEvent);
+    }
+
     return result;
 }
 
@@ -3741,11 +4564,40 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hQueue && !refCountContext.isLive(hQueue, __func__)) {
+            return UR_RESULT_ERROR_INVALID_QUEUE;
+        }
+
+        if (hBufferSrc && !refCountContext.isLive(hBufferSrc, __func__)) {
+            return UR_RESULT_ERROR_INVALID_MEM_OBJECT;
+        }
+
+        if (hBufferDst && !refCountContext.isLive(hBufferDst, __func__)) {
+            return UR_RESULT_ERROR_INVALID_MEM_OBJECT;
+        }
+
+        for (uint32_t i = 0; phEventWaitList && i < numEventsInWaitList; ++i) {
+            if (!refCountContext.isLive(phEventWaitList[i], __func__)) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+            }
+        }
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.onEnqueue(hQueue);
+    }
+
     ur_result_t result = pfnMemBufferCopyRect(
         hQueue, hBufferSrc, hBufferDst, srcOrigin, dstOrigin, region,
         srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch,
         numEventsInWaitList, phEventWaitList, phEvent);
 
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS &&
+        phEvent) {
+        refCountContext.createRefCount(*phEvent);
+    }
+
     return result;
 }
 
@@ -3796,10 +4648,35 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hQueue && !refCountContext.isLive(hQueue, __func__)) {
+            return UR_RESULT_ERROR_INVALID_QUEUE;
+        }
+
+        if (hBuffer && !refCountContext.isLive(hBuffer, __func__)) {
+            return UR_RESULT_ERROR_INVALID_MEM_OBJECT;
+        }
+
+        for (uint32_t i = 0; phEventWaitList && i < numEventsInWaitList; ++i) {
+            if (!refCountContext.isLive(phEventWaitList[i], __func__)) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+            }
+        }
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.onEnqueue(hQueue);
+    }
+
     ur_result_t result =
         pfnMemBufferFill(hQueue, hBuffer, pPattern, patternSize, offset, size,
                          numEventsInWaitList, phEventWaitList, phEvent);
 
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS &&
+        phEvent) {
+        refCountContext.createRefCount(*phEvent);
+    }
+
     return result;
 }
 
@@ -3855,10 +4732,35 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hQueue && !refCountContext.isLive(hQueue, __func__)) {
+            return UR_RESULT_ERROR_INVALID_QUEUE;
+        }
+
+        if (hImage && !refCountContext.isLive(hImage, __func__)) {
+            return UR_RESULT_ERROR_INVALID_MEM_OBJECT;
+        }
+
+        for (uint32_t i = 0; phEventWaitList && i < numEventsInWaitList; ++i) {
+            if (!refCountContext.isLive(phEventWaitList[i], __func__)) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+            }
+        }
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.onEnqueue(hQueue);
+    }
+
     ur_result_t result = pfnMemImageRead(
         hQueue, hImage, blockingRead, origin, region, rowPitch, slicePitch,
         pDst, numEventsInWaitList, phEventWaitList, phEvent);
 
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS &&
+        phEvent) {
+        refCountContext.createRefCount(*phEvent);
+    }
+
     return result;
 }
 
@@ -3915,10 +4817,35 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hQueue && !refCountContext.isLive(hQueue, __func__)) {
+            return UR_RESULT_ERROR_INVALID_QUEUE;
+        }
+
+        if (hImage && !refCountContext.isLive(hImage, __func__)) {
+            return UR_RESULT_ERROR_INVALID_MEM_OBJECT;
+        }
+
+        for (uint32_t i = 0; phEventWaitList && i < numEventsInWaitList; ++i) {
+            if (!refCountContext.isLive(phEventWaitList[i], __func__)) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+            }
+        }
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.onEnqueue(hQueue);
+    }
+
     ur_result_t result = pfnMemImageWrite(
         hQueue, hImage, blockingWrite, origin, region, rowPitch, slicePitch,
         pSrc, numEventsInWaitList, phEventWaitList, phEvent);
 
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS &&
+        phEvent) {
+        refCountContext.createRefCount(*phEvent);
+    }
+
     return result;
 }
 
@@ -3975,10 +4902,39 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageCopy(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hQueue && !refCountContext.isLive(hQueue, __func__)) {
+            return UR_RESULT_ERROR_INVALID_QUEUE;
+        }
+
+        if (hImageSrc && !refCountContext.isLive(hImageSrc, __func__)) {
+            return UR_RESULT_ERROR_INVALID_MEM_OBJECT;
+        }
+
+        if (hImageDst && !refCountContext.isLive(hImageDst, __func__)) {
+            return UR_RESULT_ERROR_INVALID_MEM_OBJECT;
+        }
+
+        for (uint32_t i = 0; phEventWaitList && i < numEventsInWaitList; ++i) {
+            if (!refCountContext.isLive(phEventWaitList[i], __func__)) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+            }
+        }
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.onEnqueue(hQueue);
+    }
+
     ur_result_t result =
         pfnMemImageCopy(hQueue, hImageSrc, hImageDst, srcOrigin, dstOrigin,
                         region, numEventsInWaitList, phEventWaitList, phEvent);
 
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS &&
+        phEvent) {
+        refCountContext.createRefCount(*phEvent);
+    }
+
     return result;
 }
 
@@ -4035,10 +4991,35 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hQueue && !refCountContext.isLive(hQueue, __func__)) {
+            return UR_RESULT_ERROR_INVALID_QUEUE;
+        }
+
+        if (hBuffer && !refCountContext.isLive(hBuffer, __func__)) {
+            return UR_RESULT_ERROR_INVALID_MEM_OBJECT;
+        }
+
+        for (uint32_t i = 0; phEventWaitList && i < numEventsInWaitList; ++i) {
+            if (!refCountContext.isLive(phEventWaitList[i], __func__)) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+            }
+        }
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.onEnqueue(hQueue);
+    }
+
     ur_result_t result = pfnMemBufferMap(hQueue, hBuffer, blockingMap, mapFlags,
                                          offset, size, numEventsInWaitList,
                                          phEventWaitList, phEvent, ppRetMap);
 
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS &&
+        phEvent) {
+        refCountContext.createRefCount(*phEvent);
+    }
+
     return result;
 }
 
@@ -4087,10 +5068,35 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hQueue && !refCountContext.isLive(hQueue, __func__)) {
+            return UR_RESULT_ERROR_INVALID_QUEUE;
+        }
+
+        if (hMem && !refCountContext.isLive(hMem, __func__)) {
+            return UR_RESULT_ERROR_INVALID_MEM_OBJECT;
+        }
+
+        for (uint32_t i = 0; phEventWaitList && i < numEventsInWaitList; ++i) {
+            if (!refCountContext.isLive(phEventWaitList[i], __func__)) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+            }
+        }
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.onEnqueue(hQueue);
+    }
+
     ur_result_t result =
         pfnMemUnmap(hQueue, hMem, pMappedPtr, numEventsInWaitList,
                     phEventWaitList, phEvent);
 
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS &&
+        phEvent) {
+        refCountContext.createRefCount(*phEvent);
+    }
+
     return result;
 }
 
@@ -4162,12 +5168,37 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
         if (phEventWaitList != NULL && numEventsInWaitList == 0) {
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
+
+        if (!usmAllocations.inBounds(ptr, size)) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (context.enableLifetimeValidation) {
+        if (hQueue && !refCountContext.isLive(hQueue, __func__)) {
+            return UR_RESULT_ERROR_INVALID_QUEUE;
+        }
+
+        for (uint32_t i = 0; phEventWaitList && i < numEventsInWaitList; ++i) {
+            if (!refCountContext.isLive(phEventWaitList[i], __func__)) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+            }
+        }
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.onEnqueue(hQueue);
     }
 
     ur_result_t result =
         pfnUSMFill(hQueue, ptr, patternSize, pPattern, size,
                    numEventsInWaitList, phEventWaitList, phEvent);
 
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS &&
+        phEvent) {
+        refCountContext.createRefCount(*phEvent);
+    }
+
     return result;
 }
 
@@ -4219,12 +5250,46 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
         if (phEventWaitList != NULL && numEventsInWaitList == 0) {
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
+
+        if (!usmAllocations.inBounds(pDst, size)) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (!usmAllocations.inBounds(pSrc, size)) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (rangesOverlap(pDst, pSrc, size)) {
+            return UR_RESULT_ERROR_OVERLAPPING_REGIONS;
+        }
+    }
+
+    if (context.enableLifetimeValidation) {
+        if (hQueue && !refCountContext.isLive(hQueue, __func__)) {
+            return UR_RESULT_ERROR_INVALID_QUEUE;
+        }
+
+        for (uint32_t i = 0; phEventWaitList && i < numEventsInWaitList; ++i) {
+            if (!refCountContext.isLive(phEventWaitList[i], __func__)) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+            }
+        }
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.onEnqueue(hQueue);
+        perfLintContext.onUSMMemcpy(size);
     }
 
     ur_result_t result =
         pfnUSMMemcpy(hQueue, blocking, pDst, pSrc, size, numEventsInWaitList,
                      phEventWaitList, phEvent);
 
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS &&
+        phEvent) {
+        refCountContext.createRefCount(*phEvent);
+    }
+
     return result;
 }
 
@@ -4275,12 +5340,37 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
         if (phEventWaitList != NULL && numEventsInWaitList == 0) {
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
+
+        if (!usmAllocations.inBounds(pMem, size)) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (context.enableLifetimeValidation) {
+        if (hQueue && !refCountContext.isLive(hQueue, __func__)) {
+            return UR_RESULT_ERROR_INVALID_QUEUE;
+        }
+
+        for (uint32_t i = 0; phEventWaitList && i < numEventsInWaitList; ++i) {
+            if (!refCountContext.isLive(phEventWaitList[i], __func__)) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+            }
+        }
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.onEnqueue(hQueue);
     }
 
     ur_result_t result =
         pfnUSMPrefetch(hQueue, pMem, size, flags, numEventsInWaitList,
                        phEventWaitList, phEvent);
 
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS &&
+        phEvent) {
+        refCountContext.createRefCount(*phEvent);
+    }
+
     return result;
 }
 
@@ -4317,10 +5407,29 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMAdvise(
         if (size == 0) {
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
+
+        if (!usmAllocations.inBounds(pMem, size)) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (context.enableLifetimeValidation) {
+        if (hQueue && !refCountContext.isLive(hQueue, __func__)) {
+            return UR_RESULT_ERROR_INVALID_QUEUE;
+        }
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.onEnqueue(hQueue);
     }
 
     ur_result_t result = pfnUSMAdvise(hQueue, pMem, size, advice, phEvent);
 
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS &&
+        phEvent) {
+        refCountContext.createRefCount(*phEvent);
+    }
+
     return result;
 }
 
@@ -4408,12 +5517,37 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
         if (phEventWaitList != NULL && numEventsInWaitList == 0) {
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
+
+        if (!usmAllocations.inBounds(pMem, pitch * (height - 1) + width)) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (context.enableLifetimeValidation) {
+        if (hQueue && !refCountContext.isLive(hQueue, __func__)) {
+            return UR_RESULT_ERROR_INVALID_QUEUE;
+        }
+
+        for (uint32_t i = 0; phEventWaitList && i < numEventsInWaitList; ++i) {
+            if (!refCountContext.isLive(phEventWaitList[i], __func__)) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+            }
+        }
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.onEnqueue(hQueue);
     }
 
     ur_result_t result =
         pfnUSMFill2D(hQueue, pMem, pitch, patternSize, pPattern, width, height,
                      numEventsInWaitList, phEventWaitList, phEvent);
 
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS &&
+        phEvent) {
+        refCountContext.createRefCount(*phEvent);
+    }
+
     return result;
 }
 
@@ -4486,12 +5620,45 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
         if (phEventWaitList != NULL && numEventsInWaitList == 0) {
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
+
+        if (!usmAllocations.inBounds(pDst, dstPitch * (height - 1) + width)) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (!usmAllocations.inBounds(pSrc, srcPitch * (height - 1) + width)) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (regionsOverlap2D(pDst, dstPitch, pSrc, srcPitch, width, height)) {
+            return UR_RESULT_ERROR_OVERLAPPING_REGIONS;
+        }
+    }
+
+    if (context.enableLifetimeValidation) {
+        if (hQueue && !refCountContext.isLive(hQueue, __func__)) {
+            return UR_RESULT_ERROR_INVALID_QUEUE;
+        }
+
+        for (uint32_t i = 0; phEventWaitList && i < numEventsInWaitList; ++i) {
+            if (!refCountContext.isLive(phEventWaitList[i], __func__)) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+            }
+        }
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.onEnqueue(hQueue);
     }
 
     ur_result_t result =
         pfnUSMMemcpy2D(hQueue, blocking, pDst, dstPitch, pSrc, srcPitch, width,
                        height, numEventsInWaitList, phEventWaitList, phEvent);
 
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS &&
+        phEvent) {
+        refCountContext.createRefCount(*phEvent);
+    }
+
     return result;
 }
 
@@ -4551,10 +5718,35 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hQueue && !refCountContext.isLive(hQueue, __func__)) {
+            return UR_RESULT_ERROR_INVALID_QUEUE;
+        }
+
+        if (hProgram && !refCountContext.isLive(hProgram, __func__)) {
+            return UR_RESULT_ERROR_INVALID_PROGRAM;
+        }
+
+        for (uint32_t i = 0; phEventWaitList && i < numEventsInWaitList; ++i) {
+            if (!refCountContext.isLive(phEventWaitList[i], __func__)) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+            }
+        }
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.onEnqueue(hQueue);
+    }
+
     ur_result_t result = pfnDeviceGlobalVariableWrite(
         hQueue, hProgram, name, blockingWrite, count, offset, pSrc,
         numEventsInWaitList, phEventWaitList, phEvent);
 
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS &&
+        phEvent) {
+        refCountContext.createRefCount(*phEvent);
+    }
+
     return result;
 }
 
@@ -4614,10 +5806,35 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
         }
     }
 
+    if (context.enableLifetimeValidation) {
+        if (hQueue && !refCountContext.isLive(hQueue, __func__)) {
+            return UR_RESULT_ERROR_INVALID_QUEUE;
+        }
+
+        if (hProgram && !refCountContext.isLive(hProgram, __func__)) {
+            return UR_RESULT_ERROR_INVALID_PROGRAM;
+        }
+
+        for (uint32_t i = 0; phEventWaitList && i < numEventsInWaitList; ++i) {
+            if (!refCountContext.isLive(phEventWaitList[i], __func__)) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+            }
+        }
+    }
+
+    if (context.enablePerfLint) {
+        perfLintContext.onEnqueue(hQueue);
+    }
+
     ur_result_t result = pfnDeviceGlobalVariableRead(
         hQueue, hProgram, name, blockingRead, count, offset, pDst,
         numEventsInWaitList, phEventWaitList, phEvent);
 
+    if (context.enableHandleTracking && result == UR_RESULT_SUCCESS &&
+        phEvent) {
+        refCountContext.createRefCount(*phEvent);
+    }
+
     return result;
 }
 
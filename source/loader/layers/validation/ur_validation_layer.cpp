@@ -17,6 +17,9 @@ context_t::context_t() : logger(logger::create_logger("validation")) {
     enableValidation = getenv_tobool("UR_ENABLE_VALIDATION_LAYER");
     enableParameterValidation = getenv_tobool("UR_ENABLE_PARAMETER_VALIDATION");
     enableLeakChecking = getenv_tobool("UR_ENABLE_LEAK_CHECKING");
+    enableLifetimeValidation = getenv_tobool("UR_ENABLE_LIFETIME_VALIDATION");
+    enableHandleTracking = enableLeakChecking || enableLifetimeValidation;
+    enablePerfLint = getenv_tobool("UR_ENABLE_PERF_LINT");
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -21,6 +21,11 @@ class __urdlllocal context_t : public proxy_layer_context_t {
     bool enableValidation = false;
     bool enableParameterValidation = false;
     bool enableLeakChecking = false;
+    bool enableLifetimeValidation = false;
+    /// the reference counts of the handles are kept for the leak checking,
+    /// and for the lifetime validation
+    bool enableHandleTracking = false;
+    bool enablePerfLint = false;
 
     logger::Logger logger;
 
@@ -0,0 +1,184 @@
+/*
+ *
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#ifndef UR_ADAPTER_CACHE_HPP
+#define UR_ADAPTER_CACHE_HPP 1
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <system_error>
+
+#include <sys/stat.h>
+
+namespace ur_loader {
+
+//////////////////////////////////////////////////////////////////////////
+/// on-disk record of the adapter discovery
+///
+/// remembers for every adapter the path its library was resolved to, the
+/// identity of that file and the DDI tables it provides, so that later
+/// processes can load the library without searching for it and skip the
+/// libraries that are not adapters
+///
+/// an entry is only used while the library file is unchanged, replacing or
+/// modifying the library invalidates it
+///
+/// the initialization status is deliberately not cached, it depends on the
+/// state of the system (drivers, devices) and on the init flags, which may
+/// differ in the next process
+class AdapterCache {
+  public:
+    struct entry_t {
+        std::string path;  ///< resolved path of the library
+        int64_t mtime = 0; ///< modification time of the library
+        uint64_t inode = 0;  ///< inode of the library
+        uint64_t size = 0;   ///< size of the library
+        uint32_t tables = 0; ///< bitmask of the DDI tables of the library
+
+        /// whether the library lacks the global DDI table, which does not
+        /// change as long as the file does not
+        bool unusable() const { return 0 == (tables & 1); }
+    };
+
+    /// an empty file name disables the cache
+    explicit AdapterCache(std::string file = std::string())
+        : file(std::move(file)) {}
+
+    bool enabled() const noexcept { return !file.empty(); }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// reads the cache file, a missing or malformed file leaves it empty
+    void load() {
+        entries.clear();
+        std::ifstream in(file);
+        std::string line;
+        if (!enabled() || !std::getline(in, line) || line != header) {
+            return;
+        }
+
+        while (std::getline(in, line)) {
+            std::stringstream ss(line);
+            std::string name;
+            entry_t entry;
+            if (!std::getline(ss, name, '\t') ||
+                !std::getline(ss, entry.path, '\t') ||
+                !(ss >> entry.mtime >> entry.inode >> entry.size >>
+                  entry.tables)) {
+                entries.clear();
+                return;
+            }
+            entries[name] = entry;
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// writes the cache file if anything changed since it was loaded
+    /// the file is replaced atomically, concurrent processes either see the
+    /// old or the new content
+    bool save() {
+        if (!enabled() || !dirty) {
+            return true;
+        }
+
+        std::error_code ec;
+        auto parent = std::filesystem::path(file).parent_path();
+        if (!parent.empty()) {
+            std::filesystem::create_directories(parent, ec);
+        }
+
+        auto tmp = file + ".tmp" + std::to_string(std::random_device{}());
+        {
+            std::ofstream out(tmp, std::ios::trunc);
+            out << header << '\n';
+            for (const auto &[name, entry] : entries) {
+                out << name << '\t' << entry.path << '\t' << entry.mtime
+                    << ' ' << entry.inode << ' ' << entry.size << ' '
+                    << entry.tables << '\n';
+            }
+            if (!out.flush()) {
+                std::filesystem::remove(tmp, ec);
+                return false;
+            }
+        }
+
+        std::filesystem::rename(tmp, file, ec);
+        if (ec) {
+            std::filesystem::remove(tmp, ec);
+            return false;
+        }
+        dirty = false;
+        return true;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// returns the entry of the adapter, nullptr if there is none or the
+    /// library changed since it was recorded
+    const entry_t *find(const std::string &name) const {
+        auto iter = entries.find(name);
+        if (entries.end() == iter) {
+            return nullptr;
+        }
+
+        entry_t current;
+        if (!getFileIdentity(iter->second.path, current) ||
+            current.mtime != iter->second.mtime ||
+            current.inode != iter->second.inode ||
+            current.size != iter->second.size) {
+            return nullptr;
+        }
+        return &iter->second;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// records the discovery result of an adapter
+    void update(const std::string &name, const std::string &path,
+                uint32_t tables) {
+        entry_t entry;
+        if (name.find_first_of("\t\n") != std::string::npos ||
+            path.find_first_of("\t\n") != std::string::npos ||
+            !getFileIdentity(path, entry)) {
+            return;
+        }
+        entry.path = path;
+        entry.tables = tables;
+
+        auto &old = entries[name];
+        if (old.path != entry.path || old.mtime != entry.mtime ||
+            old.inode != entry.inode || old.size != entry.size ||
+            old.tables != entry.tables) {
+            old = entry;
+            dirty = true;
+        }
+    }
+
+  private:
+    static constexpr const char *header = "ur-adapter-cache 2";
+
+    std::string file;
+    std::map<std::string, entry_t> entries;
+    bool dirty = false;
+
+    static bool getFileIdentity(const std::string &path, entry_t &entry) {
+        struct stat st;
+        if (path.empty() || ::stat(path.c_str(), &st) != 0) {
+            return false;
+        }
+        entry.mtime = static_cast<int64_t>(st.st_mtime);
+        entry.inode = static_cast<uint64_t>(st.st_ino);
+        entry.size = static_cast<uint64_t>(st.st_size);
+        return true;
+    }
+};
+
+} // namespace ur_loader
+
+#endif // UR_ADAPTER_CACHE_HPP
@@ -36,6 +36,8 @@ class AdapterRegistry {
                 discovered_adapters.emplace_back(substr);
             }
         }
+
+        applyPlatformFilter();
     }
 
     struct Iterator {
@@ -93,6 +95,58 @@ class AdapterRegistry {
             discovered_adapters.emplace_back(path);
         }
     }
+
+    // Checks whether the library of an adapter belongs to the backend, the
+    // file name has to contain "ur_adapter_<backend>" followed by the
+    // extension or the end of the name.
+    static bool isAdapterOfBackend(const std::string &path,
+                                   const std::string &backend) {
+        auto fileName = path.substr(path.find_last_of("/\\") + 1);
+        auto adapterName = "ur_adapter_" + backend;
+        auto pos = fileName.find(adapterName);
+        if (pos == std::string::npos) {
+            return false;
+        }
+        auto end = pos + adapterName.size();
+        return end == fileName.size() || fileName[end] == '.';
+    }
+
+    // UR_PLATFORM_FILTER selects the backends the process will use, the
+    // libraries of the other adapters are never loaded. Only the backend can
+    // be selected here, anything finer grained requires a loaded adapter.
+    void applyPlatformFilter() {
+        std::optional<EnvVarMap> filter;
+        try {
+            filter = getenv_to_map("UR_PLATFORM_FILTER");
+        } catch (const std::invalid_argument &e) {
+            logger::error(e.what());
+            return;
+        }
+        if (!filter || filter->empty()) {
+            return;
+        }
+
+        for (const auto &[key, values] : *filter) {
+            if (key != "backend") {
+                logger::error("Unknown UR_PLATFORM_FILTER parameter '{}', "
+                              "the filter is ignored",
+                              key);
+                return;
+            }
+        }
+
+        const auto &backends = filter->at("backend");
+        std::vector<std::string> selected;
+        for (auto &adapter : discovered_adapters) {
+            for (const auto &backend : backends) {
+                if (isAdapterOfBackend(adapter, backend)) {
+                    selected.emplace_back(std::move(adapter));
+                    break;
+                }
+            }
+        }
+        discovered_adapters = std::move(selected);
+    }
 };
 
 } // namespace ur_loader
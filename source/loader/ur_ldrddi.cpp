@@ -32,12 +32,22 @@ __urdlllocal ur_result_t UR_APICALL urInit(
 ) {
     ur_result_t result = UR_RESULT_SUCCESS;
 
-    bool atLeastOneplatformValid = false;
-    for (auto &platform : context->platforms) {
+    if (context->lazyInit) {
+        // the platforms are initialized by the first urPlatformGet
+        context->lazyInitFlags = device_flags;
+        return result;
+    }
+
+    // initialize the platforms concurrently
+    context->forEachPlatform("initialized", [&](platform_t &platform) {
         if (platform.initStatus != UR_RESULT_SUCCESS) {
-            continue;
+            return;
         }
         platform.initStatus = platform.dditable.ur.Global.pfnInit(device_flags);
+    });
+
+    bool atLeastOneplatformValid = false;
+    for (auto &platform : context->platforms) {
         if (platform.initStatus == UR_RESULT_SUCCESS) {
             atLeastOneplatformValid = true;
         }
@@ -47,6 +57,8 @@ __urdlllocal ur_result_t UR_APICALL urInit(
         result = UR_RESULT_ERROR_UNINITIALIZED;
     }
 
+    context->updateAdapterCache();
+
     return result;
 }
 
@@ -58,6 +70,10 @@ __urdlllocal ur_result_t UR_APICALL urTearDown(
     ur_result_t result = UR_RESULT_SUCCESS;
 
     for (auto &platform : context->platforms) {
+        // lazily initialized platforms may never have been loaded
+        if (nullptr == platform.dditable.ur.Global.pfnTearDown) {
+            continue;
+        }
         platform.dditable.ur.Global.pfnTearDown(pParams);
     }
 
@@ -81,17 +97,24 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGet(
 ) {
     ur_result_t result = UR_RESULT_SUCCESS;
 
+    // counting the platforms needs every adapter, retrieving handles only
+    // the adapters up to the one completing NumEntries platforms
+    if (nullptr != pNumPlatforms || 0 == NumEntries) {
+        context->lazyInitPlatforms();
+    }
+
     uint32_t total_platform_handle_count = 0;
 
     for (auto &platform : context->platforms) {
-        if (platform.initStatus != UR_RESULT_SUCCESS) {
-            continue;
-        }
-
         if ((0 < NumEntries) && (NumEntries == total_platform_handle_count)) {
             break;
         }
 
+        context->lazyInitPlatform(platform);
+        if (platform.initStatus != UR_RESULT_SUCCESS) {
+            continue;
+        }
+
         uint32_t library_platform_handle_count = 0;
 
         result = platform.dditable.ur.Platform.pfnGet(
@@ -435,6 +458,13 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRetain(
     // forward to device-platform
     result = pfnRetain(hDevice);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // retain loader handle
+    ur_device_factory.retain(hDevice);
+
     return result;
 }
 
@@ -458,6 +488,13 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRelease(
     // forward to device-platform
     result = pfnRelease(hDevice);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // release loader handle
+    ur_device_factory.release(hDevice);
+
     return result;
 }
 
@@ -500,7 +537,7 @@ __urdlllocal ur_result_t UR_APICALL urDevicePartition(
         // convert platform handles to loader handles
         for (size_t i = 0; (nullptr != phSubDevices) && (i < NumDevices); ++i) {
             phSubDevices[i] = reinterpret_cast<ur_device_handle_t>(
-                ur_device_factory.getInstance(phSubDevices[i], dditable));
+                ur_device_factory.acquire(phSubDevices[i], dditable));
         }
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
@@ -673,15 +710,17 @@ __urdlllocal ur_result_t UR_APICALL urContextCreate(
     }
 
     // convert loader handles to platform handles
-    auto phDevicesLocal = new ur_device_handle_t[DeviceCount];
+    small_array_t<ur_device_handle_t> phDevicesLocal(DeviceCount);
     for (size_t i = 0; (nullptr != phDevices) && (i < DeviceCount); ++i) {
         phDevicesLocal[i] =
             reinterpret_cast<ur_device_object_t *>(phDevices[i])->handle;
     }
+    if (nullptr != phDevices) {
+        phDevices = phDevicesLocal.data();
+    }
 
     // forward to device-platform
     result = pfnCreate(DeviceCount, phDevices, pProperties, phContext);
-    delete[] phDevicesLocal;
 
     if (UR_RESULT_SUCCESS != result) {
         return result;
@@ -690,7 +729,7 @@ __urdlllocal ur_result_t UR_APICALL urContextCreate(
     try {
         // convert platform handle to loader handle
         *phContext = reinterpret_cast<ur_context_handle_t>(
-            ur_context_factory.getInstance(*phContext, dditable));
+            ur_context_factory.acquire(*phContext, dditable));
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
     }
@@ -719,6 +758,13 @@ __urdlllocal ur_result_t UR_APICALL urContextRetain(
     // forward to device-platform
     result = pfnRetain(hContext);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // retain loader handle
+    ur_context_factory.retain(hContext);
+
     return result;
 }
 
@@ -742,6 +788,13 @@ __urdlllocal ur_result_t UR_APICALL urContextRelease(
     // forward to device-platform
     result = pfnRelease(hContext);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // release loader handle
+    ur_context_factory.release(hContext);
+
     return result;
 }
 
@@ -846,16 +899,18 @@ __urdlllocal ur_result_t UR_APICALL urContextCreateWithNativeHandle(
         reinterpret_cast<ur_native_object_t *>(hNativeContext)->handle;
 
     // convert loader handles to platform handles
-    auto phDevicesLocal = new ur_device_handle_t[numDevices];
+    small_array_t<ur_device_handle_t> phDevicesLocal(numDevices);
     for (size_t i = 0; (nullptr != phDevices) && (i < numDevices); ++i) {
         phDevicesLocal[i] =
             reinterpret_cast<ur_device_object_t *>(phDevices[i])->handle;
     }
+    if (nullptr != phDevices) {
+        phDevices = phDevicesLocal.data();
+    }
 
     // forward to device-platform
     result = pfnCreateWithNativeHandle(hNativeContext, numDevices, phDevices,
                                        pProperties, phContext);
-    delete[] phDevicesLocal;
 
     if (UR_RESULT_SUCCESS != result) {
         return result;
@@ -864,7 +919,7 @@ __urdlllocal ur_result_t UR_APICALL urContextCreateWithNativeHandle(
     try {
         // convert platform handle to loader handle
         *phContext = reinterpret_cast<ur_context_handle_t>(
-            ur_context_factory.getInstance(*phContext, dditable));
+            ur_context_factory.acquire(*phContext, dditable));
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
     }
@@ -933,7 +988,7 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreate(
     try {
         // convert platform handle to loader handle
         *phMem = reinterpret_cast<ur_mem_handle_t>(
-            ur_mem_factory.getInstance(*phMem, dditable));
+            ur_mem_factory.acquire(*phMem, dditable));
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
     }
@@ -974,7 +1029,7 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreate(
     try {
         // convert platform handle to loader handle
         *phBuffer = reinterpret_cast<ur_mem_handle_t>(
-            ur_mem_factory.getInstance(*phBuffer, dditable));
+            ur_mem_factory.acquire(*phBuffer, dditable));
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
     }
@@ -1002,6 +1057,13 @@ __urdlllocal ur_result_t UR_APICALL urMemRetain(
     // forward to device-platform
     result = pfnRetain(hMem);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // retain loader handle
+    ur_mem_factory.retain(hMem);
+
     return result;
 }
 
@@ -1025,6 +1087,13 @@ __urdlllocal ur_result_t UR_APICALL urMemRelease(
     // forward to device-platform
     result = pfnRelease(hMem);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // release loader handle
+    ur_mem_factory.release(hMem);
+
     return result;
 }
 
@@ -1063,7 +1132,7 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferPartition(
     try {
         // convert platform handle to loader handle
         *phMem = reinterpret_cast<ur_mem_handle_t>(
-            ur_mem_factory.getInstance(*phMem, dditable));
+            ur_mem_factory.acquire(*phMem, dditable));
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
     }
@@ -1142,7 +1211,7 @@ __urdlllocal ur_result_t UR_APICALL urMemCreateWithNativeHandle(
     try {
         // convert platform handle to loader handle
         *phMem = reinterpret_cast<ur_mem_handle_t>(
-            ur_mem_factory.getInstance(*phMem, dditable));
+            ur_mem_factory.acquire(*phMem, dditable));
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
     }
@@ -1250,7 +1319,7 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreate(
     try {
         // convert platform handle to loader handle
         *phSampler = reinterpret_cast<ur_sampler_handle_t>(
-            ur_sampler_factory.getInstance(*phSampler, dditable));
+            ur_sampler_factory.acquire(*phSampler, dditable));
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
     }
@@ -1279,6 +1348,13 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRetain(
     // forward to device-platform
     result = pfnRetain(hSampler);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // retain loader handle
+    ur_sampler_factory.retain(hSampler);
+
     return result;
 }
 
@@ -1303,6 +1379,13 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRelease(
     // forward to device-platform
     result = pfnRelease(hSampler);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // release loader handle
+    ur_sampler_factory.release(hSampler);
+
     return result;
 }
 
@@ -1410,7 +1493,7 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
     try {
         // convert platform handle to loader handle
         *phSampler = reinterpret_cast<ur_sampler_handle_t>(
-            ur_sampler_factory.getInstance(*phSampler, dditable));
+            ur_sampler_factory.acquire(*phSampler, dditable));
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
     }
@@ -1434,7 +1517,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMHostAlloc(
 
     // extract platform's function pointer table
     auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
-    auto pfnHostAlloc = dditable->ur.USM.pfnHostAlloc;
+    auto pfnHostAlloc = dditable->hot.pfnUSMHostAlloc;
     if (nullptr == pfnHostAlloc) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
@@ -1469,7 +1552,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMDeviceAlloc(
 
     // extract platform's function pointer table
     auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
-    auto pfnDeviceAlloc = dditable->ur.USM.pfnDeviceAlloc;
+    auto pfnDeviceAlloc = dditable->hot.pfnUSMDeviceAlloc;
     if (nullptr == pfnDeviceAlloc) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
@@ -1507,7 +1590,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMSharedAlloc(
 
     // extract platform's function pointer table
     auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
-    auto pfnSharedAlloc = dditable->ur.USM.pfnSharedAlloc;
+    auto pfnSharedAlloc = dditable->hot.pfnUSMSharedAlloc;
     if (nullptr == pfnSharedAlloc) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
@@ -1538,7 +1621,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMFree(
 
     // extract platform's function pointer table
     auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
-    auto pfnFree = dditable->ur.USM.pfnFree;
+    auto pfnFree = dditable->hot.pfnUSMFree;
     if (nullptr == pfnFree) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
@@ -1617,7 +1700,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolCreate(
     try {
         // convert platform handle to loader handle
         *ppPool = reinterpret_cast<ur_usm_pool_handle_t>(
-            ur_usm_pool_factory.getInstance(*ppPool, dditable));
+            ur_usm_pool_factory.acquire(*ppPool, dditable));
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
     }
@@ -1649,6 +1732,13 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolDestroy(
     // forward to device-platform
     result = pfnPoolDestroy(hContext, pPool);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // release loader handle
+    ur_usm_pool_factory.release(pPool);
+
     return result;
 }
 
@@ -1685,7 +1775,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithIL(
     try {
         // convert platform handle to loader handle
         *phProgram = reinterpret_cast<ur_program_handle_t>(
-            ur_program_factory.getInstance(*phProgram, dditable));
+            ur_program_factory.acquire(*phProgram, dditable));
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
     }
@@ -1732,7 +1822,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithBinary(
     try {
         // convert platform handle to loader handle
         *phProgram = reinterpret_cast<ur_program_handle_t>(
-            ur_program_factory.getInstance(*phProgram, dditable));
+            ur_program_factory.acquire(*phProgram, dditable));
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
     }
@@ -1824,15 +1914,17 @@ __urdlllocal ur_result_t UR_APICALL urProgramLink(
     hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
 
     // convert loader handles to platform handles
-    auto phProgramsLocal = new ur_program_handle_t[count];
+    small_array_t<ur_program_handle_t> phProgramsLocal(count);
     for (size_t i = 0; (nullptr != phPrograms) && (i < count); ++i) {
         phProgramsLocal[i] =
             reinterpret_cast<ur_program_object_t *>(phPrograms[i])->handle;
     }
+    if (nullptr != phPrograms) {
+        phPrograms = phProgramsLocal.data();
+    }
 
     // forward to device-platform
     result = pfnLink(hContext, count, phPrograms, pOptions, phProgram);
-    delete[] phProgramsLocal;
 
     if (UR_RESULT_SUCCESS != result) {
         return result;
@@ -1841,7 +1933,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramLink(
     try {
         // convert platform handle to loader handle
         *phProgram = reinterpret_cast<ur_program_handle_t>(
-            ur_program_factory.getInstance(*phProgram, dditable));
+            ur_program_factory.acquire(*phProgram, dditable));
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
     }
@@ -1869,6 +1961,13 @@ __urdlllocal ur_result_t UR_APICALL urProgramRetain(
     // forward to device-platform
     result = pfnRetain(hProgram);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // retain loader handle
+    ur_program_factory.retain(hProgram);
+
     return result;
 }
 
@@ -1892,6 +1991,13 @@ __urdlllocal ur_result_t UR_APICALL urProgramRelease(
     // forward to device-platform
     result = pfnRelease(hProgram);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // release loader handle
+    ur_program_factory.release(hProgram);
+
     return result;
 }
 
@@ -2107,7 +2213,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
     try {
         // convert platform handle to loader handle
         *phProgram = reinterpret_cast<ur_program_handle_t>(
-            ur_program_factory.getInstance(*phProgram, dditable));
+            ur_program_factory.acquire(*phProgram, dditable));
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
     }
@@ -2145,7 +2251,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreate(
     try {
         // convert platform handle to loader handle
         *phKernel = reinterpret_cast<ur_kernel_handle_t>(
-            ur_kernel_factory.getInstance(*phKernel, dditable));
+            ur_kernel_factory.acquire(*phKernel, dditable));
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
     }
@@ -2166,7 +2272,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgValue(
 
     // extract platform's function pointer table
     auto dditable = reinterpret_cast<ur_kernel_object_t *>(hKernel)->dditable;
-    auto pfnSetArgValue = dditable->ur.Kernel.pfnSetArgValue;
+    auto pfnSetArgValue = dditable->hot.pfnKernelSetArgValue;
     if (nullptr == pfnSetArgValue) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
@@ -2335,6 +2441,13 @@ __urdlllocal ur_result_t UR_APICALL urKernelRetain(
     // forward to device-platform
     result = pfnRetain(hKernel);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // retain loader handle
+    ur_kernel_factory.retain(hKernel);
+
     return result;
 }
 
@@ -2358,6 +2471,13 @@ __urdlllocal ur_result_t UR_APICALL urKernelRelease(
     // forward to device-platform
     result = pfnRelease(hKernel);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // release loader handle
+    ur_kernel_factory.release(hKernel);
+
     return result;
 }
 
@@ -2374,7 +2494,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgPointer(
 
     // extract platform's function pointer table
     auto dditable = reinterpret_cast<ur_kernel_object_t *>(hKernel)->dditable;
-    auto pfnSetArgPointer = dditable->ur.Kernel.pfnSetArgPointer;
+    auto pfnSetArgPointer = dditable->hot.pfnKernelSetArgPointer;
     if (nullptr == pfnSetArgPointer) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
@@ -2455,7 +2575,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgMemObj(
 
     // extract platform's function pointer table
     auto dditable = reinterpret_cast<ur_kernel_object_t *>(hKernel)->dditable;
-    auto pfnSetArgMemObj = dditable->ur.Kernel.pfnSetArgMemObj;
+    auto pfnSetArgMemObj = dditable->hot.pfnKernelSetArgMemObj;
     if (nullptr == pfnSetArgMemObj) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
@@ -2582,7 +2702,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
     try {
         // convert platform handle to loader handle
         *phKernel = reinterpret_cast<ur_kernel_handle_t>(
-            ur_kernel_factory.getInstance(*phKernel, dditable));
+            ur_kernel_factory.acquire(*phKernel, dditable));
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
     }
@@ -2656,7 +2776,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreate(
     try {
         // convert platform handle to loader handle
         *phQueue = reinterpret_cast<ur_queue_handle_t>(
-            ur_queue_factory.getInstance(*phQueue, dditable));
+            ur_queue_factory.acquire(*phQueue, dditable));
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
     }
@@ -2684,6 +2804,13 @@ __urdlllocal ur_result_t UR_APICALL urQueueRetain(
     // forward to device-platform
     result = pfnRetain(hQueue);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // retain loader handle
+    ur_queue_factory.retain(hQueue);
+
     return result;
 }
 
@@ -2707,6 +2834,13 @@ __urdlllocal ur_result_t UR_APICALL urQueueRelease(
     // forward to device-platform
     result = pfnRelease(hQueue);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // release loader handle
+    ur_queue_factory.release(hQueue);
+
     return result;
 }
 
@@ -2782,7 +2916,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
     try {
         // convert platform handle to loader handle
         *phQueue = reinterpret_cast<ur_queue_handle_t>(
-            ur_queue_factory.getInstance(*phQueue, dditable));
+            ur_queue_factory.acquire(*phQueue, dditable));
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
     }
@@ -2799,7 +2933,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueFinish(
 
     // extract platform's function pointer table
     auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
-    auto pfnFinish = dditable->ur.Queue.pfnFinish;
+    auto pfnFinish = dditable->hot.pfnQueueFinish;
     if (nullptr == pfnFinish) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
@@ -2851,7 +2985,7 @@ __urdlllocal ur_result_t UR_APICALL urEventGetInfo(
 
     // extract platform's function pointer table
     auto dditable = reinterpret_cast<ur_event_object_t *>(hEvent)->dditable;
-    auto pfnGetInfo = dditable->ur.Event.pfnGetInfo;
+    auto pfnGetInfo = dditable->hot.pfnEventGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
@@ -2911,21 +3045,23 @@ __urdlllocal ur_result_t UR_APICALL urEventWait(
     // extract platform's function pointer table
     auto dditable =
         reinterpret_cast<ur_event_object_t *>(*phEventWaitList)->dditable;
-    auto pfnWait = dditable->ur.Event.pfnWait;
+    auto pfnWait = dditable->hot.pfnEventWait;
     if (nullptr == pfnWait) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handles to platform handles
-    auto phEventWaitListLocal = new ur_event_handle_t[numEvents];
+    small_array_t<ur_event_handle_t> phEventWaitListLocal(numEvents);
     for (size_t i = 0; (nullptr != phEventWaitList) && (i < numEvents); ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
     }
+    if (nullptr != phEventWaitList) {
+        phEventWaitList = phEventWaitListLocal.data();
+    }
 
     // forward to device-platform
     result = pfnWait(numEvents, phEventWaitList);
-    delete[] phEventWaitListLocal;
 
     return result;
 }
@@ -2939,7 +3075,7 @@ __urdlllocal ur_result_t UR_APICALL urEventRetain(
 
     // extract platform's function pointer table
     auto dditable = reinterpret_cast<ur_event_object_t *>(hEvent)->dditable;
-    auto pfnRetain = dditable->ur.Event.pfnRetain;
+    auto pfnRetain = dditable->hot.pfnEventRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
@@ -2950,6 +3086,13 @@ __urdlllocal ur_result_t UR_APICALL urEventRetain(
     // forward to device-platform
     result = pfnRetain(hEvent);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // retain loader handle
+    ur_event_factory.retain(hEvent);
+
     return result;
 }
 
@@ -2962,7 +3105,7 @@ __urdlllocal ur_result_t UR_APICALL urEventRelease(
 
     // extract platform's function pointer table
     auto dditable = reinterpret_cast<ur_event_object_t *>(hEvent)->dditable;
-    auto pfnRelease = dditable->ur.Event.pfnRelease;
+    auto pfnRelease = dditable->hot.pfnEventRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
@@ -2973,6 +3116,13 @@ __urdlllocal ur_result_t UR_APICALL urEventRelease(
     // forward to device-platform
     result = pfnRelease(hEvent);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // release loader handle
+    ur_event_factory.release(hEvent);
+
     return result;
 }
 
@@ -3048,7 +3198,7 @@ __urdlllocal ur_result_t UR_APICALL urEventCreateWithNativeHandle(
     try {
         // convert platform handle to loader handle
         *phEvent = reinterpret_cast<ur_event_handle_t>(
-            ur_event_factory.getInstance(*phEvent, dditable));
+            ur_event_factory.acquire(*phEvent, dditable));
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
     }
@@ -3118,7 +3268,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
 
     // extract platform's function pointer table
     auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
-    auto pfnKernelLaunch = dditable->ur.Enqueue.pfnKernelLaunch;
+    auto pfnKernelLaunch = dditable->hot.pfnEnqueueKernelLaunch;
     if (nullptr == pfnKernelLaunch) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
@@ -3130,18 +3280,20 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
     hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
 
     // convert loader handles to platform handles
-    auto phEventWaitListLocal = new ur_event_handle_t[numEventsInWaitList];
+    small_array_t<ur_event_handle_t> phEventWaitListLocal(numEventsInWaitList);
     for (size_t i = 0;
          (nullptr != phEventWaitList) && (i < numEventsInWaitList); ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
     }
+    if (nullptr != phEventWaitList) {
+        phEventWaitList = phEventWaitListLocal.data();
+    }
 
     // forward to device-platform
     result = pfnKernelLaunch(hQueue, hKernel, workDim, pGlobalWorkOffset,
                              pGlobalWorkSize, pLocalWorkSize,
                              numEventsInWaitList, phEventWaitList, phEvent);
-    delete[] phEventWaitListLocal;
 
     if (UR_RESULT_SUCCESS != result) {
         return result;
@@ -3151,7 +3303,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
         // convert platform handle to loader handle
         if (nullptr != phEvent) {
             *phEvent = reinterpret_cast<ur_event_handle_t>(
-                ur_event_factory.getInstance(*phEvent, dditable));
+                ur_event_factory.acquire(*phEvent, dditable));
         }
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
@@ -3179,7 +3331,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWait(
 
     // extract platform's function pointer table
     auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
-    auto pfnEventsWait = dditable->ur.Enqueue.pfnEventsWait;
+    auto pfnEventsWait = dditable->hot.pfnEnqueueEventsWait;
     if (nullptr == pfnEventsWait) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
@@ -3188,17 +3340,19 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWait(
     hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
 
     // convert loader handles to platform handles
-    auto phEventWaitListLocal = new ur_event_handle_t[numEventsInWaitList];
+    small_array_t<ur_event_handle_t> phEventWaitListLocal(numEventsInWaitList);
     for (size_t i = 0;
          (nullptr != phEventWaitList) && (i < numEventsInWaitList); ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
     }
+    if (nullptr != phEventWaitList) {
+        phEventWaitList = phEventWaitListLocal.data();
+    }
 
     // forward to device-platform
     result =
         pfnEventsWait(hQueue, numEventsInWaitList, phEventWaitList, phEvent);
-    delete[] phEventWaitListLocal;
 
     if (UR_RESULT_SUCCESS != result) {
         return result;
@@ -3208,7 +3362,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWait(
         // convert platform handle to loader handle
         if (nullptr != phEvent) {
             *phEvent = reinterpret_cast<ur_event_handle_t>(
-                ur_event_factory.getInstance(*phEvent, dditable));
+                ur_event_factory.acquire(*phEvent, dditable));
         }
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
@@ -3237,7 +3391,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
     // extract platform's function pointer table
     auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
     auto pfnEventsWaitWithBarrier =
-        dditable->ur.Enqueue.pfnEventsWaitWithBarrier;
+        dditable->hot.pfnEnqueueEventsWaitWithBarrier;
     if (nullptr == pfnEventsWaitWithBarrier) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
@@ -3246,17 +3400,19 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
     hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
 
     // convert loader handles to platform handles
-    auto phEventWaitListLocal = new ur_event_handle_t[numEventsInWaitList];
+    small_array_t<ur_event_handle_t> phEventWaitListLocal(numEventsInWaitList);
     for (size_t i = 0;
          (nullptr != phEventWaitList) && (i < numEventsInWaitList); ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
     }
+    if (nullptr != phEventWaitList) {
+        phEventWaitList = phEventWaitListLocal.data();
+    }
 
     // forward to device-platform
     result = pfnEventsWaitWithBarrier(hQueue, numEventsInWaitList,
                                       phEventWaitList, phEvent);
-    delete[] phEventWaitListLocal;
 
     if (UR_RESULT_SUCCESS != result) {
         return result;
@@ -3266,7 +3422,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
         // convert platform handle to loader handle
         if (nullptr != phEvent) {
             *phEvent = reinterpret_cast<ur_event_handle_t>(
-                ur_event_factory.getInstance(*phEvent, dditable));
+                ur_event_factory.acquire(*phEvent, dditable));
         }
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
@@ -3298,7 +3454,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
 
     // extract platform's function pointer table
     auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
-    auto pfnMemBufferRead = dditable->ur.Enqueue.pfnMemBufferRead;
+    auto pfnMemBufferRead = dditable->hot.pfnEnqueueMemBufferRead;
     if (nullptr == pfnMemBufferRead) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
@@ -3310,17 +3466,19 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
     hBuffer = reinterpret_cast<ur_mem_object_t *>(hBuffer)->handle;
 
     // convert loader handles to platform handles
-    auto phEventWaitListLocal = new ur_event_handle_t[numEventsInWaitList];
+    small_array_t<ur_event_handle_t> phEventWaitListLocal(numEventsInWaitList);
     for (size_t i = 0;
          (nullptr != phEventWaitList) && (i < numEventsInWaitList); ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
     }
+    if (nullptr != phEventWaitList) {
+        phEventWaitList = phEventWaitListLocal.data();
+    }
 
     // forward to device-platform
     result = pfnMemBufferRead(hQueue, hBuffer, blockingRead, offset, size, pDst,
                               numEventsInWaitList, phEventWaitList, phEvent);
-    delete[] phEventWaitListLocal;
 
     if (UR_RESULT_SUCCESS != result) {
         return result;
@@ -3330,7 +3488,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
         // convert platform handle to loader handle
         if (nullptr != phEvent) {
             *phEvent = reinterpret_cast<ur_event_handle_t>(
-                ur_event_factory.getInstance(*phEvent, dditable));
+                ur_event_factory.acquire(*phEvent, dditable));
         }
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
@@ -3364,7 +3522,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
 
     // extract platform's function pointer table
     auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
-    auto pfnMemBufferWrite = dditable->ur.Enqueue.pfnMemBufferWrite;
+    auto pfnMemBufferWrite = dditable->hot.pfnEnqueueMemBufferWrite;
     if (nullptr == pfnMemBufferWrite) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
@@ -3376,18 +3534,20 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
     hBuffer = reinterpret_cast<ur_mem_object_t *>(hBuffer)->handle;
 
     // convert loader handles to platform handles
-    auto phEventWaitListLocal = new ur_event_handle_t[numEventsInWaitList];
+    small_array_t<ur_event_handle_t> phEventWaitListLocal(numEventsInWaitList);
     for (size_t i = 0;
          (nullptr != phEventWaitList) && (i < numEventsInWaitList); ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
     }
+    if (nullptr != phEventWaitList) {
+        phEventWaitList = phEventWaitListLocal.data();
+    }
 
     // forward to device-platform
     result =
         pfnMemBufferWrite(hQueue, hBuffer, blockingWrite, offset, size, pSrc,
                           numEventsInWaitList, phEventWaitList, phEvent);
-    delete[] phEventWaitListLocal;
 
     if (UR_RESULT_SUCCESS != result) {
         return result;
@@ -3397,7 +3557,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
         // convert platform handle to loader handle
         if (nullptr != phEvent) {
             *phEvent = reinterpret_cast<ur_event_handle_t>(
-                ur_event_factory.getInstance(*phEvent, dditable));
+                ur_event_factory.acquire(*phEvent, dditable));
         }
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
@@ -3453,19 +3613,21 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
     hBuffer = reinterpret_cast<ur_mem_object_t *>(hBuffer)->handle;
 
     // convert loader handles to platform handles
-    auto phEventWaitListLocal = new ur_event_handle_t[numEventsInWaitList];
+    small_array_t<ur_event_handle_t> phEventWaitListLocal(numEventsInWaitList);
     for (size_t i = 0;
          (nullptr != phEventWaitList) && (i < numEventsInWaitList); ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
     }
+    if (nullptr != phEventWaitList) {
+        phEventWaitList = phEventWaitListLocal.data();
+    }
 
     // forward to device-platform
     result = pfnMemBufferReadRect(
         hQueue, hBuffer, blockingRead, bufferOrigin, hostOrigin, region,
         bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pDst,
         numEventsInWaitList, phEventWaitList, phEvent);
-    delete[] phEventWaitListLocal;
 
     if (UR_RESULT_SUCCESS != result) {
         return result;
@@ -3475,7 +3637,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
         // convert platform handle to loader handle
         if (nullptr != phEvent) {
             *phEvent = reinterpret_cast<ur_event_handle_t>(
-                ur_event_factory.getInstance(*phEvent, dditable));
+                ur_event_factory.acquire(*phEvent, dditable));
         }
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
@@ -3534,19 +3696,21 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
     hBuffer = reinterpret_cast<ur_mem_object_t *>(hBuffer)->handle;
 
     // convert loader handles to platform handles
-    auto phEventWaitListLocal = new ur_event_handle_t[numEventsInWaitList];
+    small_array_t<ur_event_handle_t> phEventWaitListLocal(numEventsInWaitList);
     for (size_t i = 0;
          (nullptr != phEventWaitList) && (i < numEventsInWaitList); ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
     }
+    if (nullptr != phEventWaitList) {
+        phEventWaitList = phEventWaitListLocal.data();
+    }
 
     // forward to device-platform
     result = pfnMemBufferWriteRect(
         hQueue, hBuffer, blockingWrite, bufferOrigin, hostOrigin, region,
         bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pSrc,
         numEventsInWaitList, phEventWaitList, phEvent);
-    delete[] phEventWaitListLocal;
 
     if (UR_RESULT_SUCCESS != result) {
         return result;
@@ -3556,7 +3720,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
         // convert platform handle to loader handle
         if (nullptr != phEvent) {
             *phEvent = reinterpret_cast<ur_event_handle_t>(
-                ur_event_factory.getInstance(*phEvent, dditable));
+                ur_event_factory.acquire(*phEvent, dditable));
         }
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
@@ -3588,7 +3752,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
 
     // extract platform's function pointer table
     auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
-    auto pfnMemBufferCopy = dditable->ur.Enqueue.pfnMemBufferCopy;
+    auto pfnMemBufferCopy = dditable->hot.pfnEnqueueMemBufferCopy;
     if (nullptr == pfnMemBufferCopy) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
@@ -3603,18 +3767,20 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
     hBufferDst = reinterpret_cast<ur_mem_object_t *>(hBufferDst)->handle;
 
     // convert loader handles to platform handles
-    auto phEventWaitListLocal = new ur_event_handle_t[numEventsInWaitList];
+    small_array_t<ur_event_handle_t> phEventWaitListLocal(numEventsInWaitList);
     for (size_t i = 0;
          (nullptr != phEventWaitList) && (i < numEventsInWaitList); ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
     }
+    if (nullptr != phEventWaitList) {
+        phEventWaitList = phEventWaitListLocal.data();
+    }
 
     // forward to device-platform
     result =
         pfnMemBufferCopy(hQueue, hBufferSrc, hBufferDst, srcOffset, dstOffset,
                          size, numEventsInWaitList, phEventWaitList, phEvent);
-    delete[] phEventWaitListLocal;
 
     if (UR_RESULT_SUCCESS != result) {
         return result;
@@ -3624,7 +3790,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
         // convert platform handle to loader handle
         if (nullptr != phEvent) {
             *phEvent = reinterpret_cast<ur_event_handle_t>(
-                ur_event_factory.getInstance(*phEvent, dditable));
+                ur_event_factory.acquire(*phEvent, dditable));
         }
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
@@ -3680,19 +3846,21 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
     hBufferDst = reinterpret_cast<ur_mem_object_t *>(hBufferDst)->handle;
 
     // convert loader handles to platform handles
-    auto phEventWaitListLocal = new ur_event_handle_t[numEventsInWaitList];
+    small_array_t<ur_event_handle_t> phEventWaitListLocal(numEventsInWaitList);
     for (size_t i = 0;
          (nullptr != phEventWaitList) && (i < numEventsInWaitList); ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
     }
+    if (nullptr != phEventWaitList) {
+        phEventWaitList = phEventWaitListLocal.data();
+    }
 
     // forward to device-platform
     result = pfnMemBufferCopyRect(
         hQueue, hBufferSrc, hBufferDst, srcOrigin, dstOrigin, region,
         srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch,
         numEventsInWaitList, phEventWaitList, phEvent);
-    delete[] phEventWaitListLocal;
 
     if (UR_RESULT_SUCCESS != result) {
         return result;
@@ -3702,7 +3870,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
         // convert platform handle to loader handle
         if (nullptr != phEvent) {
             *phEvent = reinterpret_cast<ur_event_handle_t>(
-                ur_event_factory.getInstance(*phEvent, dditable));
+                ur_event_factory.acquire(*phEvent, dditable));
         }
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
@@ -3734,7 +3902,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
 
     // extract platform's function pointer table
     auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
-    auto pfnMemBufferFill = dditable->ur.Enqueue.pfnMemBufferFill;
+    auto pfnMemBufferFill = dditable->hot.pfnEnqueueMemBufferFill;
     if (nullptr == pfnMemBufferFill) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
@@ -3746,18 +3914,20 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
     hBuffer = reinterpret_cast<ur_mem_object_t *>(hBuffer)->handle;
 
     // convert loader handles to platform handles
-    auto phEventWaitListLocal = new ur_event_handle_t[numEventsInWaitList];
+    small_array_t<ur_event_handle_t> phEventWaitListLocal(numEventsInWaitList);
     for (size_t i = 0;
          (nullptr != phEventWaitList) && (i < numEventsInWaitList); ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
     }
+    if (nullptr != phEventWaitList) {
+        phEventWaitList = phEventWaitListLocal.data();
+    }
 
     // forward to device-platform
     result =
         pfnMemBufferFill(hQueue, hBuffer, pPattern, patternSize, offset, size,
                          numEventsInWaitList, phEventWaitList, phEvent);
-    delete[] phEventWaitListLocal;
 
     if (UR_RESULT_SUCCESS != result) {
         return result;
@@ -3767,7 +3937,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
         // convert platform handle to loader handle
         if (nullptr != phEvent) {
             *phEvent = reinterpret_cast<ur_event_handle_t>(
-                ur_event_factory.getInstance(*phEvent, dditable));
+                ur_event_factory.acquire(*phEvent, dditable));
         }
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
@@ -3816,18 +3986,20 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
     hImage = reinterpret_cast<ur_mem_object_t *>(hImage)->handle;
 
     // convert loader handles to platform handles
-    auto phEventWaitListLocal = new ur_event_handle_t[numEventsInWaitList];
+    small_array_t<ur_event_handle_t> phEventWaitListLocal(numEventsInWaitList);
     for (size_t i = 0;
          (nullptr != phEventWaitList) && (i < numEventsInWaitList); ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
     }
+    if (nullptr != phEventWaitList) {
+        phEventWaitList = phEventWaitListLocal.data();
+    }
 
     // forward to device-platform
     result = pfnMemImageRead(hQueue, hImage, blockingRead, origin, region,
                              rowPitch, slicePitch, pDst, numEventsInWaitList,
                              phEventWaitList, phEvent);
-    delete[] phEventWaitListLocal;
 
     if (UR_RESULT_SUCCESS != result) {
         return result;
@@ -3837,7 +4009,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
         // convert platform handle to loader handle
         if (nullptr != phEvent) {
             *phEvent = reinterpret_cast<ur_event_handle_t>(
-                ur_event_factory.getInstance(*phEvent, dditable));
+                ur_event_factory.acquire(*phEvent, dditable));
         }
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
@@ -3887,18 +4059,20 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
     hImage = reinterpret_cast<ur_mem_object_t *>(hImage)->handle;
 
     // convert loader handles to platform handles
-    auto phEventWaitListLocal = new ur_event_handle_t[numEventsInWaitList];
+    small_array_t<ur_event_handle_t> phEventWaitListLocal(numEventsInWaitList);
     for (size_t i = 0;
          (nullptr != phEventWaitList) && (i < numEventsInWaitList); ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
     }
+    if (nullptr != phEventWaitList) {
+        phEventWaitList = phEventWaitListLocal.data();
+    }
 
     // forward to device-platform
     result = pfnMemImageWrite(hQueue, hImage, blockingWrite, origin, region,
                               rowPitch, slicePitch, pSrc, numEventsInWaitList,
                               phEventWaitList, phEvent);
-    delete[] phEventWaitListLocal;
 
     if (UR_RESULT_SUCCESS != result) {
         return result;
@@ -3908,7 +4082,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
         // convert platform handle to loader handle
         if (nullptr != phEvent) {
             *phEvent = reinterpret_cast<ur_event_handle_t>(
-                ur_event_factory.getInstance(*phEvent, dditable));
+                ur_event_factory.acquire(*phEvent, dditable));
         }
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
@@ -3961,18 +4135,20 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageCopy(
     hImageDst = reinterpret_cast<ur_mem_object_t *>(hImageDst)->handle;
 
     // convert loader handles to platform handles
-    auto phEventWaitListLocal = new ur_event_handle_t[numEventsInWaitList];
+    small_array_t<ur_event_handle_t> phEventWaitListLocal(numEventsInWaitList);
     for (size_t i = 0;
          (nullptr != phEventWaitList) && (i < numEventsInWaitList); ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
     }
+    if (nullptr != phEventWaitList) {
+        phEventWaitList = phEventWaitListLocal.data();
+    }
 
     // forward to device-platform
     result =
         pfnMemImageCopy(hQueue, hImageSrc, hImageDst, srcOrigin, dstOrigin,
                         region, numEventsInWaitList, phEventWaitList, phEvent);
-    delete[] phEventWaitListLocal;
 
     if (UR_RESULT_SUCCESS != result) {
         return result;
@@ -3982,7 +4158,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageCopy(
         // convert platform handle to loader handle
         if (nullptr != phEvent) {
             *phEvent = reinterpret_cast<ur_event_handle_t>(
-                ur_event_factory.getInstance(*phEvent, dditable));
+                ur_event_factory.acquire(*phEvent, dditable));
         }
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
@@ -4016,7 +4192,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
 
     // extract platform's function pointer table
     auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
-    auto pfnMemBufferMap = dditable->ur.Enqueue.pfnMemBufferMap;
+    auto pfnMemBufferMap = dditable->hot.pfnEnqueueMemBufferMap;
     if (nullptr == pfnMemBufferMap) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
@@ -4028,18 +4204,20 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
     hBuffer = reinterpret_cast<ur_mem_object_t *>(hBuffer)->handle;
 
     // convert loader handles to platform handles
-    auto phEventWaitListLocal = new ur_event_handle_t[numEventsInWaitList];
+    small_array_t<ur_event_handle_t> phEventWaitListLocal(numEventsInWaitList);
     for (size_t i = 0;
          (nullptr != phEventWaitList) && (i < numEventsInWaitList); ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
     }
+    if (nullptr != phEventWaitList) {
+        phEventWaitList = phEventWaitListLocal.data();
+    }
 
     // forward to device-platform
     result = pfnMemBufferMap(hQueue, hBuffer, blockingMap, mapFlags, offset,
                              size, numEventsInWaitList, phEventWaitList,
                              phEvent, ppRetMap);
-    delete[] phEventWaitListLocal;
 
     if (UR_RESULT_SUCCESS != result) {
         return result;
@@ -4049,7 +4227,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
         // convert platform handle to loader handle
         if (nullptr != phEvent) {
             *phEvent = reinterpret_cast<ur_event_handle_t>(
-                ur_event_factory.getInstance(*phEvent, dditable));
+                ur_event_factory.acquire(*phEvent, dditable));
         }
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
@@ -4079,7 +4257,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
 
     // extract platform's function pointer table
     auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
-    auto pfnMemUnmap = dditable->ur.Enqueue.pfnMemUnmap;
+    auto pfnMemUnmap = dditable->hot.pfnEnqueueMemUnmap;
     if (nullptr == pfnMemUnmap) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
@@ -4091,17 +4269,19 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
     hMem = reinterpret_cast<ur_mem_object_t *>(hMem)->handle;
 
     // convert loader handles to platform handles
-    auto phEventWaitListLocal = new ur_event_handle_t[numEventsInWaitList];
+    small_array_t<ur_event_handle_t> phEventWaitListLocal(numEventsInWaitList);
     for (size_t i = 0;
          (nullptr != phEventWaitList) && (i < numEventsInWaitList); ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
     }
+    if (nullptr != phEventWaitList) {
+        phEventWaitList = phEventWaitListLocal.data();
+    }
 
     // forward to device-platform
     result = pfnMemUnmap(hQueue, hMem, pMappedPtr, numEventsInWaitList,
                          phEventWaitList, phEvent);
-    delete[] phEventWaitListLocal;
 
     if (UR_RESULT_SUCCESS != result) {
         return result;
@@ -4111,7 +4291,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
         // convert platform handle to loader handle
         if (nullptr != phEvent) {
             *phEvent = reinterpret_cast<ur_event_handle_t>(
-                ur_event_factory.getInstance(*phEvent, dditable));
+                ur_event_factory.acquire(*phEvent, dditable));
         }
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
@@ -4146,7 +4326,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
 
     // extract platform's function pointer table
     auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
-    auto pfnUSMFill = dditable->ur.Enqueue.pfnUSMFill;
+    auto pfnUSMFill = dditable->hot.pfnEnqueueUSMFill;
     if (nullptr == pfnUSMFill) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
@@ -4155,17 +4335,19 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
     hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
 
     // convert loader handles to platform handles
-    auto phEventWaitListLocal = new ur_event_handle_t[numEventsInWaitList];
+    small_array_t<ur_event_handle_t> phEventWaitListLocal(numEventsInWaitList);
     for (size_t i = 0;
          (nullptr != phEventWaitList) && (i < numEventsInWaitList); ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
     }
+    if (nullptr != phEventWaitList) {
+        phEventWaitList = phEventWaitListLocal.data();
+    }
 
     // forward to device-platform
     result = pfnUSMFill(hQueue, ptr, patternSize, pPattern, size,
                         numEventsInWaitList, phEventWaitList, phEvent);
-    delete[] phEventWaitListLocal;
 
     if (UR_RESULT_SUCCESS != result) {
         return result;
@@ -4175,7 +4357,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
         // convert platform handle to loader handle
         if (nullptr != phEvent) {
             *phEvent = reinterpret_cast<ur_event_handle_t>(
-                ur_event_factory.getInstance(*phEvent, dditable));
+                ur_event_factory.acquire(*phEvent, dditable));
         }
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
@@ -4206,7 +4388,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
 
     // extract platform's function pointer table
     auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
-    auto pfnUSMMemcpy = dditable->ur.Enqueue.pfnUSMMemcpy;
+    auto pfnUSMMemcpy = dditable->hot.pfnEnqueueUSMMemcpy;
     if (nullptr == pfnUSMMemcpy) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
@@ -4215,17 +4397,19 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
     hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
 
     // convert loader handles to platform handles
-    auto phEventWaitListLocal = new ur_event_handle_t[numEventsInWaitList];
+    small_array_t<ur_event_handle_t> phEventWaitListLocal(numEventsInWaitList);
     for (size_t i = 0;
          (nullptr != phEventWaitList) && (i < numEventsInWaitList); ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
     }
+    if (nullptr != phEventWaitList) {
+        phEventWaitList = phEventWaitListLocal.data();
+    }
 
     // forward to device-platform
     result = pfnUSMMemcpy(hQueue, blocking, pDst, pSrc, size,
                           numEventsInWaitList, phEventWaitList, phEvent);
-    delete[] phEventWaitListLocal;
 
     if (UR_RESULT_SUCCESS != result) {
         return result;
@@ -4235,7 +4419,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
         // convert platform handle to loader handle
         if (nullptr != phEvent) {
             *phEvent = reinterpret_cast<ur_event_handle_t>(
-                ur_event_factory.getInstance(*phEvent, dditable));
+                ur_event_factory.acquire(*phEvent, dditable));
         }
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
@@ -4265,7 +4449,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
 
     // extract platform's function pointer table
     auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
-    auto pfnUSMPrefetch = dditable->ur.Enqueue.pfnUSMPrefetch;
+    auto pfnUSMPrefetch = dditable->hot.pfnEnqueueUSMPrefetch;
     if (nullptr == pfnUSMPrefetch) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
@@ -4274,17 +4458,19 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
     hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
 
     // convert loader handles to platform handles
-    auto phEventWaitListLocal = new ur_event_handle_t[numEventsInWaitList];
+    small_array_t<ur_event_handle_t> phEventWaitListLocal(numEventsInWaitList);
     for (size_t i = 0;
          (nullptr != phEventWaitList) && (i < numEventsInWaitList); ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
     }
+    if (nullptr != phEventWaitList) {
+        phEventWaitList = phEventWaitListLocal.data();
+    }
 
     // forward to device-platform
     result = pfnUSMPrefetch(hQueue, pMem, size, flags, numEventsInWaitList,
                             phEventWaitList, phEvent);
-    delete[] phEventWaitListLocal;
 
     if (UR_RESULT_SUCCESS != result) {
         return result;
@@ -4294,7 +4480,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
         // convert platform handle to loader handle
         if (nullptr != phEvent) {
             *phEvent = reinterpret_cast<ur_event_handle_t>(
-                ur_event_factory.getInstance(*phEvent, dditable));
+                ur_event_factory.acquire(*phEvent, dditable));
         }
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
@@ -4337,7 +4523,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMAdvise(
         // convert platform handle to loader handle
         if (nullptr != phEvent) {
             *phEvent = reinterpret_cast<ur_event_handle_t>(
-                ur_event_factory.getInstance(*phEvent, dditable));
+                ur_event_factory.acquire(*phEvent, dditable));
         }
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
@@ -4385,18 +4571,20 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
     hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
 
     // convert loader handles to platform handles
-    auto phEventWaitListLocal = new ur_event_handle_t[numEventsInWaitList];
+    small_array_t<ur_event_handle_t> phEventWaitListLocal(numEventsInWaitList);
     for (size_t i = 0;
          (nullptr != phEventWaitList) && (i < numEventsInWaitList); ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
     }
+    if (nullptr != phEventWaitList) {
+        phEventWaitList = phEventWaitListLocal.data();
+    }
 
     // forward to device-platform
     result =
         pfnUSMFill2D(hQueue, pMem, pitch, patternSize, pPattern, width, height,
                      numEventsInWaitList, phEventWaitList, phEvent);
-    delete[] phEventWaitListLocal;
 
     if (UR_RESULT_SUCCESS != result) {
         return result;
@@ -4406,7 +4594,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
         // convert platform handle to loader handle
         if (nullptr != phEvent) {
             *phEvent = reinterpret_cast<ur_event_handle_t>(
-                ur_event_factory.getInstance(*phEvent, dditable));
+                ur_event_factory.acquire(*phEvent, dditable));
         }
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
@@ -4451,18 +4639,20 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
     hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
 
     // convert loader handles to platform handles
-    auto phEventWaitListLocal = new ur_event_handle_t[numEventsInWaitList];
+    small_array_t<ur_event_handle_t> phEventWaitListLocal(numEventsInWaitList);
     for (size_t i = 0;
          (nullptr != phEventWaitList) && (i < numEventsInWaitList); ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
     }
+    if (nullptr != phEventWaitList) {
+        phEventWaitList = phEventWaitListLocal.data();
+    }
 
     // forward to device-platform
     result =
         pfnUSMMemcpy2D(hQueue, blocking, pDst, dstPitch, pSrc, srcPitch, width,
                        height, numEventsInWaitList, phEventWaitList, phEvent);
-    delete[] phEventWaitListLocal;
 
     if (UR_RESULT_SUCCESS != result) {
         return result;
@@ -4472,7 +4662,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
         // convert platform handle to loader handle
         if (nullptr != phEvent) {
             *phEvent = reinterpret_cast<ur_event_handle_t>(
-                ur_event_factory.getInstance(*phEvent, dditable));
+                ur_event_factory.acquire(*phEvent, dditable));
         }
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
@@ -4521,18 +4711,20 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
     hProgram = reinterpret_cast<ur_program_object_t *>(hProgram)->handle;
 
     // convert loader handles to platform handles
-    auto phEventWaitListLocal = new ur_event_handle_t[numEventsInWaitList];
+    small_array_t<ur_event_handle_t> phEventWaitListLocal(numEventsInWaitList);
     for (size_t i = 0;
          (nullptr != phEventWaitList) && (i < numEventsInWaitList); ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
     }
+    if (nullptr != phEventWaitList) {
+        phEventWaitList = phEventWaitListLocal.data();
+    }
 
     // forward to device-platform
     result = pfnDeviceGlobalVariableWrite(
         hQueue, hProgram, name, blockingWrite, count, offset, pSrc,
         numEventsInWaitList, phEventWaitList, phEvent);
-    delete[] phEventWaitListLocal;
 
     if (UR_RESULT_SUCCESS != result) {
         return result;
@@ -4542,7 +4734,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
         // convert platform handle to loader handle
         if (nullptr != phEvent) {
             *phEvent = reinterpret_cast<ur_event_handle_t>(
-                ur_event_factory.getInstance(*phEvent, dditable));
+                ur_event_factory.acquire(*phEvent, dditable));
         }
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
@@ -4591,18 +4783,20 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
     hProgram = reinterpret_cast<ur_program_object_t *>(hProgram)->handle;
 
     // convert loader handles to platform handles
-    auto phEventWaitListLocal = new ur_event_handle_t[numEventsInWaitList];
+    small_array_t<ur_event_handle_t> phEventWaitListLocal(numEventsInWaitList);
     for (size_t i = 0;
          (nullptr != phEventWaitList) && (i < numEventsInWaitList); ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
     }
+    if (nullptr != phEventWaitList) {
+        phEventWaitList = phEventWaitListLocal.data();
+    }
 
     // forward to device-platform
     result = pfnDeviceGlobalVariableRead(
         hQueue, hProgram, name, blockingRead, count, offset, pDst,
         numEventsInWaitList, phEventWaitList, phEvent);
-    delete[] phEventWaitListLocal;
 
     if (UR_RESULT_SUCCESS != result) {
         return result;
@@ -4612,7 +4806,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
         // convert platform handle to loader handle
         if (nullptr != phEvent) {
             *phEvent = reinterpret_cast<ur_event_handle_t>(
-                ur_event_factory.getInstance(*phEvent, dditable));
+                ur_event_factory.acquire(*phEvent, dditable));
         }
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
@@ -4621,6 +4815,180 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Fills the DDI tables of a platform loaded by the lazy initialization
+ur_result_t context_t::getDdiTables(platform_t &platform) {
+    {
+        auto getTable = reinterpret_cast<ur_pfnGetGlobalProcAddrTable_t>(
+            LibLoader::getFunctionPtr(platform.handle.get(),
+                                      "urGetGlobalProcAddrTable"));
+        if (getTable) {
+            platform.tables |= 1u << 0;
+            auto getTableResult =
+                getTable(version, &platform.dditable.ur.Global);
+            if (getTableResult != UR_RESULT_SUCCESS) {
+                return getTableResult;
+            }
+        }
+    }
+
+    {
+        auto getTable = reinterpret_cast<ur_pfnGetContextProcAddrTable_t>(
+            LibLoader::getFunctionPtr(platform.handle.get(),
+                                      "urGetContextProcAddrTable"));
+        if (getTable) {
+            platform.tables |= 1u << 1;
+            auto getTableResult =
+                getTable(version, &platform.dditable.ur.Context);
+            if (getTableResult != UR_RESULT_SUCCESS) {
+                return getTableResult;
+            }
+        }
+    }
+
+    {
+        auto getTable = reinterpret_cast<ur_pfnGetEnqueueProcAddrTable_t>(
+            LibLoader::getFunctionPtr(platform.handle.get(),
+                                      "urGetEnqueueProcAddrTable"));
+        if (getTable) {
+            platform.tables |= 1u << 2;
+            auto getTableResult =
+                getTable(version, &platform.dditable.ur.Enqueue);
+            if (getTableResult != UR_RESULT_SUCCESS) {
+                return getTableResult;
+            }
+        }
+    }
+
+    {
+        auto getTable = reinterpret_cast<ur_pfnGetEventProcAddrTable_t>(
+            LibLoader::getFunctionPtr(platform.handle.get(),
+                                      "urGetEventProcAddrTable"));
+        if (getTable) {
+            platform.tables |= 1u << 3;
+            auto getTableResult =
+                getTable(version, &platform.dditable.ur.Event);
+            if (getTableResult != UR_RESULT_SUCCESS) {
+                return getTableResult;
+            }
+        }
+    }
+
+    {
+        auto getTable = reinterpret_cast<ur_pfnGetKernelProcAddrTable_t>(
+            LibLoader::getFunctionPtr(platform.handle.get(),
+                                      "urGetKernelProcAddrTable"));
+        if (getTable) {
+            platform.tables |= 1u << 4;
+            auto getTableResult =
+                getTable(version, &platform.dditable.ur.Kernel);
+            if (getTableResult != UR_RESULT_SUCCESS) {
+                return getTableResult;
+            }
+        }
+    }
+
+    {
+        auto getTable = reinterpret_cast<ur_pfnGetMemProcAddrTable_t>(
+            LibLoader::getFunctionPtr(platform.handle.get(),
+                                      "urGetMemProcAddrTable"));
+        if (getTable) {
+            platform.tables |= 1u << 5;
+            auto getTableResult = getTable(version, &platform.dditable.ur.Mem);
+            if (getTableResult != UR_RESULT_SUCCESS) {
+                return getTableResult;
+            }
+        }
+    }
+
+    {
+        auto getTable = reinterpret_cast<ur_pfnGetPlatformProcAddrTable_t>(
+            LibLoader::getFunctionPtr(platform.handle.get(),
+                                      "urGetPlatformProcAddrTable"));
+        if (getTable) {
+            platform.tables |= 1u << 6;
+            auto getTableResult =
+                getTable(version, &platform.dditable.ur.Platform);
+            if (getTableResult != UR_RESULT_SUCCESS) {
+                return getTableResult;
+            }
+        }
+    }
+
+    {
+        auto getTable = reinterpret_cast<ur_pfnGetProgramProcAddrTable_t>(
+            LibLoader::getFunctionPtr(platform.handle.get(),
+                                      "urGetProgramProcAddrTable"));
+        if (getTable) {
+            platform.tables |= 1u << 7;
+            auto getTableResult =
+                getTable(version, &platform.dditable.ur.Program);
+            if (getTableResult != UR_RESULT_SUCCESS) {
+                return getTableResult;
+            }
+        }
+    }
+
+    {
+        auto getTable = reinterpret_cast<ur_pfnGetQueueProcAddrTable_t>(
+            LibLoader::getFunctionPtr(platform.handle.get(),
+                                      "urGetQueueProcAddrTable"));
+        if (getTable) {
+            platform.tables |= 1u << 8;
+            auto getTableResult =
+                getTable(version, &platform.dditable.ur.Queue);
+            if (getTableResult != UR_RESULT_SUCCESS) {
+                return getTableResult;
+            }
+        }
+    }
+
+    {
+        auto getTable = reinterpret_cast<ur_pfnGetSamplerProcAddrTable_t>(
+            LibLoader::getFunctionPtr(platform.handle.get(),
+                                      "urGetSamplerProcAddrTable"));
+        if (getTable) {
+            platform.tables |= 1u << 9;
+            auto getTableResult =
+                getTable(version, &platform.dditable.ur.Sampler);
+            if (getTableResult != UR_RESULT_SUCCESS) {
+                return getTableResult;
+            }
+        }
+    }
+
+    {
+        auto getTable = reinterpret_cast<ur_pfnGetUSMProcAddrTable_t>(
+            LibLoader::getFunctionPtr(platform.handle.get(),
+                                      "urGetUSMProcAddrTable"));
+        if (getTable) {
+            platform.tables |= 1u << 10;
+            auto getTableResult = getTable(version, &platform.dditable.ur.USM);
+            if (getTableResult != UR_RESULT_SUCCESS) {
+                return getTableResult;
+            }
+        }
+    }
+
+    {
+        auto getTable = reinterpret_cast<ur_pfnGetDeviceProcAddrTable_t>(
+            LibLoader::getFunctionPtr(platform.handle.get(),
+                                      "urGetDeviceProcAddrTable"));
+        if (getTable) {
+            platform.tables |= 1u << 11;
+            auto getTableResult =
+                getTable(version, &platform.dditable.ur.Device);
+            if (getTableResult != UR_RESULT_SUCCESS) {
+                return getTableResult;
+            }
+        }
+    }
+
+    updateHotDdiTable(platform.dditable);
+
+    return UR_RESULT_SUCCESS;
+}
+
 } // namespace ur_loader
 
 #if defined(__cplusplus)
@@ -4661,12 +5029,18 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetGlobalProcAddrTable(
         if (platform.initStatus != UR_RESULT_SUCCESS) {
             continue;
         }
+        if (!platform.handle) {
+            // not loaded yet, the lazy initialization fills the tables later
+            atLeastOneplatformValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ur_pfnGetGlobalProcAddrTable_t>(
             ur_loader::LibLoader::getFunctionPtr(platform.handle.get(),
                                                  "urGetGlobalProcAddrTable"));
         if (!getTable) {
             continue;
         }
+        platform.tables |= 1u << 0;
         auto getTableResult = getTable(version, &platform.dditable.ur.Global);
         if (getTableResult == UR_RESULT_SUCCESS) {
             atLeastOneplatformValid = true;
@@ -4692,6 +5066,9 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetGlobalProcAddrTable(
             // return pointers directly to platform's DDIs
             *pDdiTable =
                 ur_loader::context->platforms.front().dditable.ur.Global;
+            // initialization still goes through the loader, which records
+            // the init status of the adapters
+            pDdiTable->pfnInit = ur_loader::urInit;
         }
     }
 
@@ -4732,12 +5109,18 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetContextProcAddrTable(
         if (platform.initStatus != UR_RESULT_SUCCESS) {
             continue;
         }
+        if (!platform.handle) {
+            // not loaded yet, the lazy initialization fills the tables later
+            atLeastOneplatformValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ur_pfnGetContextProcAddrTable_t>(
             ur_loader::LibLoader::getFunctionPtr(platform.handle.get(),
                                                  "urGetContextProcAddrTable"));
         if (!getTable) {
             continue;
         }
+        platform.tables |= 1u << 1;
         auto getTableResult = getTable(version, &platform.dditable.ur.Context);
         if (getTableResult == UR_RESULT_SUCCESS) {
             atLeastOneplatformValid = true;
@@ -4809,12 +5192,18 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEnqueueProcAddrTable(
         if (platform.initStatus != UR_RESULT_SUCCESS) {
             continue;
         }
+        if (!platform.handle) {
+            // not loaded yet, the lazy initialization fills the tables later
+            atLeastOneplatformValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ur_pfnGetEnqueueProcAddrTable_t>(
             ur_loader::LibLoader::getFunctionPtr(platform.handle.get(),
                                                  "urGetEnqueueProcAddrTable"));
         if (!getTable) {
             continue;
         }
+        platform.tables |= 1u << 2;
         auto getTableResult = getTable(version, &platform.dditable.ur.Enqueue);
         if (getTableResult == UR_RESULT_SUCCESS) {
             atLeastOneplatformValid = true;
@@ -4906,12 +5295,18 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEventProcAddrTable(
         if (platform.initStatus != UR_RESULT_SUCCESS) {
             continue;
         }
+        if (!platform.handle) {
+            // not loaded yet, the lazy initialization fills the tables later
+            atLeastOneplatformValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ur_pfnGetEventProcAddrTable_t>(
             ur_loader::LibLoader::getFunctionPtr(platform.handle.get(),
                                                  "urGetEventProcAddrTable"));
         if (!getTable) {
             continue;
         }
+        platform.tables |= 1u << 3;
         auto getTableResult = getTable(version, &platform.dditable.ur.Event);
         if (getTableResult == UR_RESULT_SUCCESS) {
             atLeastOneplatformValid = true;
@@ -4983,12 +5378,18 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetKernelProcAddrTable(
         if (platform.initStatus != UR_RESULT_SUCCESS) {
             continue;
         }
+        if (!platform.handle) {
+            // not loaded yet, the lazy initialization fills the tables later
+            atLeastOneplatformValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ur_pfnGetKernelProcAddrTable_t>(
             ur_loader::LibLoader::getFunctionPtr(platform.handle.get(),
                                                  "urGetKernelProcAddrTable"));
         if (!getTable) {
             continue;
         }
+        platform.tables |= 1u << 4;
         auto getTableResult = getTable(version, &platform.dditable.ur.Kernel);
         if (getTableResult == UR_RESULT_SUCCESS) {
             atLeastOneplatformValid = true;
@@ -5068,12 +5469,18 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetMemProcAddrTable(
         if (platform.initStatus != UR_RESULT_SUCCESS) {
             continue;
         }
+        if (!platform.handle) {
+            // not loaded yet, the lazy initialization fills the tables later
+            atLeastOneplatformValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ur_pfnGetMemProcAddrTable_t>(
             ur_loader::LibLoader::getFunctionPtr(platform.handle.get(),
                                                  "urGetMemProcAddrTable"));
         if (!getTable) {
             continue;
         }
+        platform.tables |= 1u << 5;
         auto getTableResult = getTable(version, &platform.dditable.ur.Mem);
         if (getTableResult == UR_RESULT_SUCCESS) {
             atLeastOneplatformValid = true;
@@ -5145,12 +5552,18 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetPlatformProcAddrTable(
         if (platform.initStatus != UR_RESULT_SUCCESS) {
             continue;
         }
+        if (!platform.handle) {
+            // not loaded yet, the lazy initialization fills the tables later
+            atLeastOneplatformValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ur_pfnGetPlatformProcAddrTable_t>(
             ur_loader::LibLoader::getFunctionPtr(platform.handle.get(),
                                                  "urGetPlatformProcAddrTable"));
         if (!getTable) {
             continue;
         }
+        platform.tables |= 1u << 6;
         auto getTableResult = getTable(version, &platform.dditable.ur.Platform);
         if (getTableResult == UR_RESULT_SUCCESS) {
             atLeastOneplatformValid = true;
@@ -5222,12 +5635,18 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetProgramProcAddrTable(
         if (platform.initStatus != UR_RESULT_SUCCESS) {
             continue;
         }
+        if (!platform.handle) {
+            // not loaded yet, the lazy initialization fills the tables later
+            atLeastOneplatformValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ur_pfnGetProgramProcAddrTable_t>(
             ur_loader::LibLoader::getFunctionPtr(platform.handle.get(),
                                                  "urGetProgramProcAddrTable"));
         if (!getTable) {
             continue;
         }
+        platform.tables |= 1u << 7;
         auto getTableResult = getTable(version, &platform.dditable.ur.Program);
         if (getTableResult == UR_RESULT_SUCCESS) {
             atLeastOneplatformValid = true;
@@ -5307,12 +5726,18 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueProcAddrTable(
         if (platform.initStatus != UR_RESULT_SUCCESS) {
             continue;
         }
+        if (!platform.handle) {
+            // not loaded yet, the lazy initialization fills the tables later
+            atLeastOneplatformValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ur_pfnGetQueueProcAddrTable_t>(
             ur_loader::LibLoader::getFunctionPtr(platform.handle.get(),
                                                  "urGetQueueProcAddrTable"));
         if (!getTable) {
             continue;
         }
+        platform.tables |= 1u << 8;
         auto getTableResult = getTable(version, &platform.dditable.ur.Queue);
         if (getTableResult == UR_RESULT_SUCCESS) {
             atLeastOneplatformValid = true;
@@ -5384,12 +5809,18 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetSamplerProcAddrTable(
         if (platform.initStatus != UR_RESULT_SUCCESS) {
             continue;
         }
+        if (!platform.handle) {
+            // not loaded yet, the lazy initialization fills the tables later
+            atLeastOneplatformValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ur_pfnGetSamplerProcAddrTable_t>(
             ur_loader::LibLoader::getFunctionPtr(platform.handle.get(),
                                                  "urGetSamplerProcAddrTable"));
         if (!getTable) {
             continue;
         }
+        platform.tables |= 1u << 9;
         auto getTableResult = getTable(version, &platform.dditable.ur.Sampler);
         if (getTableResult == UR_RESULT_SUCCESS) {
             atLeastOneplatformValid = true;
@@ -5459,12 +5890,18 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetUSMProcAddrTable(
         if (platform.initStatus != UR_RESULT_SUCCESS) {
             continue;
         }
+        if (!platform.handle) {
+            // not loaded yet, the lazy initialization fills the tables later
+            atLeastOneplatformValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ur_pfnGetUSMProcAddrTable_t>(
             ur_loader::LibLoader::getFunctionPtr(platform.handle.get(),
                                                  "urGetUSMProcAddrTable"));
         if (!getTable) {
             continue;
         }
+        platform.tables |= 1u << 10;
         auto getTableResult = getTable(version, &platform.dditable.ur.USM);
         if (getTableResult == UR_RESULT_SUCCESS) {
             atLeastOneplatformValid = true;
@@ -5533,12 +5970,18 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetDeviceProcAddrTable(
         if (platform.initStatus != UR_RESULT_SUCCESS) {
             continue;
         }
+        if (!platform.handle) {
+            // not loaded yet, the lazy initialization fills the tables later
+            atLeastOneplatformValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ur_pfnGetDeviceProcAddrTable_t>(
             ur_loader::LibLoader::getFunctionPtr(platform.handle.get(),
                                                  "urGetDeviceProcAddrTable"));
         if (!getTable) {
             continue;
         }
+        platform.tables |= 1u << 11;
         auto getTableResult = getTable(version, &platform.dditable.ur.Device);
         if (getTableResult == UR_RESULT_SUCCESS) {
             atLeastOneplatformValid = true;
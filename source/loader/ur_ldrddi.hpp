@@ -12,7 +12,74 @@
 
 #include "ur_object.hpp"
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function pointers of the functions on the hot path, copied out of
+///        the platform's DDI tables and packed into a few cache lines
+struct hot_dditable_t {
+    ur_pfnEnqueueKernelLaunch_t pfnEnqueueKernelLaunch;
+    ur_pfnEnqueueEventsWait_t pfnEnqueueEventsWait;
+    ur_pfnEnqueueEventsWaitWithBarrier_t pfnEnqueueEventsWaitWithBarrier;
+    ur_pfnEnqueueMemBufferRead_t pfnEnqueueMemBufferRead;
+    ur_pfnEnqueueMemBufferWrite_t pfnEnqueueMemBufferWrite;
+    ur_pfnEnqueueMemBufferCopy_t pfnEnqueueMemBufferCopy;
+    ur_pfnEnqueueMemBufferFill_t pfnEnqueueMemBufferFill;
+    ur_pfnEnqueueMemBufferMap_t pfnEnqueueMemBufferMap;
+    ur_pfnEnqueueMemUnmap_t pfnEnqueueMemUnmap;
+    ur_pfnEnqueueUSMMemcpy_t pfnEnqueueUSMMemcpy;
+    ur_pfnEnqueueUSMFill_t pfnEnqueueUSMFill;
+    ur_pfnEnqueueUSMPrefetch_t pfnEnqueueUSMPrefetch;
+    ur_pfnEventWait_t pfnEventWait;
+    ur_pfnEventRelease_t pfnEventRelease;
+    ur_pfnEventRetain_t pfnEventRetain;
+    ur_pfnEventGetInfo_t pfnEventGetInfo;
+    ur_pfnUSMHostAlloc_t pfnUSMHostAlloc;
+    ur_pfnUSMDeviceAlloc_t pfnUSMDeviceAlloc;
+    ur_pfnUSMSharedAlloc_t pfnUSMSharedAlloc;
+    ur_pfnUSMFree_t pfnUSMFree;
+    ur_pfnKernelSetArgValue_t pfnKernelSetArgValue;
+    ur_pfnKernelSetArgPointer_t pfnKernelSetArgPointer;
+    ur_pfnKernelSetArgMemObj_t pfnKernelSetArgMemObj;
+    ur_pfnQueueFinish_t pfnQueueFinish;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+struct alignas(64) dditable_t {
+    hot_dditable_t hot;
+    ur_dditable_t ur;
+};
+
 namespace ur_loader {
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Copies the hot function pointers out of the DDI tables
+inline void updateHotDdiTable(dditable_t &dditable) {
+    dditable.hot.pfnEnqueueKernelLaunch = dditable.ur.Enqueue.pfnKernelLaunch;
+    dditable.hot.pfnEnqueueEventsWait = dditable.ur.Enqueue.pfnEventsWait;
+    dditable.hot.pfnEnqueueEventsWaitWithBarrier =
+        dditable.ur.Enqueue.pfnEventsWaitWithBarrier;
+    dditable.hot.pfnEnqueueMemBufferRead = dditable.ur.Enqueue.pfnMemBufferRead;
+    dditable.hot.pfnEnqueueMemBufferWrite =
+        dditable.ur.Enqueue.pfnMemBufferWrite;
+    dditable.hot.pfnEnqueueMemBufferCopy = dditable.ur.Enqueue.pfnMemBufferCopy;
+    dditable.hot.pfnEnqueueMemBufferFill = dditable.ur.Enqueue.pfnMemBufferFill;
+    dditable.hot.pfnEnqueueMemBufferMap = dditable.ur.Enqueue.pfnMemBufferMap;
+    dditable.hot.pfnEnqueueMemUnmap = dditable.ur.Enqueue.pfnMemUnmap;
+    dditable.hot.pfnEnqueueUSMMemcpy = dditable.ur.Enqueue.pfnUSMMemcpy;
+    dditable.hot.pfnEnqueueUSMFill = dditable.ur.Enqueue.pfnUSMFill;
+    dditable.hot.pfnEnqueueUSMPrefetch = dditable.ur.Enqueue.pfnUSMPrefetch;
+    dditable.hot.pfnEventWait = dditable.ur.Event.pfnWait;
+    dditable.hot.pfnEventRelease = dditable.ur.Event.pfnRelease;
+    dditable.hot.pfnEventRetain = dditable.ur.Event.pfnRetain;
+    dditable.hot.pfnEventGetInfo = dditable.ur.Event.pfnGetInfo;
+    dditable.hot.pfnUSMHostAlloc = dditable.ur.USM.pfnHostAlloc;
+    dditable.hot.pfnUSMDeviceAlloc = dditable.ur.USM.pfnDeviceAlloc;
+    dditable.hot.pfnUSMSharedAlloc = dditable.ur.USM.pfnSharedAlloc;
+    dditable.hot.pfnUSMFree = dditable.ur.USM.pfnFree;
+    dditable.hot.pfnKernelSetArgValue = dditable.ur.Kernel.pfnSetArgValue;
+    dditable.hot.pfnKernelSetArgPointer = dditable.ur.Kernel.pfnSetArgPointer;
+    dditable.hot.pfnKernelSetArgMemObj = dditable.ur.Kernel.pfnSetArgMemObj;
+    dditable.hot.pfnQueueFinish = dditable.ur.Queue.pfnFinish;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 using ur_platform_object_t = object_t<ur_platform_handle_t>;
 using ur_platform_factory_t =
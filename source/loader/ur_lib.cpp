@@ -7,6 +7,8 @@
  * @file ur_lib.cpp
  *
  */
+#include <chrono>
+
 #include "ur_lib.hpp"
 #include "logger/ur_logger.hpp"
 #include "ur_loader.hpp"
@@ -37,7 +39,15 @@ __urdlllocal ur_result_t context_t::Init(ur_device_init_flags_t device_flags) {
     result = ur_loader::context->init();
 
     if (UR_RESULT_SUCCESS == result) {
+        auto start = std::chrono::steady_clock::now();
         result = urInit();
+        if (UR_RESULT_SUCCESS == result) {
+            ur_loader::context->updateHotDdiTables();
+        }
+        logger::info("Adapter DDI tables retrieved in {} us",
+                     std::chrono::duration_cast<std::chrono::microseconds>(
+                         std::chrono::steady_clock::now() - start)
+                         .count());
     }
 
     proxy_layer_context_t *layers[] = {
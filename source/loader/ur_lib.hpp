@@ -36,7 +36,9 @@ class context_t {
     ur_dditable_t urDdiTable = {};
 };
 
-extern context_t *context;
+/// hidden, so that the exported API functions reach the dispatch table
+/// without going through the GOT
+extern __urdlllocal context_t *context;
 
 } // namespace ur_lib
 
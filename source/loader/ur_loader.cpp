@@ -5,18 +5,64 @@
  * SPDX-License-Identifier: MIT
  *
  */
+#include <chrono>
+#include <system_error>
+#include <thread>
+
 #include "ur_loader.hpp"
 
 namespace ur_loader {
 ///////////////////////////////////////////////////////////////////////////////
 context_t *context;
 
+///////////////////////////////////////////////////////////////////////////////
+static long long elapsedUs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - start)
+        .count();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 ur_result_t context_t::init() {
+    lazyInit = getenv_tobool("UR_ENABLE_LOADER_LAZY_INIT");
+
+    try {
+        auto cacheFile = ur_getenv("UR_ADAPTERS_CACHE");
+        if (cacheFile) {
+            adapter_cache = AdapterCache(*cacheFile);
+            adapter_cache.load();
+        }
+    } catch (const std::invalid_argument &e) {
+        logger::error(e.what());
+    }
+
+    // Libraries are loaded one after another, the dynamic linker serializes
+    // the loading (including the library constructors) anyway.
     for (const auto &name : adapter_registry) {
-        auto handle = LibLoader::loadAdapterLibrary(name.c_str());
-        if (handle) {
-            platforms.emplace_back(std::move(handle));
+        platform_t platform(nullptr, name);
+        auto cached = adapter_cache.find(name);
+        if (cached) {
+            if (cached->unusable()) {
+                logger::info("Adapter {} skipped, its library provides no "
+                             "global DDI table",
+                             name);
+                continue;
+            }
+            platform.cachedPath = cached->path;
+        }
+
+        if (lazyInit) {
+            platforms.emplace_back(std::move(platform));
+            continue;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        platform.handle = loadAdapter(platform);
+        if (platform.handle) {
+            logger::info("Adapter {} loaded in {} us", name, elapsedUs(start));
+            platforms.emplace_back(std::move(platform));
+        } else {
+            logger::info("Adapter {} not loaded", name);
         }
     }
 
@@ -24,7 +70,9 @@ ur_result_t context_t::init() {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    forceIntercept = getenv_tobool("UR_ENABLE_LOADER_INTERCEPT");
+    // the DDIs of lazily loaded adapters are not known upfront, the calls
+    // must always go through the loader
+    forceIntercept = getenv_tobool("UR_ENABLE_LOADER_INTERCEPT") || lazyInit;
 
     if (forceIntercept || platforms.size() > 1) {
         intercept_enabled = true;
@@ -33,4 +81,158 @@ ur_result_t context_t::init() {
     return UR_RESULT_SUCCESS;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void context_t::forEachPlatform(
+    const char *stage, const std::function<void(platform_t &)> &func) {
+    auto start = std::chrono::steady_clock::now();
+    std::vector<long long> times(platforms.size());
+
+    auto run = [&](size_t i) {
+        auto platformStart = std::chrono::steady_clock::now();
+        func(platforms[i]);
+        times[i] = elapsedUs(platformStart);
+    };
+
+    // the first platform is handled by the calling thread
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < platforms.size(); ++i) {
+        try {
+            threads.emplace_back(run, i);
+        } catch (const std::system_error &) {
+            run(i);
+        }
+    }
+    if (!platforms.empty()) {
+        run(0);
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    // the sinks are not thread-safe, log once all the work is done
+    for (size_t i = 0; i < platforms.size(); ++i) {
+        logger::info("Adapter {} {} in {} us", platforms[i].name, stage,
+                     times[i]);
+    }
+    logger::info("All adapters {} in {} us", stage, elapsedUs(start));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void context_t::lazyLoadPlatform(platform_t &platform) {
+    platform.lazyInitDone = true;
+
+    auto start = std::chrono::steady_clock::now();
+    platform.handle = loadAdapter(platform);
+    if (platform.handle) {
+        logger::info("Adapter {} loaded in {} us", platform.name,
+                     elapsedUs(start));
+    } else {
+        logger::info("Adapter {} not loaded", platform.name);
+        platform.initStatus = UR_RESULT_ERROR_UNINITIALIZED;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void context_t::lazyInitLoadedPlatform(platform_t &platform) {
+    if (platform.initStatus != UR_RESULT_SUCCESS) {
+        return;
+    }
+    platform.initStatus = getDdiTables(platform);
+    if (platform.initStatus != UR_RESULT_SUCCESS) {
+        return;
+    }
+    platform.initStatus = platform.dditable.ur.Global.pfnInit(lazyInitFlags);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void context_t::lazyInitPlatform(platform_t &platform) {
+    if (!lazyInit) {
+        return;
+    }
+
+    std::scoped_lock<std::mutex> lock(lazyInitMutex);
+    if (platform.lazyInitDone) {
+        return;
+    }
+
+    lazyLoadPlatform(platform);
+    auto start = std::chrono::steady_clock::now();
+    lazyInitLoadedPlatform(platform);
+    logger::info("Adapter {} initialized in {} us", platform.name,
+                 elapsedUs(start));
+
+    updateAdapterCache();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void context_t::lazyInitPlatforms() {
+    if (!lazyInit) {
+        return;
+    }
+
+    std::scoped_lock<std::mutex> lock(lazyInitMutex);
+    std::vector<bool> pending(platforms.size());
+    bool anyPending = false;
+    for (size_t i = 0; i < platforms.size(); ++i) {
+        if (!platforms[i].lazyInitDone) {
+            pending[i] = true;
+            anyPending = true;
+            lazyLoadPlatform(platforms[i]);
+        }
+    }
+    if (!anyPending) {
+        return;
+    }
+
+    forEachPlatform("initialized", [&](platform_t &platform) {
+        if (pending[&platform - platforms.data()]) {
+            lazyInitLoadedPlatform(platform);
+        }
+    });
+
+    updateAdapterCache();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void context_t::updateHotDdiTables() {
+    for (auto &platform : platforms) {
+        if (platform.handle) {
+            updateHotDdiTable(platform.dditable);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void context_t::updateAdapterCache() {
+    if (!adapter_cache.enabled()) {
+        return;
+    }
+
+    for (auto &platform : platforms) {
+        if (platform.handle) {
+            adapter_cache.update(
+                platform.name,
+                LibLoader::getLibraryPath(platform.handle.get()),
+                platform.tables);
+        }
+    }
+
+    if (!adapter_cache.save()) {
+        logger::warning("Failed to save the adapter cache");
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::unique_ptr<HMODULE, LibLoader::lib_dtor>
+context_t::loadAdapter(const platform_t &platform) {
+    if (!platform.cachedPath.empty()) {
+        auto handle =
+            LibLoader::loadAdapterLibrary(platform.cachedPath.c_str());
+        if (handle) {
+            return handle;
+        }
+    }
+    return LibLoader::loadAdapterLibrary(platform.name.c_str());
+}
+
 } // namespace ur_loader
@@ -9,6 +9,10 @@
 #ifndef UR_LOADER_HPP
 #define UR_LOADER_HPP 1
 
+#include <functional>
+#include <mutex>
+
+#include "ur_adapter_cache.hpp"
 #include "ur_adapter_registry.hpp"
 #include "ur_ldrddi.hpp"
 #include "ur_lib_loader.hpp"
@@ -16,11 +20,18 @@
 namespace ur_loader {
 
 struct platform_t {
-    platform_t(std::unique_ptr<HMODULE, LibLoader::lib_dtor> handle)
-        : handle(std::move(handle)) {}
+    platform_t(std::unique_ptr<HMODULE, LibLoader::lib_dtor> handle,
+               const std::string &name)
+        : handle(std::move(handle)), name(name) {}
 
     std::unique_ptr<HMODULE, LibLoader::lib_dtor> handle;
+    std::string name;
+    /// the path the library was resolved to by an earlier process, if cached
+    std::string cachedPath;
     ur_result_t initStatus = UR_RESULT_SUCCESS;
+    uint32_t tables = 0; ///< bitmask of the DDI tables the library provides
+    /// whether the lazy initialization already loaded and initialized it
+    bool lazyInitDone = false;
     dditable_t dditable = {};
 };
 
@@ -32,14 +43,58 @@ class context_t {
 
     platform_vector_t platforms;
     AdapterRegistry adapter_registry;
+    AdapterCache adapter_cache;
 
     bool forceIntercept = false;
 
     ur_result_t init();
     bool intercept_enabled = false;
+
+    /// with UR_ENABLE_LOADER_LAZY_INIT set, the adapters are only loaded and
+    /// initialized once urPlatformGet needs their platforms, urInit just
+    /// records its flags
+    bool lazyInit = false;
+    ur_device_init_flags_t lazyInitFlags = 0;
+    std::mutex lazyInitMutex;
+
+    /// loads and initializes an adapter deferred by the lazy initialization
+    /// no-op once done, or if the lazy initialization is not enabled
+    void lazyInitPlatform(platform_t &platform);
+
+    /// loads and initializes all the adapters deferred by the lazy
+    /// initialization, concurrently
+    void lazyInitPlatforms();
+
+    /// fills the DDI tables of a loaded platform from its library
+    ur_result_t getDdiTables(platform_t &platform);
+
+    /// copies the hot function pointers of the loaded platforms, once all
+    /// their DDI tables are filled
+    void updateHotDdiTables();
+
+    /// records the loaded platforms in the adapter cache and saves it,
+    /// the cache is enabled by setting UR_ADAPTERS_CACHE to a file path
+    void updateAdapterCache();
+
+    /// calls func once for every platform, concurrently when there are
+    /// several platforms, func must only modify the platform it is given
+    /// the time spent on each platform is logged under the stage name
+    void forEachPlatform(const char *stage,
+                         const std::function<void(platform_t &)> &func);
+
+  private:
+    /// loads the library of a lazily initialized adapter
+    void lazyLoadPlatform(platform_t &platform);
+
+    /// fills the DDI tables of a lazily loaded adapter and initializes it
+    void lazyInitLoadedPlatform(platform_t &platform);
+
+    /// loads the library of an adapter, from its cached path if known
+    std::unique_ptr<HMODULE, LibLoader::lib_dtor>
+    loadAdapter(const platform_t &platform);
 };
 
-extern context_t *context;
+extern __urdlllocal context_t *context;
 extern ur_event_factory_t ur_event_factory;
 
 } // namespace ur_loader
@@ -16,11 +16,8 @@
 #include "ur_util.hpp"
 
 //////////////////////////////////////////////////////////////////////////
-struct dditable_t {
-    ur_dditable_t ur;
-    // urs_dditable_t  urs;
-    // urt_dditable_t  urt;
-};
+/// the platform's DDI tables, see ur_ldrddi.hpp
+struct dditable_t;
 
 //////////////////////////////////////////////////////////////////////////
 template <typename _handle_t> class __urdlllocal object_t {
@@ -0,0 +1,56 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: MIT
+
+// registers an XPTI callback for the "ur" stream either before or after
+// urInit, and checks that only the one registered before is notified, the
+// tracing layer looks for subscribers only up to urInit
+
+#include <cstdio>
+#include <cstring>
+
+#include "ur_api.h"
+#include "xpti/xpti_trace_framework.h"
+
+static int notifications = 0;
+
+XPTI_CALLBACK_API void count_cb(uint16_t, xpti::trace_event_data_t *,
+                                xpti::trace_event_data_t *, uint64_t,
+                                const void *) {
+    ++notifications;
+}
+
+static void subscribe() {
+    uint8_t stream_id = xptiRegisterStream("ur");
+    xptiRegisterCallback(
+        stream_id, (uint16_t)xpti::trace_point_type_t::function_with_args_begin,
+        count_cb);
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 2 || (std::strcmp(argv[1], "before") != 0 &&
+                      std::strcmp(argv[1], "after") != 0)) {
+        std::fprintf(stderr, "usage: %s before|after\n", argv[0]);
+        return 1;
+    }
+    bool before = std::strcmp(argv[1], "before") == 0;
+
+    if (before) {
+        subscribe();
+    }
+    if (urInit(0) != UR_RESULT_SUCCESS) {
+        std::fprintf(stderr, "urInit failed\n");
+        return 1;
+    }
+    if (!before) {
+        subscribe();
+    }
+
+    notifications = 0;
+    uint32_t count = 0;
+    urPlatformGet(0, nullptr, &count);
+    urTearDown(nullptr);
+
+    std::printf("registered %s urInit: %d notification(s)\n", argv[1],
+                notifications);
+    return (notifications > 0) == before ? 0 : 1;
+}
@@ -54,3 +54,12 @@ TEST_F(valDeviceTest, testUrContextReleaseNonexistent) {
     ur_context_handle_t context = (ur_context_handle_t)0xC0FFEE;
     ASSERT_EQ(urContextRelease(context), UR_RESULT_SUCCESS);
 }
+
+TEST_F(valDeviceTest, testUrContextCreateLeakSameSite) {
+    for (int i = 0; i < 3; i++) {
+        ur_context_handle_t context = nullptr;
+        ASSERT_EQ(urContextCreate(1, &device, nullptr, &context),
+                  UR_RESULT_SUCCESS);
+        ASSERT_NE(nullptr, context);
+    }
+}
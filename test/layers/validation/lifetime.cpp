@@ -0,0 +1,176 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: MIT
+
+#include "fixtures.hpp"
+
+struct valLifetimeTest : valDeviceTest {
+
+    void SetUp() override {
+        valDeviceTest::SetUp();
+        ASSERT_EQ(urContextCreate(1, &device, nullptr, &context),
+                  UR_RESULT_SUCCESS);
+    }
+
+    void TearDown() override {
+        ASSERT_EQ(urContextRelease(context), UR_RESULT_SUCCESS);
+        valDeviceTest::TearDown();
+    }
+
+    void createKernel(ur_program_handle_t &program,
+                      ur_kernel_handle_t &kernel) {
+        ASSERT_EQ(urProgramCreateWithIL(context, il, sizeof(il), nullptr,
+                                        &program),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(urKernelCreate(program, "kernel", &kernel),
+                  UR_RESULT_SUCCESS);
+    }
+
+    ur_context_handle_t context = nullptr;
+    const uint8_t il[4] = {0x03, 0x02, 0x23, 0x07};
+    size_t offset[1] = {0};
+    size_t size[1] = {16};
+};
+
+TEST_F(valLifetimeTest, ReleasedContext) {
+    ur_context_handle_t released = nullptr;
+    ASSERT_EQ(urContextCreate(1, &device, nullptr, &released),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(urContextRetain(released), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urContextRelease(released), UR_RESULT_SUCCESS);
+    // a reference is still held
+    ASSERT_EQ(urContextRetain(released), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urContextRelease(released), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urContextRelease(released), UR_RESULT_SUCCESS);
+
+    ur_queue_handle_t queue = nullptr;
+    ASSERT_EQ(urQueueCreate(released, device, nullptr, &queue),
+              UR_RESULT_ERROR_INVALID_CONTEXT);
+    ASSERT_EQ(urContextRelease(released), UR_RESULT_ERROR_INVALID_CONTEXT);
+}
+
+TEST_F(valLifetimeTest, ReleasedMem) {
+    ur_mem_handle_t buffer = nullptr;
+    ASSERT_EQ(urMemBufferCreate(context, UR_MEM_FLAG_READ_WRITE, 16, nullptr,
+                                &buffer),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(urMemRetain(buffer), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urMemRelease(buffer), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urMemRelease(buffer), UR_RESULT_SUCCESS);
+
+    ASSERT_EQ(urMemRetain(buffer), UR_RESULT_ERROR_INVALID_MEM_OBJECT);
+}
+
+TEST_F(valLifetimeTest, ReleasedSampler) {
+    ur_sampler_desc_t desc = {UR_STRUCTURE_TYPE_SAMPLER_DESC, nullptr, false,
+                              UR_SAMPLER_ADDRESSING_MODE_NONE,
+                              UR_SAMPLER_FILTER_MODE_NEAREST};
+    ur_sampler_handle_t sampler = nullptr;
+    ASSERT_EQ(urSamplerCreate(context, &desc, &sampler), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urSamplerRelease(sampler), UR_RESULT_SUCCESS);
+
+    ASSERT_EQ(urSamplerRetain(sampler), UR_RESULT_ERROR_INVALID_SAMPLER);
+}
+
+TEST_F(valLifetimeTest, ReleasedProgram) {
+    ur_program_handle_t program = nullptr;
+    ur_kernel_handle_t kernel = nullptr;
+    createKernel(program, kernel);
+    ASSERT_EQ(urKernelRelease(kernel), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urProgramRelease(program), UR_RESULT_SUCCESS);
+
+    ASSERT_EQ(urKernelCreate(program, "kernel", &kernel),
+              UR_RESULT_ERROR_INVALID_PROGRAM);
+}
+
+TEST_F(valLifetimeTest, ReleasedKernel) {
+    ur_program_handle_t program = nullptr;
+    ur_kernel_handle_t kernel = nullptr;
+    createKernel(program, kernel);
+    uint32_t value = 42;
+    ASSERT_EQ(urKernelSetArgValue(kernel, 0, sizeof(value), &value),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(urKernelRelease(kernel), UR_RESULT_SUCCESS);
+
+    ASSERT_EQ(urKernelSetArgValue(kernel, 0, sizeof(value), &value),
+              UR_RESULT_ERROR_INVALID_KERNEL);
+    ASSERT_EQ(urProgramRelease(program), UR_RESULT_SUCCESS);
+}
+
+TEST_F(valLifetimeTest, ReleasedQueue) {
+    ur_program_handle_t program = nullptr;
+    ur_kernel_handle_t kernel = nullptr;
+    createKernel(program, kernel);
+    ur_queue_handle_t queue = nullptr;
+    ASSERT_EQ(urQueueCreate(context, device, nullptr, &queue),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(urQueueRelease(queue), UR_RESULT_SUCCESS);
+
+    ASSERT_EQ(urEnqueueKernelLaunch(queue, kernel, 1, offset, size, nullptr,
+                                    0, nullptr, nullptr),
+              UR_RESULT_ERROR_INVALID_QUEUE);
+    ASSERT_EQ(urKernelRelease(kernel), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urProgramRelease(program), UR_RESULT_SUCCESS);
+}
+
+TEST_F(valLifetimeTest, ReleasedEvent) {
+    ur_program_handle_t program = nullptr;
+    ur_kernel_handle_t kernel = nullptr;
+    createKernel(program, kernel);
+    ur_queue_handle_t queue = nullptr;
+    ASSERT_EQ(urQueueCreate(context, device, nullptr, &queue),
+              UR_RESULT_SUCCESS);
+
+    ur_event_handle_t events[2] = {};
+    for (auto &event : events) {
+        ASSERT_EQ(urEnqueueKernelLaunch(queue, kernel, 1, offset, size,
+                                        nullptr, 0, nullptr, &event),
+                  UR_RESULT_SUCCESS);
+    }
+    ASSERT_EQ(urEventWait(2, events), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urEventRelease(events[1]), UR_RESULT_SUCCESS);
+
+    ASSERT_EQ(urEventWait(2, events), UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST);
+    ASSERT_EQ(urEventRetain(events[1]), UR_RESULT_ERROR_INVALID_EVENT);
+    ASSERT_EQ(urEventRelease(events[0]), UR_RESULT_SUCCESS);
+
+    ASSERT_EQ(urQueueRelease(queue), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urKernelRelease(kernel), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urProgramRelease(program), UR_RESULT_SUCCESS);
+}
+
+TEST_F(valLifetimeTest, DestroyedUSMPool) {
+    ur_usm_pool_desc_t desc = {UR_STRUCTURE_TYPE_USM_POOL_DESC, nullptr, 0};
+    ur_usm_pool_handle_t pool = nullptr;
+    ASSERT_EQ(urUSMPoolCreate(context, &desc, &pool), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urUSMPoolDestroy(context, pool), UR_RESULT_SUCCESS);
+
+    ASSERT_EQ(urUSMPoolDestroy(context, pool),
+              UR_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(valLifetimeTest, NeverCreatedHandle) {
+    auto queue = reinterpret_cast<ur_queue_handle_t>(0x1000);
+    ASSERT_EQ(urQueueFinish(queue), UR_RESULT_ERROR_INVALID_QUEUE);
+}
+
+TEST_F(valLifetimeTest, ManyHandles) {
+    // enough handles for the live handle tables to grow several times
+    std::vector<ur_mem_handle_t> buffers(2048);
+    for (auto &buffer : buffers) {
+        ASSERT_EQ(urMemBufferCreate(context, UR_MEM_FLAG_READ_WRITE, 16,
+                                    nullptr, &buffer),
+                  UR_RESULT_SUCCESS);
+    }
+    for (size_t i = 0; i < buffers.size(); i += 2) {
+        ASSERT_EQ(urMemRelease(buffers[i]), UR_RESULT_SUCCESS);
+    }
+    for (size_t i = 0; i < buffers.size(); i++) {
+        ASSERT_EQ(urMemRetain(buffers[i]),
+                  i % 2 ? UR_RESULT_SUCCESS
+                        : UR_RESULT_ERROR_INVALID_MEM_OBJECT);
+    }
+    for (size_t i = 1; i < buffers.size(); i += 2) {
+        ASSERT_EQ(urMemRelease(buffers[i]), UR_RESULT_SUCCESS);
+        ASSERT_EQ(urMemRelease(buffers[i]), UR_RESULT_SUCCESS);
+    }
+}
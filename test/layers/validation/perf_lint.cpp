@@ -0,0 +1,117 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: MIT
+
+#include "fixtures.hpp"
+
+struct valPerfLintTest : valDeviceTest {
+
+    void SetUp() override {
+        valDeviceTest::SetUp();
+        ASSERT_EQ(urContextCreate(1, &device, nullptr, &context),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(urQueueCreate(context, device, nullptr, &queue),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(urMemBufferCreate(context, UR_MEM_FLAG_READ_WRITE,
+                                    sizeof(host), nullptr, &buffer),
+                  UR_RESULT_SUCCESS);
+    }
+
+    void TearDown() override {
+        ASSERT_EQ(urMemRelease(buffer), UR_RESULT_SUCCESS);
+        ASSERT_EQ(urQueueRelease(queue), UR_RESULT_SUCCESS);
+        ASSERT_EQ(urContextRelease(context), UR_RESULT_SUCCESS);
+        valDeviceTest::TearDown();
+    }
+
+    ur_result_t read(bool blocking) {
+        return urEnqueueMemBufferRead(queue, buffer, blocking, 0,
+                                      sizeof(host), host, 0, nullptr,
+                                      nullptr);
+    }
+
+    ur_context_handle_t context = nullptr;
+    ur_queue_handle_t queue = nullptr;
+    ur_mem_handle_t buffer = nullptr;
+    uint8_t host[512] = {};
+    const uint8_t il[4] = {0x03, 0x02, 0x23, 0x07};
+};
+
+TEST_F(valPerfLintTest, BlockingReadInLoop) {
+    for (int i = 0; i < 4; i++) {
+        ASSERT_EQ(read(true), UR_RESULT_SUCCESS);
+    }
+    // a single blocking read from each call site is not reported
+    ASSERT_EQ(read(true), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urQueueFinish(queue), UR_RESULT_SUCCESS);
+}
+
+TEST_F(valPerfLintTest, FinishAfterEachEnqueue) {
+    for (int i = 0; i < 3; i++) {
+        ASSERT_EQ(read(false), UR_RESULT_SUCCESS);
+        ASSERT_EQ(urQueueFinish(queue), UR_RESULT_SUCCESS);
+    }
+    // a single finish after an enqueue from each call site is not reported
+    ASSERT_EQ(read(false), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urQueueFinish(queue), UR_RESULT_SUCCESS);
+    ASSERT_EQ(read(false), UR_RESULT_SUCCESS);
+    ASSERT_EQ(read(false), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urQueueFinish(queue), UR_RESULT_SUCCESS);
+}
+
+TEST_F(valPerfLintTest, UnchangedArgValue) {
+    ur_program_handle_t program = nullptr;
+    ASSERT_EQ(urProgramCreateWithIL(context, il, sizeof(il), nullptr,
+                                    &program),
+              UR_RESULT_SUCCESS);
+    ur_kernel_handle_t kernel = nullptr;
+    ASSERT_EQ(urKernelCreate(program, "kernel", &kernel), UR_RESULT_SUCCESS);
+
+    uint32_t value = 42;
+    ASSERT_EQ(urKernelSetArgValue(kernel, 0, sizeof(value), &value),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(urKernelSetArgValue(kernel, 1, sizeof(value), &value),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(urKernelSetArgValue(kernel, 0, sizeof(value), &value),
+              UR_RESULT_SUCCESS);
+    value = 43;
+    ASSERT_EQ(urKernelSetArgValue(kernel, 0, sizeof(value), &value),
+              UR_RESULT_SUCCESS);
+
+    // the argument no longer holds the value once set by other means
+    ASSERT_EQ(urKernelSetArgPointer(kernel, 0, nullptr), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urKernelSetArgValue(kernel, 0, sizeof(value), &value),
+              UR_RESULT_SUCCESS);
+
+    ASSERT_EQ(urKernelRelease(kernel), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urProgramRelease(program), UR_RESULT_SUCCESS);
+}
+
+TEST_F(valPerfLintTest, TinyCopiesInLoop) {
+    void *allocation = nullptr;
+    ASSERT_EQ(urUSMHostAlloc(context, nullptr, nullptr, sizeof(host),
+                             &allocation),
+              UR_RESULT_SUCCESS);
+    for (size_t offset = 0; offset < 64; offset += 16) {
+        ASSERT_EQ(urEnqueueUSMMemcpy(queue, true, allocation, host + offset,
+                                     16, 0, nullptr, nullptr),
+                  UR_RESULT_SUCCESS);
+    }
+    for (int i = 0; i < 2; i++) {
+        ASSERT_EQ(urEnqueueUSMMemcpy(queue, true, allocation, host,
+                                     sizeof(host), 0, nullptr, nullptr),
+                  UR_RESULT_SUCCESS);
+    }
+    ASSERT_EQ(urUSMFree(context, allocation), UR_RESULT_SUCCESS);
+}
+
+TEST_F(valPerfLintTest, IdenticalProgramIL) {
+    ur_program_handle_t programs[2] = {};
+    for (auto &program : programs) {
+        ASSERT_EQ(urProgramCreateWithIL(context, il, sizeof(il), nullptr,
+                                        &program),
+                  UR_RESULT_SUCCESS);
+    }
+    for (auto &program : programs) {
+        ASSERT_EQ(urProgramRelease(program), UR_RESULT_SUCCESS);
+    }
+}
@@ -0,0 +1,143 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: MIT
+
+#include "fixtures.hpp"
+
+struct valUSMTest : valDeviceTest {
+
+    void SetUp() override {
+        valDeviceTest::SetUp();
+        ASSERT_EQ(urContextCreate(1, &device, nullptr, &context),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(urQueueCreate(context, device, nullptr, &queue),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(urUSMDeviceAlloc(context, device, nullptr, nullptr,
+                                   ALLOCATION_SIZE, &allocation),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(urUSMSharedAlloc(context, device, nullptr, nullptr,
+                                   ALLOCATION_SIZE, &other),
+                  UR_RESULT_SUCCESS);
+    }
+
+    void TearDown() override {
+        ASSERT_EQ(urUSMFree(context, other), UR_RESULT_SUCCESS);
+        ASSERT_EQ(urUSMFree(context, allocation), UR_RESULT_SUCCESS);
+        ASSERT_EQ(urQueueRelease(queue), UR_RESULT_SUCCESS);
+        ASSERT_EQ(urContextRelease(context), UR_RESULT_SUCCESS);
+        valDeviceTest::TearDown();
+    }
+
+    uint8_t *at(size_t offset) {
+        return static_cast<uint8_t *>(allocation) + offset;
+    }
+
+    static constexpr size_t ALLOCATION_SIZE = 64;
+    ur_context_handle_t context = nullptr;
+    ur_queue_handle_t queue = nullptr;
+    void *allocation = nullptr;
+    void *other = nullptr;
+    uint8_t host[2 * ALLOCATION_SIZE] = {};
+};
+
+TEST_F(valUSMTest, MemcpyOutOfBounds) {
+    ASSERT_EQ(urEnqueueUSMMemcpy(queue, true, allocation, host,
+                                 ALLOCATION_SIZE, 0, nullptr, nullptr),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(urEnqueueUSMMemcpy(queue, true, at(16), other, 48, 0, nullptr,
+                                 nullptr),
+              UR_RESULT_SUCCESS);
+
+    ASSERT_EQ(urEnqueueUSMMemcpy(queue, true, allocation, host,
+                                 ALLOCATION_SIZE + 1, 0, nullptr, nullptr),
+              UR_RESULT_ERROR_INVALID_SIZE);
+    ASSERT_EQ(urEnqueueUSMMemcpy(queue, true, host, at(32), 33, 0, nullptr,
+                                 nullptr),
+              UR_RESULT_ERROR_INVALID_SIZE);
+}
+
+TEST_F(valUSMTest, MemcpyOverlapping) {
+    ASSERT_EQ(urEnqueueUSMMemcpy(queue, true, at(0), at(32), 32, 0, nullptr,
+                                 nullptr),
+              UR_RESULT_SUCCESS);
+
+    ASSERT_EQ(urEnqueueUSMMemcpy(queue, true, at(0), at(16), 32, 0, nullptr,
+                                 nullptr),
+              UR_RESULT_ERROR_OVERLAPPING_REGIONS);
+    ASSERT_EQ(urEnqueueUSMMemcpy(queue, true, at(16), at(0), 32, 0, nullptr,
+                                 nullptr),
+              UR_RESULT_ERROR_OVERLAPPING_REGIONS);
+}
+
+TEST_F(valUSMTest, FillOutOfBounds) {
+    uint32_t pattern = 42;
+    ASSERT_EQ(urEnqueueUSMFill(queue, at(32), sizeof(pattern), &pattern, 32,
+                               0, nullptr, nullptr),
+              UR_RESULT_SUCCESS);
+
+    ASSERT_EQ(urEnqueueUSMFill(queue, at(32), sizeof(pattern), &pattern, 36,
+                               0, nullptr, nullptr),
+              UR_RESULT_ERROR_INVALID_SIZE);
+}
+
+TEST_F(valUSMTest, PrefetchAndAdviseOutOfBounds) {
+    ASSERT_EQ(urEnqueueUSMPrefetch(queue, allocation, ALLOCATION_SIZE, 0, 0,
+                                   nullptr, nullptr),
+              UR_RESULT_SUCCESS);
+
+    ASSERT_EQ(urEnqueueUSMPrefetch(queue, at(1), ALLOCATION_SIZE, 0, 0,
+                                   nullptr, nullptr),
+              UR_RESULT_ERROR_INVALID_SIZE);
+    ASSERT_EQ(urEnqueueUSMAdvise(queue, at(1), ALLOCATION_SIZE,
+                                 UR_USM_ADVICE_FLAG_DEFAULT, nullptr),
+              UR_RESULT_ERROR_INVALID_SIZE);
+}
+
+TEST_F(valUSMTest, Fill2DOutOfBounds) {
+    uint8_t pattern = 42;
+    // the last row does not need to be padded to the pitch
+    ASSERT_EQ(urEnqueueUSMFill2D(queue, allocation, 16, sizeof(pattern),
+                                 &pattern, 8, 4, 0, nullptr, nullptr),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(urEnqueueUSMFill2D(queue, at(8), 16, sizeof(pattern), &pattern,
+                                 8, 4, 0, nullptr, nullptr),
+              UR_RESULT_SUCCESS);
+
+    ASSERT_EQ(urEnqueueUSMFill2D(queue, at(9), 16, sizeof(pattern), &pattern,
+                                 8, 4, 0, nullptr, nullptr),
+              UR_RESULT_ERROR_INVALID_SIZE);
+}
+
+TEST_F(valUSMTest, Memcpy2D) {
+    // the rows of the regions interleave
+    ASSERT_EQ(urEnqueueUSMMemcpy2D(queue, true, at(0), 16, at(8), 16, 8, 4, 0,
+                                   nullptr, nullptr),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(urEnqueueUSMMemcpy2D(queue, true, at(0), 32, at(8), 8, 8, 2, 0,
+                                   nullptr, nullptr),
+              UR_RESULT_SUCCESS);
+
+    ASSERT_EQ(urEnqueueUSMMemcpy2D(queue, true, at(0), 16, at(4), 16, 8, 4, 0,
+                                   nullptr, nullptr),
+              UR_RESULT_ERROR_OVERLAPPING_REGIONS);
+    ASSERT_EQ(urEnqueueUSMMemcpy2D(queue, true, at(0), 24, at(8), 8, 8, 3, 0,
+                                   nullptr, nullptr),
+              UR_RESULT_ERROR_OVERLAPPING_REGIONS);
+    ASSERT_EQ(urEnqueueUSMMemcpy2D(queue, true, host, 16, at(0), 32, 8, 3, 0,
+                                   nullptr, nullptr),
+              UR_RESULT_ERROR_INVALID_SIZE);
+}
+
+TEST_F(valUSMTest, FreedAllocation) {
+    void *freed = nullptr;
+    ASSERT_EQ(urUSMHostAlloc(context, nullptr, nullptr, 16, &freed),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(urEnqueueUSMMemcpy(queue, true, freed, host, 32, 0, nullptr,
+                                 nullptr),
+              UR_RESULT_ERROR_INVALID_SIZE);
+    ASSERT_EQ(urUSMFree(context, freed), UR_RESULT_SUCCESS);
+
+    // the memory is no longer known to the layer
+    ASSERT_EQ(urEnqueueUSMMemcpy(queue, true, freed, host, 32, 0, nullptr,
+                                 nullptr),
+              UR_RESULT_SUCCESS);
+}
@@ -0,0 +1,176 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: MIT
+
+// measures the cost of the loader per call, on the null adapter, whose entry
+// points do next to nothing
+//
+// run it with UR_ADAPTERS_FORCE_LOAD pointing at the null adapter, and with
+// UR_ENABLE_LOADER_INTERCEPT set to measure the intercepts instead of the
+// direct dispatch, see README.md
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "ur_api.h"
+#include "ur_ddi.h"
+
+using clock_type = std::chrono::steady_clock;
+
+static void check(ur_result_t result, const char *call) {
+    if (result != UR_RESULT_SUCCESS) {
+        std::fprintf(stderr, "%s failed: %d\n", call, result);
+        std::exit(EXIT_FAILURE);
+    }
+}
+
+static double elapsedNs(clock_type::time_point start) {
+    return std::chrono::duration<double, std::nano>(clock_type::now() - start)
+        .count();
+}
+
+/// writes to every cache line of a buffer larger than the private caches of
+/// a core, so that the loader's objects and tables are read from further away
+/// again
+static void evictCaches(std::vector<uint64_t> &scratch) {
+    for (size_t i = 0; i < scratch.size(); i += 8) {
+        scratch[i]++;
+    }
+}
+
+static void enqueueAndRelease(ur_queue_handle_t queue, size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        ur_event_handle_t event = nullptr;
+        check(urEnqueueEventsWait(queue, 0, nullptr, &event),
+              "urEnqueueEventsWait");
+        check(urEventRelease(event), "urEventRelease");
+    }
+}
+
+int main(int argc, char *argv[]) {
+    size_t iterations = 10000000;
+    size_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--iterations") == 0) {
+            iterations = std::max<size_t>(
+                std::strtoull(argv[i + 1], nullptr, 10), 1);
+        } else if (std::strcmp(argv[i], "--threads") == 0) {
+            maxThreads = std::max<size_t>(
+                std::strtoull(argv[i + 1], nullptr, 10), 1);
+        } else {
+            std::fprintf(stderr,
+                         "usage: %s [--iterations N] [--threads N]\n",
+                         argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    check(urInit(0), "urInit");
+    ur_platform_handle_t platform = nullptr;
+    check(urPlatformGet(1, &platform, nullptr), "urPlatformGet");
+    ur_device_handle_t device = nullptr;
+    check(urDeviceGet(platform, UR_DEVICE_TYPE_ALL, 1, &device, nullptr),
+          "urDeviceGet");
+    ur_context_handle_t context = nullptr;
+    check(urContextCreate(1, &device, nullptr, &context), "urContextCreate");
+    ur_queue_handle_t queue = nullptr;
+    check(urQueueCreate(context, device, nullptr, &queue), "urQueueCreate");
+
+    // the loader intercepts the calls if the variable is set at all
+    std::printf("dispatch: %s\n", std::getenv("UR_ENABLE_LOADER_INTERCEPT")
+                                       ? "intercept"
+                                       : "direct");
+
+    // an exported function, a call without handle outputs
+    auto start = clock_type::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        check(urQueueFlush(queue), "urQueueFlush");
+    }
+    std::printf("urQueueFlush: %.2f ns/call\n",
+                elapsedNs(start) / iterations);
+
+    // the same through the table the loader hands out, which holds the
+    // adapter's own entry points with direct dispatch, so the difference to
+    // the above is what the exported function adds
+    ur_queue_dditable_t queueTable = {};
+    check(urGetQueueProcAddrTable(UR_API_VERSION_CURRENT, &queueTable),
+          "urGetQueueProcAddrTable");
+    start = clock_type::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        check(queueTable.pfnFlush(queue), "pfnFlush");
+    }
+    std::printf("urQueueFlush through the DDI table: %.2f ns/call\n",
+                elapsedNs(start) / iterations);
+
+    // a call returning a new handle and its release, which create and
+    // destroy a loader object each with intercepts
+    size_t cycles = std::max<size_t>(iterations / 10, 1);
+    enqueueAndRelease(queue, cycles / 10);
+    start = clock_type::now();
+    enqueueAndRelease(queue, cycles);
+    std::printf("urEnqueueEventsWait + urEventRelease: %.2f ns/cycle\n",
+                elapsedNs(start) / cycles);
+
+    // the same with cold caches, as in an application doing other work
+    // between its calls, only the calls are timed
+    std::vector<uint64_t> scratch(4 * 1024 * 1024 / sizeof(uint64_t));
+    size_t coldCycles = std::max<size_t>(cycles / 100, 1);
+    double coldNs = 0;
+    for (size_t i = 0; i < coldCycles; ++i) {
+        evictCaches(scratch);
+        start = clock_type::now();
+        enqueueAndRelease(queue, 1);
+        coldNs += elapsedNs(start);
+    }
+    std::printf("urEnqueueEventsWait + urEventRelease, cold caches: %.2f "
+                "ns/cycle\n",
+                coldNs / coldCycles);
+
+    // the same from more threads, each with its own queue, from one thread
+    // up to the given number, doubling it each time
+    std::vector<size_t> threadCounts;
+    for (size_t threadCount = 1; threadCount < maxThreads; threadCount *= 2) {
+        threadCounts.push_back(threadCount);
+    }
+    threadCounts.push_back(maxThreads);
+    for (size_t threadCount : threadCounts) {
+        std::vector<ur_queue_handle_t> queues(threadCount);
+        for (auto &threadQueue : queues) {
+            check(urQueueCreate(context, device, nullptr, &threadQueue),
+                  "urQueueCreate");
+        }
+
+        std::atomic<bool> go = false;
+        std::vector<std::thread> threads;
+        for (auto threadQueue : queues) {
+            threads.emplace_back([&go, threadQueue, cycles] {
+                while (!go) {
+                    std::this_thread::yield();
+                }
+                enqueueAndRelease(threadQueue, cycles);
+            });
+        }
+        start = clock_type::now();
+        go = true;
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        double seconds = elapsedNs(start) / 1e9;
+        std::printf("%zu thread(s): %.2f M cycles/s\n", threadCount,
+                    threadCount * cycles / seconds / 1e6);
+
+        for (auto threadQueue : queues) {
+            check(urQueueRelease(threadQueue), "urQueueRelease");
+        }
+    }
+
+    check(urQueueRelease(queue), "urQueueRelease");
+    check(urContextRelease(context), "urContextRelease");
+    check(urTearDown(nullptr), "urTearDown");
+    return EXIT_SUCCESS;
+}
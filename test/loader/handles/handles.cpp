@@ -0,0 +1,85 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: MIT
+
+#include <gtest/gtest.h>
+
+#include "ur_api.h"
+
+struct HandlesTest : ::testing::Test {
+    void SetUp() override {
+        ASSERT_EQ(urInit(0), UR_RESULT_SUCCESS);
+        ASSERT_EQ(urPlatformGet(1, &platform, nullptr), UR_RESULT_SUCCESS);
+        ASSERT_EQ(urDeviceGet(platform, UR_DEVICE_TYPE_ALL, 1, &device,
+                              nullptr),
+                  UR_RESULT_SUCCESS);
+    }
+
+    void TearDown() override {
+        ASSERT_EQ(urTearDown(nullptr), UR_RESULT_SUCCESS);
+    }
+
+    ur_device_handle_t getParent(ur_device_handle_t hDevice) {
+        ur_device_handle_t parent = nullptr;
+        EXPECT_EQ(urDeviceGetInfo(hDevice, UR_DEVICE_INFO_PARENT_DEVICE,
+                                  sizeof(parent), &parent, nullptr),
+                  UR_RESULT_SUCCESS);
+        return parent;
+    }
+
+    ur_platform_handle_t platform = nullptr;
+    ur_device_handle_t device = nullptr;
+};
+
+// a root device is owned by the adapter, releasing it must not destroy the
+// loader handle, whose storage a sub-device would then take over
+TEST_F(HandlesTest, RootDeviceOutlivesRelease) {
+    ASSERT_EQ(urDeviceRelease(device), UR_RESULT_SUCCESS);
+
+    ur_device_handle_t subDevices[2] = {};
+    ur_device_partition_property_t properties[] = {
+        UR_DEVICE_PARTITION_EQUALLY, 1, 0};
+    ASSERT_EQ(urDevicePartition(device, properties, 2, subDevices, nullptr),
+              UR_RESULT_SUCCESS);
+    EXPECT_NE(subDevices[0], device);
+    EXPECT_NE(subDevices[1], device);
+
+    EXPECT_EQ(getParent(device), nullptr);
+
+    ur_device_handle_t again = nullptr;
+    ASSERT_EQ(urDeviceGet(platform, UR_DEVICE_TYPE_ALL, 1, &again, nullptr),
+              UR_RESULT_SUCCESS);
+    EXPECT_EQ(again, device);
+}
+
+// looking a root device up again takes no reference either
+TEST_F(HandlesTest, RepeatedDeviceGet) {
+    for (int i = 0; i < 4; ++i) {
+        ur_device_handle_t again = nullptr;
+        ASSERT_EQ(
+            urDeviceGet(platform, UR_DEVICE_TYPE_ALL, 1, &again, nullptr),
+            UR_RESULT_SUCCESS);
+        EXPECT_EQ(again, device);
+    }
+    ASSERT_EQ(urDeviceRelease(device), UR_RESULT_SUCCESS);
+    EXPECT_EQ(getParent(device), nullptr);
+}
+
+// sub-devices are created by the adapter, the loader handle goes away with
+// the last release
+TEST_F(HandlesTest, SubDeviceRetainRelease) {
+    ur_device_handle_t subDevices[2] = {};
+    ur_device_partition_property_t properties[] = {
+        UR_DEVICE_PARTITION_EQUALLY, 1, 0};
+    ASSERT_EQ(urDevicePartition(device, properties, 2, subDevices, nullptr),
+              UR_RESULT_SUCCESS);
+    EXPECT_NE(subDevices[0], subDevices[1]);
+
+    ASSERT_EQ(urDeviceRetain(subDevices[0]), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urDeviceRelease(subDevices[0]), UR_RESULT_SUCCESS);
+    // the adapter reports its own handle of the parent
+    EXPECT_NE(getParent(subDevices[0]), nullptr);
+
+    ASSERT_EQ(urDeviceRelease(subDevices[0]), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urDeviceRelease(subDevices[1]), UR_RESULT_SUCCESS);
+    EXPECT_EQ(getParent(device), nullptr);
+}
@@ -0,0 +1,125 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: MIT
+
+// a minimal adapter with a root device partitioned into two sub-devices,
+// all with distinct handles, which reports the parent of the device it is
+// asked about, so that the handle lifetime test can tell which adapter
+// device a loader handle is bound to
+
+#include "ur_ddi.h"
+
+static int platform;
+static int rootDevice;
+static int subDevices[2];
+
+UR_DLLEXPORT ur_result_t UR_APICALL
+urGetGlobalProcAddrTable(ur_api_version_t, ur_global_dditable_t *pDdiTable) {
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    pDdiTable->pfnInit = [](ur_device_init_flags_t) {
+        return UR_RESULT_SUCCESS;
+    };
+    pDdiTable->pfnTearDown = [](void *) { return UR_RESULT_SUCCESS; };
+    return UR_RESULT_SUCCESS;
+}
+
+UR_DLLEXPORT ur_result_t UR_APICALL urGetPlatformProcAddrTable(
+    ur_api_version_t, ur_platform_dditable_t *pDdiTable) {
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    pDdiTable->pfnGet = [](uint32_t NumEntries,
+                           ur_platform_handle_t *phPlatforms,
+                           uint32_t *pNumPlatforms) {
+        if (pNumPlatforms != nullptr) {
+            *pNumPlatforms = 1;
+        }
+        if (nullptr != phPlatforms && NumEntries > 0) {
+            *phPlatforms = reinterpret_cast<ur_platform_handle_t>(&platform);
+        }
+        return UR_RESULT_SUCCESS;
+    };
+    return UR_RESULT_SUCCESS;
+}
+
+UR_DLLEXPORT ur_result_t UR_APICALL
+urGetDeviceProcAddrTable(ur_api_version_t, ur_device_dditable_t *pDdiTable) {
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    pDdiTable->pfnGet = [](ur_platform_handle_t, ur_device_type_t,
+                           uint32_t NumEntries, ur_device_handle_t *phDevices,
+                           uint32_t *pNumDevices) {
+        if (pNumDevices != nullptr) {
+            *pNumDevices = 1;
+        }
+        if (nullptr != phDevices && NumEntries > 0) {
+            *phDevices = reinterpret_cast<ur_device_handle_t>(&rootDevice);
+        }
+        return UR_RESULT_SUCCESS;
+    };
+    pDdiTable->pfnPartition =
+        [](ur_device_handle_t, const ur_device_partition_property_t *,
+           uint32_t NumDevices, ur_device_handle_t *phSubDevices,
+           uint32_t *pNumDevicesRet) {
+            if (pNumDevicesRet != nullptr) {
+                *pNumDevicesRet = 2;
+            }
+            for (uint32_t i = 0; nullptr != phSubDevices && i < NumDevices &&
+                                 i < 2;
+                 ++i) {
+                phSubDevices[i] =
+                    reinterpret_cast<ur_device_handle_t>(&subDevices[i]);
+            }
+            return UR_RESULT_SUCCESS;
+        };
+    pDdiTable->pfnGetInfo = [](ur_device_handle_t hDevice,
+                               ur_device_info_t propName, size_t propSize,
+                               void *pPropValue, size_t *pPropSizeRet) {
+        if (propName != UR_DEVICE_INFO_PARENT_DEVICE) {
+            return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+        }
+        if (pPropSizeRet != nullptr) {
+            *pPropSizeRet = sizeof(ur_device_handle_t);
+        }
+        if (pPropValue != nullptr) {
+            if (propSize < sizeof(ur_device_handle_t)) {
+                return UR_RESULT_ERROR_INVALID_VALUE;
+            }
+            bool isRoot = hDevice ==
+                          reinterpret_cast<ur_device_handle_t>(&rootDevice);
+            *static_cast<ur_device_handle_t *>(pPropValue) =
+                isRoot ? nullptr
+                       : reinterpret_cast<ur_device_handle_t>(&rootDevice);
+        }
+        return UR_RESULT_SUCCESS;
+    };
+    pDdiTable->pfnRetain = [](ur_device_handle_t) {
+        return UR_RESULT_SUCCESS;
+    };
+    pDdiTable->pfnRelease = [](ur_device_handle_t) {
+        return UR_RESULT_SUCCESS;
+    };
+    return UR_RESULT_SUCCESS;
+}
+
+// the loader fails to initialize unless every table is provided, the ones
+// above are the only ones the test uses
+
+#define STUB_EMPTY_TABLE(name, table_t)                                        \
+    UR_DLLEXPORT ur_result_t UR_APICALL name(ur_api_version_t,                \
+                                             table_t *pDdiTable) {             \
+        return nullptr == pDdiTable ? UR_RESULT_ERROR_INVALID_NULL_POINTER     \
+                                    : UR_RESULT_SUCCESS;                       \
+    }
+
+STUB_EMPTY_TABLE(urGetContextProcAddrTable, ur_context_dditable_t)
+STUB_EMPTY_TABLE(urGetEventProcAddrTable, ur_event_dditable_t)
+STUB_EMPTY_TABLE(urGetProgramProcAddrTable, ur_program_dditable_t)
+STUB_EMPTY_TABLE(urGetKernelProcAddrTable, ur_kernel_dditable_t)
+STUB_EMPTY_TABLE(urGetSamplerProcAddrTable, ur_sampler_dditable_t)
+STUB_EMPTY_TABLE(urGetMemProcAddrTable, ur_mem_dditable_t)
+STUB_EMPTY_TABLE(urGetEnqueueProcAddrTable, ur_enqueue_dditable_t)
+STUB_EMPTY_TABLE(urGetQueueProcAddrTable, ur_queue_dditable_t)
+STUB_EMPTY_TABLE(urGetUSMProcAddrTable, ur_usm_dditable_t)
@@ -0,0 +1,68 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: MIT
+
+#include <dlfcn.h>
+
+#include <gtest/gtest.h>
+
+#include "ur_api.h"
+
+/// whether the stub adapter library is loaded in the process
+static bool isStubLoaded() {
+    void *handle = dlopen(STUB_ADAPTER_PATH, RTLD_LAZY | RTLD_NOLOAD);
+    if (handle == nullptr) {
+        return false;
+    }
+    dlclose(handle);
+    return true;
+}
+
+/// the number of times the stub adapter was initialized
+static int getStubInitCount() {
+    void *handle = dlopen(STUB_ADAPTER_PATH, RTLD_LAZY | RTLD_NOLOAD);
+    if (handle == nullptr) {
+        return 0;
+    }
+    auto getInitCount = reinterpret_cast<int (*)()>(
+        dlsym(handle, "urStubAdapterGetInitCount"));
+    int count = getInitCount ? getInitCount() : -1;
+    dlclose(handle);
+    return count;
+}
+
+// the null adapter comes first, the stub adapter second
+TEST(LazyInitTest, LoadsAdaptersOnlyWhenTheirPlatformsAreNeeded) {
+    ASSERT_EQ(urInit(0), UR_RESULT_SUCCESS);
+    EXPECT_FALSE(isStubLoaded());
+
+    // the null adapter provides the single platform asked for
+    ur_platform_handle_t platforms[2] = {};
+    ASSERT_EQ(urPlatformGet(1, platforms, nullptr), UR_RESULT_SUCCESS);
+    EXPECT_NE(platforms[0], nullptr);
+    EXPECT_FALSE(isStubLoaded());
+
+    // counting the platforms needs every adapter
+    uint32_t count = 0;
+    ASSERT_EQ(urPlatformGet(0, nullptr, &count), UR_RESULT_SUCCESS);
+    EXPECT_EQ(count, 2);
+    EXPECT_TRUE(isStubLoaded());
+    EXPECT_EQ(getStubInitCount(), 1);
+
+    ASSERT_EQ(urPlatformGet(2, platforms, nullptr), UR_RESULT_SUCCESS);
+    EXPECT_NE(platforms[1], nullptr);
+    EXPECT_EQ(getStubInitCount(), 1);
+
+    ASSERT_EQ(urTearDown(nullptr), UR_RESULT_SUCCESS);
+}
+
+// run with UR_PLATFORM_FILTER selecting the null backend only
+TEST(LazyInitTest, FilteredAdapterIsNeverLoaded) {
+    ASSERT_EQ(urInit(0), UR_RESULT_SUCCESS);
+
+    uint32_t count = 0;
+    ASSERT_EQ(urPlatformGet(0, nullptr, &count), UR_RESULT_SUCCESS);
+    EXPECT_EQ(count, 1);
+    EXPECT_FALSE(isStubLoaded());
+
+    ASSERT_EQ(urTearDown(nullptr), UR_RESULT_SUCCESS);
+}
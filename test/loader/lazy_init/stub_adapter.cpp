@@ -0,0 +1,46 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: MIT
+
+// a minimal adapter, which counts its initializations and provides a single
+// platform, the lazy initialization test checks when the loader touches it
+
+#include <atomic>
+
+#include "ur_ddi.h"
+
+static std::atomic<int> initCount = 0;
+static int platform;
+
+extern "C" UR_DLLEXPORT int urStubAdapterGetInitCount() { return initCount; }
+
+UR_DLLEXPORT ur_result_t UR_APICALL
+urGetGlobalProcAddrTable(ur_api_version_t, ur_global_dditable_t *pDdiTable) {
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    pDdiTable->pfnInit = [](ur_device_init_flags_t) {
+        ++initCount;
+        return UR_RESULT_SUCCESS;
+    };
+    pDdiTable->pfnTearDown = [](void *) { return UR_RESULT_SUCCESS; };
+    return UR_RESULT_SUCCESS;
+}
+
+UR_DLLEXPORT ur_result_t UR_APICALL urGetPlatformProcAddrTable(
+    ur_api_version_t, ur_platform_dditable_t *pDdiTable) {
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    pDdiTable->pfnGet = [](uint32_t NumEntries,
+                           ur_platform_handle_t *phPlatforms,
+                           uint32_t *pNumPlatforms) {
+        if (pNumPlatforms != nullptr) {
+            *pNumPlatforms = 1;
+        }
+        if (nullptr != phPlatforms && NumEntries > 0) {
+            *phPlatforms = reinterpret_cast<ur_platform_handle_t>(&platform);
+        }
+        return UR_RESULT_SUCCESS;
+    };
+    return UR_RESULT_SUCCESS;
+}
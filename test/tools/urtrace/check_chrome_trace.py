@@ -0,0 +1,78 @@
+#!/usr/bin/env python
+
+# Copyright (C) 2023 Intel Corporation
+# SPDX-License-Identifier: MIT
+
+# runs a command writing a chrome trace, then checks that the trace is a well
+# formed Trace Event Format file, whose begin and end events pair up on every
+# thread and hold the expected functions
+
+import json
+import os
+import subprocess
+import sys
+
+if len(sys.argv) < 4 or "--" not in sys.argv:
+    print("Usage: python check_chrome_trace.py <trace_file> <function>... -- <command>...")
+    sys.exit(1)
+
+separator = sys.argv.index("--")
+trace_file = sys.argv[1]
+expected = sys.argv[2:separator]
+command = sys.argv[separator + 1:]
+
+if os.path.exists(trace_file):
+    os.remove(trace_file)
+
+result = subprocess.run(command)
+if result.returncode != 0:
+    sys.exit(f"{' '.join(command)} returned {result.returncode}")
+
+with open(trace_file, 'r') as trace:
+    try:
+        document = json.load(trace)
+    except json.JSONDecodeError as e:
+        sys.exit(f"{trace_file} is not valid JSON: {e}")
+os.remove(trace_file)
+
+events = document.get("traceEvents") if isinstance(document, dict) else None
+if not isinstance(events, list):
+    sys.exit("the trace has no traceEvents array")
+
+stacks = {}
+functions = set()
+for i, event in enumerate(events):
+    phase = event.get("ph")
+    if phase not in ("B", "E"):
+        continue
+    for field in ("name", "pid", "tid", "ts"):
+        if field not in event:
+            sys.exit(f"event {i} has no {field}: {event}")
+    if not isinstance(event["tid"], int) or not isinstance(event["ts"], (int, float)):
+        sys.exit(f"event {i} has a malformed tid or ts: {event}")
+
+    stack = stacks.setdefault((event["pid"], event["tid"]), [])
+    if phase == "B":
+        stack.append(event)
+        continue
+    if not stack:
+        sys.exit(f"event {i} ends {event['name']}, which did not begin")
+    begin = stack.pop()
+    if begin["name"] != event["name"]:
+        sys.exit(f"event {i} ends {event['name']}, but {begin['name']} began last")
+    if event["ts"] < begin["ts"]:
+        sys.exit(f"event {i} ends {event['name']} before it began")
+    if "result" not in event.get("args", {}):
+        sys.exit(f"event {i} ending {event['name']} has no result")
+    functions.add(event["name"])
+
+for (pid, tid), stack in stacks.items():
+    if stack:
+        sys.exit(f"thread {tid} left {[e['name'] for e in stack]} unfinished")
+    # the id of the main thread is the id of the process on Linux
+    if sys.platform.startswith("linux") and len(stacks) == 1 and tid != pid:
+        sys.exit(f"thread id {tid} is not the operating system id")
+
+missing = [f for f in expected if f not in functions]
+if missing:
+    sys.exit(f"the trace does not hold {missing}")
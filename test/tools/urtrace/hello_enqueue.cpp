@@ -0,0 +1,92 @@
+/*
+ *
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#include <iostream>
+#include <vector>
+
+#include "ur_api.h"
+
+// enqueues a single command on a profiling queue of the first device
+//////////////////////////////////////////////////////////////////////////
+int main(int argc, char *argv[]) {
+    ur_platform_handle_t platform = nullptr;
+    ur_device_handle_t device = nullptr;
+    ur_context_handle_t context = nullptr;
+    ur_queue_handle_t queue = nullptr;
+    ur_event_handle_t event = nullptr;
+    uint32_t count = 0;
+    ur_queue_properties_t props = {UR_STRUCTURE_TYPE_QUEUE_PROPERTIES, nullptr,
+                                   UR_QUEUE_FLAG_PROFILING_ENABLE};
+
+    ur_result_t status = urInit(0);
+    if (status != UR_RESULT_SUCCESS) {
+        std::cout << "urInit failed with return code: " << status << std::endl;
+        return 1;
+    }
+
+    status = urPlatformGet(1, nullptr, &count);
+    if (status != UR_RESULT_SUCCESS || count == 0) {
+        std::cout << "urPlatformGet failed with return code: " << status
+                  << std::endl;
+        goto out;
+    }
+    status = urPlatformGet(1, &platform, nullptr);
+    if (status != UR_RESULT_SUCCESS) {
+        std::cout << "urPlatformGet failed with return code: " << status
+                  << std::endl;
+        goto out;
+    }
+
+    status = urDeviceGet(platform, UR_DEVICE_TYPE_GPU, 1, &device, nullptr);
+    if (status != UR_RESULT_SUCCESS) {
+        std::cout << "urDeviceGet failed with return code: " << status
+                  << std::endl;
+        goto out;
+    }
+
+    status = urContextCreate(1, &device, nullptr, &context);
+    if (status != UR_RESULT_SUCCESS) {
+        std::cout << "urContextCreate failed with return code: " << status
+                  << std::endl;
+        goto out;
+    }
+
+    status = urQueueCreate(context, device, &props, &queue);
+    if (status != UR_RESULT_SUCCESS) {
+        std::cout << "urQueueCreate failed with return code: " << status
+                  << std::endl;
+        goto out;
+    }
+
+    status = urEnqueueEventsWait(queue, 0, nullptr, &event);
+    if (status != UR_RESULT_SUCCESS) {
+        std::cout << "urEnqueueEventsWait failed with return code: " << status
+                  << std::endl;
+        goto out;
+    }
+
+    status = urEventWait(1, &event);
+    if (status != UR_RESULT_SUCCESS) {
+        std::cout << "urEventWait failed with return code: " << status
+                  << std::endl;
+        goto out;
+    }
+    std::cout << "Command completed.\n";
+
+out:
+    if (event) {
+        urEventRelease(event);
+    }
+    if (queue) {
+        urQueueRelease(queue);
+    }
+    if (context) {
+        urContextRelease(context);
+    }
+    urTearDown(nullptr);
+    return status == UR_RESULT_SUCCESS ? 0 : 1;
+}
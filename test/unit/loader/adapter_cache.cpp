@@ -0,0 +1,99 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: MIT
+
+#include <cstdio>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "ur_adapter_cache.hpp"
+
+class AdapterCacheTest : public ::testing::Test {
+  protected:
+    const std::string cacheFile = "adapter_cache_test.cache";
+    const std::string libFile = "adapter_cache_test.lib";
+
+    void SetUp() override {
+        std::remove(cacheFile.c_str());
+        writeLib("library");
+    }
+
+    void TearDown() override {
+        std::remove(cacheFile.c_str());
+        std::remove(libFile.c_str());
+    }
+
+    void writeLib(const char *content) {
+        std::ofstream out(libFile, std::ios::trunc);
+        out << content;
+    }
+};
+
+TEST_F(AdapterCacheTest, DisabledWithoutFile) {
+    ur_loader::AdapterCache cache;
+    ASSERT_FALSE(cache.enabled());
+    cache.update("adapter", libFile, 1);
+    ASSERT_TRUE(cache.save());
+
+    std::ifstream in(cacheFile);
+    ASSERT_FALSE(in.good());
+}
+
+TEST_F(AdapterCacheTest, SaveAndLoad) {
+    {
+        ur_loader::AdapterCache cache(cacheFile);
+        cache.load();
+        ASSERT_EQ(cache.find("adapter"), nullptr);
+        cache.update("adapter", libFile, 0x5);
+        cache.update("not_an_adapter", libFile, 0x4);
+        ASSERT_TRUE(cache.save());
+    }
+
+    ur_loader::AdapterCache cache(cacheFile);
+    cache.load();
+
+    auto entry = cache.find("adapter");
+    ASSERT_NE(entry, nullptr);
+    ASSERT_EQ(entry->path, libFile);
+    ASSERT_EQ(entry->tables, 0x5u);
+    ASSERT_FALSE(entry->unusable());
+
+    entry = cache.find("not_an_adapter");
+    ASSERT_NE(entry, nullptr);
+    ASSERT_EQ(entry->tables, 0x4u);
+    ASSERT_TRUE(entry->unusable());
+
+    ASSERT_EQ(cache.find("unknown"), nullptr);
+}
+
+TEST_F(AdapterCacheTest, MissingGlobalTableUnusable) {
+    ur_loader::AdapterCache cache(cacheFile);
+    cache.update("adapter", libFile, 0x6);
+
+    auto entry = cache.find("adapter");
+    ASSERT_NE(entry, nullptr);
+    ASSERT_TRUE(entry->unusable());
+}
+
+TEST_F(AdapterCacheTest, InvalidatedByLibraryChange) {
+    ur_loader::AdapterCache cache(cacheFile);
+    cache.update("adapter", libFile, 1);
+    ASSERT_NE(cache.find("adapter"), nullptr);
+
+    writeLib("a different library");
+    ASSERT_EQ(cache.find("adapter"), nullptr);
+
+    std::remove(libFile.c_str());
+    ASSERT_EQ(cache.find("adapter"), nullptr);
+}
+
+TEST_F(AdapterCacheTest, MalformedFileIgnored) {
+    {
+        std::ofstream out(cacheFile, std::ios::trunc);
+        out << "ur-adapter-cache 2\nadapter\tgarbage\n";
+    }
+
+    ur_loader::AdapterCache cache(cacheFile);
+    cache.load();
+    ASSERT_EQ(cache.find("adapter"), nullptr);
+}
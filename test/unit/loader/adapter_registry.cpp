@@ -0,0 +1,70 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: MIT
+
+#include <gtest/gtest.h>
+
+#include "ur_adapter_registry.hpp"
+
+class AdapterRegistryFilterTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        ASSERT_EQ(setenv("UR_ADAPTERS_FORCE_LOAD",
+                         "libur_adapter_level_zero.so.0,"
+                         "/opt/ur/lib/libur_adapter_null.so,"
+                         "libur_adapter_level.so",
+                         1),
+                  0);
+    }
+
+    void TearDown() override {
+        unsetenv("UR_ADAPTERS_FORCE_LOAD");
+        unsetenv("UR_PLATFORM_FILTER");
+    }
+
+    std::vector<std::string> getAdapters() {
+        ur_loader::AdapterRegistry registry;
+        std::vector<std::string> adapters;
+        for (const auto &adapter : registry) {
+            adapters.emplace_back(adapter);
+        }
+        return adapters;
+    }
+};
+
+TEST_F(AdapterRegistryFilterTest, NoFilter) {
+    ASSERT_EQ(getAdapters().size(), 3);
+}
+
+TEST_F(AdapterRegistryFilterTest, SingleBackend) {
+    ASSERT_EQ(setenv("UR_PLATFORM_FILTER", "backend:null", 1), 0);
+    ASSERT_EQ(getAdapters(), std::vector<std::string>{
+                                 "/opt/ur/lib/libur_adapter_null.so"});
+}
+
+TEST_F(AdapterRegistryFilterTest, BackendNameMustMatchWhole) {
+    ASSERT_EQ(setenv("UR_PLATFORM_FILTER", "backend:level", 1), 0);
+    ASSERT_EQ(getAdapters(),
+              std::vector<std::string>{"libur_adapter_level.so"});
+}
+
+TEST_F(AdapterRegistryFilterTest, MultipleBackends) {
+    ASSERT_EQ(setenv("UR_PLATFORM_FILTER", "backend:null,level_zero", 1), 0);
+    ASSERT_EQ(getAdapters(), (std::vector<std::string>{
+                                 "libur_adapter_level_zero.so.0",
+                                 "/opt/ur/lib/libur_adapter_null.so"}));
+}
+
+TEST_F(AdapterRegistryFilterTest, NoMatch) {
+    ASSERT_EQ(setenv("UR_PLATFORM_FILTER", "backend:cuda", 1), 0);
+    ASSERT_TRUE(getAdapters().empty());
+}
+
+TEST_F(AdapterRegistryFilterTest, UnknownParameterIgnored) {
+    ASSERT_EQ(setenv("UR_PLATFORM_FILTER", "backend:null;device:gpu", 1), 0);
+    ASSERT_EQ(getAdapters().size(), 3);
+}
+
+TEST_F(AdapterRegistryFilterTest, WrongFormatIgnored) {
+    ASSERT_EQ(setenv("UR_PLATFORM_FILTER", "null", 1), 0);
+    ASSERT_EQ(getAdapters().size(), 3);
+}
@@ -0,0 +1,176 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: MIT
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ur_binary_trace.hpp"
+
+using namespace ur_tracing_layer;
+
+struct trace_file_t {
+    binary_file_header_t header = {};
+    binary_file_trailer_t trailer = {};
+    std::map<uint32_t, std::vector<binary_record_t>> threads;
+    bool complete = false;
+};
+
+static trace_file_t readTrace(const std::string &path) {
+    trace_file_t trace;
+    std::ifstream in(path, std::ios::binary);
+    if (!in.read(reinterpret_cast<char *>(&trace.header),
+                 sizeof(trace.header))) {
+        return trace;
+    }
+
+    binary_block_header_t block;
+    while (in.read(reinterpret_cast<char *>(&block), sizeof(block))) {
+        if (block.thread == BINARY_BLOCK_TRAILER) {
+            trace.complete = !!in.read(
+                reinterpret_cast<char *>(&trace.trailer), sizeof(trace.trailer));
+            break;
+        }
+        auto &records = trace.threads[block.thread];
+        auto offset = records.size();
+        records.resize(offset + block.count);
+        in.read(reinterpret_cast<char *>(&records[offset]),
+                block.count * sizeof(binary_record_t));
+    }
+    return trace;
+}
+
+class BinaryTraceTest : public ::testing::Test {
+  protected:
+    const std::string traceFile = "binary_trace_test.bin";
+
+    void SetUp() override { std::remove(traceFile.c_str()); }
+    void TearDown() override { std::remove(traceFile.c_str()); }
+};
+
+TEST_F(BinaryTraceTest, NotStarted) {
+    binary_trace_t trace;
+    ASSERT_FALSE(trace.is_active());
+    trace.record(BINARY_RECORD_BEGIN, 1, 1, 0, 0);
+    trace.stop();
+    ASSERT_FALSE(std::ifstream(traceFile).good());
+}
+
+TEST_F(BinaryTraceTest, SingleThread) {
+    binary_trace_t trace;
+    ASSERT_TRUE(trace.start(traceFile));
+    ASSERT_TRUE(trace.is_active());
+    for (uint64_t i = 0; i < 1000; ++i) {
+        trace.record(BINARY_RECORD_BEGIN, 7, i, 0x1000 + i, 0);
+        trace.record(BINARY_RECORD_END, 7, i, 0, -1);
+    }
+    trace.stop();
+    ASSERT_FALSE(trace.is_active());
+
+    auto file = readTrace(traceFile);
+    ASSERT_EQ(std::memcmp(file.header.magic, "URBTRACE", 8), 0);
+    ASSERT_EQ(file.header.record_size, sizeof(binary_record_t));
+    ASSERT_TRUE(file.complete);
+    ASSERT_EQ(file.trailer.dropped, 0);
+    ASSERT_GE(file.trailer.timestamp, file.header.timestamp);
+    ASSERT_EQ(file.threads.size(), 1);
+
+    auto &records = file.threads.begin()->second;
+    ASSERT_EQ(records.size(), 2000);
+    for (uint64_t i = 0; i < 1000; ++i) {
+        auto &begin = records[2 * i];
+        auto &end = records[2 * i + 1];
+        ASSERT_EQ(begin.type, BINARY_RECORD_BEGIN);
+        ASSERT_EQ(begin.function_id, 7);
+        ASSERT_EQ(begin.instance, i);
+        ASSERT_EQ(begin.handle, 0x1000 + i);
+        ASSERT_EQ(end.type, BINARY_RECORD_END);
+        ASSERT_EQ(end.instance, i);
+        ASSERT_EQ(end.result, -1);
+        ASSERT_LE(begin.timestamp, end.timestamp);
+    }
+}
+
+TEST_F(BinaryTraceTest, MultipleThreads) {
+    constexpr uint64_t numThreads = 4;
+    constexpr uint64_t numCalls = 1000;
+
+    binary_trace_t trace;
+    ASSERT_TRUE(trace.start(traceFile));
+    std::vector<std::thread> threads;
+    for (uint64_t t = 0; t < numThreads; ++t) {
+        threads.emplace_back([&trace, t] {
+            for (uint64_t i = 0; i < numCalls; ++i) {
+                trace.record(BINARY_RECORD_BEGIN, 1, t * numCalls + i, t, 0);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    trace.stop();
+
+    auto file = readTrace(traceFile);
+    ASSERT_TRUE(file.complete);
+    ASSERT_EQ(file.trailer.dropped, 0);
+    ASSERT_EQ(file.threads.size(), numThreads);
+    for (auto &[thread, records] : file.threads) {
+        ASSERT_EQ(records.size(), numCalls);
+        auto t = records[0].handle;
+        for (uint64_t i = 0; i < numCalls; ++i) {
+            ASSERT_EQ(records[i].handle, t);
+            ASSERT_EQ(records[i].instance, t * numCalls + i);
+        }
+    }
+}
+
+TEST_F(BinaryTraceTest, FullRingDropsRecords) {
+    constexpr uint64_t numRecords = 100000;
+
+    binary_trace_t trace;
+    ASSERT_TRUE(trace.start(traceFile));
+    for (uint64_t i = 0; i < numRecords; ++i) {
+        trace.record(BINARY_RECORD_BEGIN, 1, i, 0, 0);
+    }
+    trace.stop();
+
+    auto file = readTrace(traceFile);
+    ASSERT_TRUE(file.complete);
+    size_t written = 0;
+    for (auto &[thread, records] : file.threads) {
+        for (size_t i = 1; i < records.size(); ++i) {
+            ASSERT_LT(records[i - 1].instance, records[i].instance);
+        }
+        written += records.size();
+    }
+    ASSERT_EQ(written + file.trailer.dropped, numRecords);
+}
+
+TEST_F(BinaryTraceTest, Restart) {
+    binary_trace_t trace;
+    ASSERT_TRUE(trace.start(traceFile));
+    trace.record(BINARY_RECORD_BEGIN, 1, 1, 0, 0);
+    trace.stop();
+
+    ASSERT_TRUE(trace.start(traceFile));
+    trace.record(BINARY_RECORD_BEGIN, 2, 2, 0, 0);
+    trace.stop();
+
+    auto file = readTrace(traceFile);
+    ASSERT_TRUE(file.complete);
+    ASSERT_EQ(file.threads.size(), 1);
+    auto &records = file.threads.begin()->second;
+    ASSERT_EQ(records.size(), 1);
+    ASSERT_EQ(records[0].function_id, 2);
+}
+
+TEST_F(BinaryTraceTest, InvalidPath) {
+    binary_trace_t trace;
+    ASSERT_FALSE(trace.start("/nonexistent/binary_trace_test.bin"));
+    ASSERT_FALSE(trace.is_active());
+}
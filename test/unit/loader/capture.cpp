@@ -0,0 +1,249 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: MIT
+
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "replayer.hpp"
+#include "ur_api.h"
+#include "ur_capture.hpp"
+
+using namespace ur_tracing_layer;
+
+/// calls a function and records the call, as the tracing layer would
+template <typename... Params, typename... Args>
+ur_result_t capturedCall(capture_t &capture, ur_function_t function,
+                         ur_result_t (*fn)(Params...), Args &&...args) {
+    std::tuple<Params...> values(std::forward<Args>(args)...);
+    ur_result_t result = std::apply(fn, values);
+    auto params = std::apply(
+        [](auto &...value) {
+            return std::array<void *, sizeof...(Params)>{
+                const_cast<void *>(static_cast<const void *>(&value))...};
+        },
+        values);
+    capture.record(function, params.data(), result);
+    return result;
+}
+
+class CaptureTest : public ::testing::Test {
+  protected:
+    const std::string captureFile = "capture_test.bin";
+    capture_t capture;
+    ur_platform_handle_t platform = nullptr;
+    ur_device_handle_t device = nullptr;
+    ur_context_handle_t context = nullptr;
+
+    void SetUp() override {
+        std::remove(captureFile.c_str());
+        ASSERT_TRUE(capture.start(captureFile));
+
+        ASSERT_EQ(capturedCall(capture, UR_FUNCTION_INIT, urInit, 0),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(capturedCall(capture, UR_FUNCTION_PLATFORM_GET,
+                               urPlatformGet, 1, &platform, nullptr),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(capturedCall(capture, UR_FUNCTION_DEVICE_GET, urDeviceGet,
+                               platform, UR_DEVICE_TYPE_ALL, 1, &device,
+                               nullptr),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(capturedCall(capture, UR_FUNCTION_CONTEXT_CREATE,
+                               urContextCreate, 1, &device, nullptr,
+                               &context),
+                  UR_RESULT_SUCCESS);
+    }
+
+    void TearDown() override {
+        urTearDown(nullptr);
+        std::remove(captureFile.c_str());
+    }
+
+    urreplay::replay_stats_t replay(std::string &log) {
+        std::ostringstream out;
+        urreplay::replayer_t replayer(out);
+        EXPECT_TRUE(replayer.replay(captureFile));
+        log = out.str();
+
+        // the handles of the capture are replayed as new ones
+        auto replayedContext = replayer.get_handle(
+            reinterpret_cast<uintptr_t>(context));
+        EXPECT_NE(replayedContext, nullptr);
+        EXPECT_NE(replayedContext, context);
+        return replayer.stats();
+    }
+};
+
+TEST_F(CaptureTest, ReplaysEnqueuedCommands) {
+    ur_queue_handle_t queue = nullptr;
+    ur_mem_handle_t buffer = nullptr;
+    ur_program_handle_t program = nullptr;
+    ur_kernel_handle_t kernel = nullptr;
+    ur_event_handle_t event = nullptr;
+    void *usm = nullptr;
+    uint32_t data[4] = {1, 2, 3, 4};
+    uint8_t il[] = {0x03, 0x02, 0x23, 0x07};
+    size_t globalSize[] = {16, 4};
+    size_t localSize[] = {4, 4};
+
+    ASSERT_EQ(capturedCall(capture, UR_FUNCTION_QUEUE_CREATE, urQueueCreate,
+                           context, device, nullptr, &queue),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(capturedCall(capture, UR_FUNCTION_USM_DEVICE_ALLOC,
+                           urUSMDeviceAlloc, context, device, nullptr,
+                           nullptr, sizeof(data), &usm),
+              UR_RESULT_SUCCESS);
+    ASSERT_NE(usm, nullptr);
+    ASSERT_EQ(capturedCall(capture, UR_FUNCTION_ENQUEUE_USM_MEMCPY,
+                           urEnqueueUSMMemcpy, queue, false,
+                           static_cast<uint8_t *>(usm) + 4, data,
+                           sizeof(data) - 4, 0, nullptr, nullptr),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(capturedCall(capture, UR_FUNCTION_MEM_BUFFER_CREATE,
+                           urMemBufferCreate, context, UR_MEM_FLAG_READ_WRITE,
+                           sizeof(data), nullptr, &buffer),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(capturedCall(capture, UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE,
+                           urEnqueueMemBufferWrite, queue, buffer, true, 0,
+                           sizeof(data), data, 0, nullptr, nullptr),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(capturedCall(capture, UR_FUNCTION_PROGRAM_CREATE_WITH_IL,
+                           urProgramCreateWithIL, context, il, sizeof(il),
+                           nullptr, &program),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(capturedCall(capture, UR_FUNCTION_KERNEL_CREATE, urKernelCreate,
+                           program, "kernel", &kernel),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(capturedCall(capture, UR_FUNCTION_KERNEL_SET_ARG_VALUE,
+                           urKernelSetArgValue, kernel, 0, sizeof(data[0]),
+                           &data[0]),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(capturedCall(capture, UR_FUNCTION_KERNEL_SET_ARG_POINTER,
+                           urKernelSetArgPointer, kernel, 1, usm),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(capturedCall(capture, UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ,
+                           urKernelSetArgMemObj, kernel, 2, buffer),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(capturedCall(capture, UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH,
+                           urEnqueueKernelLaunch, queue, kernel, 2, nullptr,
+                           globalSize, localSize, 0, nullptr, &event),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(capturedCall(capture, UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ,
+                           urEnqueueMemBufferRead, queue, buffer, true, 0,
+                           sizeof(data), data, 1, &event, nullptr),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(capturedCall(capture, UR_FUNCTION_EVENT_WAIT, urEventWait, 1,
+                           &event),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(capturedCall(capture, UR_FUNCTION_USM_FREE, urUSMFree, context,
+                           usm),
+              UR_RESULT_SUCCESS);
+    capture.stop();
+
+    std::string log;
+    auto stats = replay(log);
+    EXPECT_EQ(stats.records, 18);
+    EXPECT_EQ(stats.replayed, 18);
+    EXPECT_EQ(stats.skipped, 0);
+    EXPECT_EQ(stats.mismatched, 0);
+    EXPECT_EQ(log, "");
+}
+
+TEST_F(CaptureTest, SkipsIncompleteCalls) {
+    uint32_t data[4] = {};
+    ur_buffer_properties_t props = {UR_STRUCTURE_TYPE_BUFFER_PROPERTIES,
+                                    nullptr, data};
+    ur_mem_handle_t buffer = nullptr;
+
+    // the host memory of the buffer is not captured
+    ASSERT_EQ(capturedCall(capture, UR_FUNCTION_MEM_BUFFER_CREATE,
+                           urMemBufferCreate, context,
+                           UR_MEM_FLAG_USE_HOST_POINTER, sizeof(data), &props,
+                           &buffer),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(capturedCall(capture, UR_FUNCTION_MEM_RELEASE, urMemRelease,
+                           buffer),
+              UR_RESULT_SUCCESS);
+    capture.stop();
+
+    std::string log;
+    auto stats = replay(log);
+    EXPECT_EQ(stats.records, 6);
+    EXPECT_EQ(stats.replayed, 4);
+    EXPECT_EQ(stats.skipped, 2);
+    EXPECT_EQ(stats.mismatched, 0);
+    EXPECT_NE(log.find("skipped urMemRelease: unknown handle"),
+              std::string::npos);
+}
+
+TEST_F(CaptureTest, TruncatedFile) {
+    capture.stop();
+
+    std::ifstream in(captureFile, std::ios::binary);
+    std::vector<char> bytes((std::istreambuf_iterator<char>(in)),
+                            std::istreambuf_iterator<char>());
+    in.close();
+    std::ofstream(captureFile, std::ios::binary)
+        .write(bytes.data(), bytes.size() - 1);
+
+    std::ostringstream out;
+    urreplay::replayer_t replayer(out);
+    EXPECT_FALSE(replayer.replay(captureFile));
+    EXPECT_EQ(replayer.stats().records, 3);
+    EXPECT_NE(out.str().find("is truncated"), std::string::npos);
+}
+
+// run with the deferred adapter, whose queues run the non-blocking commands
+// only once they are finished
+using DeferredCaptureTest = CaptureTest;
+
+TEST_F(DeferredCaptureTest, KeepsHostMemoryOfNonBlockingCommands) {
+    ur_queue_handle_t queue = nullptr;
+    ur_mem_handle_t buffer = nullptr;
+    uint32_t data[4] = {1, 2, 3, 4};
+    uint32_t readBack[4] = {};
+
+    ASSERT_EQ(capturedCall(capture, UR_FUNCTION_QUEUE_CREATE, urQueueCreate,
+                           context, device, nullptr, &queue),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(capturedCall(capture, UR_FUNCTION_MEM_BUFFER_CREATE,
+                           urMemBufferCreate, context, UR_MEM_FLAG_READ_WRITE,
+                           sizeof(data), nullptr, &buffer),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(capturedCall(capture, UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE,
+                           urEnqueueMemBufferWrite, queue, buffer, false, 0,
+                           sizeof(data), data, 0, nullptr, nullptr),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(capturedCall(capture, UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ,
+                           urEnqueueMemBufferRead, queue, buffer, false, 0,
+                           sizeof(readBack), readBack, 0, nullptr, nullptr),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(capturedCall(capture, UR_FUNCTION_QUEUE_FINISH, urQueueFinish,
+                           queue),
+              UR_RESULT_SUCCESS);
+    capture.stop();
+
+    std::ostringstream out;
+    urreplay::replayer_t replayer(out);
+    ASSERT_TRUE(replayer.replay(captureFile));
+    EXPECT_EQ(replayer.stats().replayed, 9);
+    EXPECT_EQ(replayer.stats().mismatched, 0);
+
+    // the replayed write ran at the finish, from the memory of the replayer
+    auto replayedQueue = static_cast<ur_queue_handle_t>(
+        replayer.get_handle(reinterpret_cast<uintptr_t>(queue)));
+    auto replayedBuffer = static_cast<ur_mem_handle_t>(
+        replayer.get_handle(reinterpret_cast<uintptr_t>(buffer)));
+    ASSERT_NE(replayedBuffer, nullptr);
+    ASSERT_EQ(urEnqueueMemBufferRead(replayedQueue, replayedBuffer, true, 0,
+                                     sizeof(readBack), readBack, 0, nullptr,
+                                     nullptr),
+              UR_RESULT_SUCCESS);
+    EXPECT_EQ(std::memcmp(readBack, data, sizeof(data)), 0);
+}
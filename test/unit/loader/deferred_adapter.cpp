@@ -0,0 +1,204 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: MIT
+
+// a minimal adapter whose queues run the non-blocking buffer reads and
+// writes only once they are finished, like a device would run them
+// asynchronously, so that a test can tell whether the host memory of such a
+// command is still valid when the command runs
+
+#include <cstring>
+#include <functional>
+#include <vector>
+
+#include "ur_ddi.h"
+
+namespace {
+int platform;
+int device;
+int context;
+
+struct queue_t {
+    std::vector<std::function<void()>> pending;
+
+    void finish() {
+        for (auto &command : pending) {
+            command();
+        }
+        pending.clear();
+    }
+
+    void enqueue(bool blocking, std::function<void()> command) {
+        pending.push_back(std::move(command));
+        if (blocking) {
+            finish();
+        }
+    }
+};
+
+using buffer_t = std::vector<uint8_t>;
+
+queue_t *toQueue(ur_queue_handle_t hQueue) {
+    return reinterpret_cast<queue_t *>(hQueue);
+}
+
+buffer_t *toBuffer(ur_mem_handle_t hBuffer) {
+    return reinterpret_cast<buffer_t *>(hBuffer);
+}
+} // namespace
+
+UR_DLLEXPORT ur_result_t UR_APICALL
+urGetGlobalProcAddrTable(ur_api_version_t, ur_global_dditable_t *pDdiTable) {
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    pDdiTable->pfnInit = [](ur_device_init_flags_t) {
+        return UR_RESULT_SUCCESS;
+    };
+    pDdiTable->pfnTearDown = [](void *) { return UR_RESULT_SUCCESS; };
+    return UR_RESULT_SUCCESS;
+}
+
+UR_DLLEXPORT ur_result_t UR_APICALL urGetPlatformProcAddrTable(
+    ur_api_version_t, ur_platform_dditable_t *pDdiTable) {
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    pDdiTable->pfnGet = [](uint32_t NumEntries,
+                           ur_platform_handle_t *phPlatforms,
+                           uint32_t *pNumPlatforms) {
+        if (pNumPlatforms != nullptr) {
+            *pNumPlatforms = 1;
+        }
+        if (nullptr != phPlatforms && NumEntries > 0) {
+            *phPlatforms = reinterpret_cast<ur_platform_handle_t>(&platform);
+        }
+        return UR_RESULT_SUCCESS;
+    };
+    return UR_RESULT_SUCCESS;
+}
+
+UR_DLLEXPORT ur_result_t UR_APICALL
+urGetDeviceProcAddrTable(ur_api_version_t, ur_device_dditable_t *pDdiTable) {
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    pDdiTable->pfnGet = [](ur_platform_handle_t, ur_device_type_t,
+                           uint32_t NumEntries, ur_device_handle_t *phDevices,
+                           uint32_t *pNumDevices) {
+        if (pNumDevices != nullptr) {
+            *pNumDevices = 1;
+        }
+        if (nullptr != phDevices && NumEntries > 0) {
+            *phDevices = reinterpret_cast<ur_device_handle_t>(&device);
+        }
+        return UR_RESULT_SUCCESS;
+    };
+    return UR_RESULT_SUCCESS;
+}
+
+UR_DLLEXPORT ur_result_t UR_APICALL
+urGetContextProcAddrTable(ur_api_version_t, ur_context_dditable_t *pDdiTable) {
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    pDdiTable->pfnCreate = [](uint32_t, const ur_device_handle_t *,
+                              const ur_context_properties_t *,
+                              ur_context_handle_t *phContext) {
+        *phContext = reinterpret_cast<ur_context_handle_t>(&context);
+        return UR_RESULT_SUCCESS;
+    };
+    pDdiTable->pfnRelease = [](ur_context_handle_t) {
+        return UR_RESULT_SUCCESS;
+    };
+    return UR_RESULT_SUCCESS;
+}
+
+UR_DLLEXPORT ur_result_t UR_APICALL
+urGetQueueProcAddrTable(ur_api_version_t, ur_queue_dditable_t *pDdiTable) {
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    pDdiTable->pfnCreate = [](ur_context_handle_t, ur_device_handle_t,
+                              const ur_queue_properties_t *,
+                              ur_queue_handle_t *phQueue) {
+        *phQueue = reinterpret_cast<ur_queue_handle_t>(new queue_t);
+        return UR_RESULT_SUCCESS;
+    };
+    pDdiTable->pfnFinish = [](ur_queue_handle_t hQueue) {
+        toQueue(hQueue)->finish();
+        return UR_RESULT_SUCCESS;
+    };
+    pDdiTable->pfnRelease = [](ur_queue_handle_t hQueue) {
+        toQueue(hQueue)->finish();
+        delete toQueue(hQueue);
+        return UR_RESULT_SUCCESS;
+    };
+    return UR_RESULT_SUCCESS;
+}
+
+UR_DLLEXPORT ur_result_t UR_APICALL
+urGetMemProcAddrTable(ur_api_version_t, ur_mem_dditable_t *pDdiTable) {
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    pDdiTable->pfnBufferCreate = [](ur_context_handle_t, ur_mem_flags_t,
+                                    size_t size,
+                                    const ur_buffer_properties_t *,
+                                    ur_mem_handle_t *phBuffer) {
+        *phBuffer = reinterpret_cast<ur_mem_handle_t>(new buffer_t(size));
+        return UR_RESULT_SUCCESS;
+    };
+    pDdiTable->pfnRelease = [](ur_mem_handle_t hMem) {
+        delete toBuffer(hMem);
+        return UR_RESULT_SUCCESS;
+    };
+    return UR_RESULT_SUCCESS;
+}
+
+UR_DLLEXPORT ur_result_t UR_APICALL
+urGetEnqueueProcAddrTable(ur_api_version_t, ur_enqueue_dditable_t *pDdiTable) {
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    pDdiTable->pfnMemBufferWrite =
+        [](ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer,
+           bool blockingWrite, size_t offset, size_t size, const void *pSrc,
+           uint32_t, const ur_event_handle_t *, ur_event_handle_t *phEvent) {
+            if (phEvent != nullptr) {
+                *phEvent = nullptr;
+            }
+            toQueue(hQueue)->enqueue(blockingWrite, [=] {
+                std::memcpy(toBuffer(hBuffer)->data() + offset, pSrc, size);
+            });
+            return UR_RESULT_SUCCESS;
+        };
+    pDdiTable->pfnMemBufferRead =
+        [](ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer,
+           bool blockingRead, size_t offset, size_t size, void *pDst,
+           uint32_t, const ur_event_handle_t *, ur_event_handle_t *phEvent) {
+            if (phEvent != nullptr) {
+                *phEvent = nullptr;
+            }
+            toQueue(hQueue)->enqueue(blockingRead, [=] {
+                std::memcpy(pDst, toBuffer(hBuffer)->data() + offset, size);
+            });
+            return UR_RESULT_SUCCESS;
+        };
+    return UR_RESULT_SUCCESS;
+}
+
+// the loader fails to initialize unless every table is provided, the ones
+// above are the only ones the test uses
+
+#define STUB_EMPTY_TABLE(name, table_t)                                        \
+    UR_DLLEXPORT ur_result_t UR_APICALL name(ur_api_version_t,                \
+                                             table_t *pDdiTable) {             \
+        return nullptr == pDdiTable ? UR_RESULT_ERROR_INVALID_NULL_POINTER     \
+                                    : UR_RESULT_SUCCESS;                       \
+    }
+
+STUB_EMPTY_TABLE(urGetEventProcAddrTable, ur_event_dditable_t)
+STUB_EMPTY_TABLE(urGetProgramProcAddrTable, ur_program_dditable_t)
+STUB_EMPTY_TABLE(urGetKernelProcAddrTable, ur_kernel_dditable_t)
+STUB_EMPTY_TABLE(urGetSamplerProcAddrTable, ur_sampler_dditable_t)
+STUB_EMPTY_TABLE(urGetUSMProcAddrTable, ur_usm_dditable_t)
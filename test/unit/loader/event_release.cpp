@@ -0,0 +1,92 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: MIT
+
+#include <cstdio>
+#include <cstdlib>
+
+#include <gtest/gtest.h>
+
+#include "ur_api.h"
+
+/// resident set size of the process in bytes, or 0 if it is not known
+static size_t getResidentSize() {
+    size_t pages = 0;
+    size_t resident = 0;
+    FILE *statm = std::fopen("/proc/self/statm", "r");
+    if (statm == nullptr) {
+        return 0;
+    }
+    if (std::fscanf(statm, "%zu %zu", &pages, &resident) != 2) {
+        resident = 0;
+    }
+    std::fclose(statm);
+    return resident * 4096;
+}
+
+/// number of enqueue/release cycles of the soak, UR_SOAK_CYCLES overrides
+/// the default of 10M for quicker or longer runs
+static size_t getSoakCycles() {
+    const char *cycles = std::getenv("UR_SOAK_CYCLES");
+    if (cycles != nullptr && std::strtoull(cycles, nullptr, 10) > 0) {
+        return std::strtoull(cycles, nullptr, 10);
+    }
+    return 10000000;
+}
+
+class EventReleaseTest : public ::testing::Test {
+  protected:
+    ur_platform_handle_t platform = nullptr;
+    ur_device_handle_t device = nullptr;
+    ur_context_handle_t context = nullptr;
+    ur_queue_handle_t queue = nullptr;
+
+    void SetUp() override {
+        ASSERT_EQ(urInit(0), UR_RESULT_SUCCESS);
+        ASSERT_EQ(urPlatformGet(1, &platform, nullptr), UR_RESULT_SUCCESS);
+        ASSERT_EQ(urDeviceGet(platform, UR_DEVICE_TYPE_ALL, 1, &device,
+                              nullptr),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(urContextCreate(1, &device, nullptr, &context),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(urQueueCreate(context, device, nullptr, &queue),
+                  UR_RESULT_SUCCESS);
+    }
+
+    void TearDown() override {
+        urQueueRelease(queue);
+        urContextRelease(context);
+        urTearDown(nullptr);
+    }
+
+    void enqueueAndRelease(size_t cycles) {
+        for (size_t i = 0; i < cycles; ++i) {
+            ur_event_handle_t event = nullptr;
+            ASSERT_EQ(urEnqueueEventsWait(queue, 0, nullptr, &event),
+                      UR_RESULT_SUCCESS);
+            ASSERT_EQ(urEventRelease(event), UR_RESULT_SUCCESS);
+        }
+    }
+};
+
+// every event of the null adapter is a new handle, so each cycle creates a
+// loader object that is only freed by the release of the event
+TEST_F(EventReleaseTest, ResidentSizeStaysFlat) {
+    if (getResidentSize() == 0) {
+        GTEST_SKIP() << "the resident set size is not available";
+    }
+
+    // the first cycles populate the slab pools and the allocator caches
+    enqueueAndRelease(10000);
+    size_t before = getResidentSize();
+
+    // an event object leaked per cycle takes more than 48 bytes, so leaking
+    // them over the default 10M cycles grows the resident set size by well
+    // over 480 MB
+    size_t cycles = getSoakCycles();
+    enqueueAndRelease(cycles);
+    size_t after = getResidentSize();
+
+    EXPECT_LT(after, before + 8 * 1024 * 1024)
+        << cycles << " cycles, before: " << before
+        << " bytes, after: " << after << " bytes";
+}
@@ -2,7 +2,10 @@
 // SPDX-License-Identifier: MIT
 
 #include <fstream>
+#include <optional>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 #include "fixtures.hpp"
 #include "logger/ur_logger_details.hpp"
@@ -119,3 +122,142 @@ TEST_F(LoggerWithFileSink, NestedFilePath) {
     logger->warning("Test message: {}", "success");
     test_msg += "[WARNING]: Test message: success\n";
 }
+
+//////////////////////////////////////////////////////////////////////////////
+TEST_F(LoggerWithFileSink, AsyncFileSinkMultipleLines) {
+    logger = std::make_unique<logger::Logger>(
+        logger::Level::INFO,
+        std::make_unique<logger::AsyncFileSink>(logger_name, file_path));
+
+    logger->info("Test message: {}", "success");
+    logger->debug("This should not be printed: {}", 42);
+    logger->error("Test message: {}", 42);
+
+    test_msg += "[INFO]: Test message: success\n"
+                "<test>[ERROR]: Test message: 42\n";
+}
+
+TEST_F(LoggerWithFileSink, AsyncFileSinkFlushLevel) {
+    logger = std::make_unique<logger::Logger>(
+        logger::Level::INFO,
+        std::make_unique<logger::AsyncFileSink>(logger_name, file_path,
+                                                logger::Level::INFO));
+
+    logger->info("Test message: {}", "success");
+
+    // the message is written once the call returns
+    auto test_log = std::ifstream(file_path);
+    std::stringstream printed_msg;
+    printed_msg << test_log.rdbuf();
+    ASSERT_EQ(printed_msg.str(), "<test>[INFO]: Test message: success\n");
+
+    test_msg += "[INFO]: Test message: success\n";
+}
+
+TEST(AsyncFileSink, MultipleThreads) {
+    std::filesystem::path file_path = "ur_test_async_logger.log";
+    constexpr int num_threads = 8;
+    constexpr int num_messages = 1000;
+
+    {
+        logger::Logger logger(logger::Level::INFO,
+                              std::make_unique<logger::AsyncFileSink>(
+                                  "test", file_path, true));
+        std::vector<std::thread> threads;
+        for (int t = 0; t < num_threads; ++t) {
+            threads.emplace_back([&logger, t] {
+                for (int i = 0; i < num_messages; ++i) {
+                    logger.info("{} {}", t, i);
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+
+    std::ifstream test_log(file_path);
+    std::vector<int> next(num_threads, 0);
+    int t = 0, i = 0, lines = 0;
+    while (test_log >> t >> i) {
+        ASSERT_GE(t, 0);
+        ASSERT_LT(t, num_threads);
+        ASSERT_EQ(i, next[t]++);
+        ++lines;
+    }
+    test_log.close();
+    std::filesystem::remove(file_path);
+    ASSERT_EQ(lines, num_threads * num_messages);
+}
+
+TEST(AsyncFileSink, LogFromThreadExit) {
+    std::filesystem::path file_path = "ur_test_async_logger_exit.log";
+
+    {
+        logger::Logger logger(logger::Level::INFO,
+                              std::make_unique<logger::AsyncFileSink>(
+                                  "test", file_path, true));
+
+        // constructed before the buffers of the thread, destroyed after them
+        struct LogOnExit {
+            logger::Logger *logger = nullptr;
+            ~LogOnExit() { logger->info("at exit"); }
+        };
+
+        std::thread([&logger] {
+            thread_local LogOnExit logOnExit;
+            logOnExit.logger = &logger;
+            logger.info("in thread");
+        }).join();
+    }
+
+    std::ifstream test_log(file_path);
+    std::stringstream printed_msg;
+    printed_msg << test_log.rdbuf();
+    test_log.close();
+    std::filesystem::remove(file_path);
+    // the buffer of the thread and the one used after it is gone are not
+    // written in any particular order
+    ASSERT_NE(printed_msg.str().find("in thread\n"), std::string::npos);
+    ASSERT_NE(printed_msg.str().find("at exit\n"), std::string::npos);
+}
+
+TEST(AsyncFileSink, SinkAtReusedAddress) {
+    std::filesystem::path file_path = "ur_test_async_logger_reused.log";
+
+    // a thread logging to a sink, then to another one at the same address,
+    // must not keep using the buffer of the first
+    std::optional<logger::AsyncFileSink> sink;
+    for (int i = 0; i < 2; ++i) {
+        sink.emplace("test", file_path, true);
+        sink->log(logger::Level::INFO, "message {}", i);
+        sink.reset();
+    }
+
+    std::ifstream test_log(file_path);
+    std::stringstream printed_msg;
+    printed_msg << test_log.rdbuf();
+    test_log.close();
+    std::filesystem::remove(file_path);
+    ASSERT_EQ(printed_msg.str(), "message 1\n");
+}
+
+TEST(AsyncFileSink, BadFormat) {
+    std::filesystem::path file_path = "ur_test_async_logger_bad_format.log";
+
+    {
+        logger::AsyncFileSink sink("test", file_path, true);
+        sink.log(logger::Level::INFO, "before");
+        ASSERT_THROW(sink.log(logger::Level::INFO, "partial {x}", 1),
+                     std::runtime_error);
+        // would block on the buffer's lock if the failed message kept it
+        sink.log(logger::Level::INFO, "after");
+    }
+
+    std::ifstream test_log(file_path);
+    std::stringstream printed_msg;
+    printed_msg << test_log.rdbuf();
+    test_log.close();
+    std::filesystem::remove(file_path);
+    ASSERT_EQ(printed_msg.str(), "before\nafter\n");
+}
@@ -6,6 +6,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <memory>
+#include <string>
 
 #include "ur_api.h"
 #include "ur_params.hpp"
@@ -334,3 +335,46 @@ TEST(SerializePtr, nested_void_ptrs) {
     serializePtr(out, pppreal);
     EXPECT_THAT(out.str(), MatchesRegex(".+ \\(.+ \\(.+ \\(.+\\)\\)\\)"));
 }
+
+/// records the kind of every field serializeFunctionParamFields writes
+struct FieldKinds {
+    std::string kinds;
+
+    template <typename T> void number(const char *name, T) {
+        kinds += std::string(name) + ":number ";
+    }
+    void boolean(const char *name, bool) {
+        kinds += std::string(name) + ":boolean ";
+    }
+    void pointer(const char *name, const void *) {
+        kinds += std::string(name) + ":pointer ";
+    }
+    template <typename F> void text(const char *name, F &&) {
+        kinds += std::string(name) + ":text ";
+    }
+};
+
+TEST(SerializeFunctionParamFields, typed_fields) {
+    ur_queue_handle_t hQueue = nullptr;
+    ur_mem_handle_t hBuffer = nullptr;
+    bool blockingWrite = false;
+    size_t offset = 0;
+    size_t size = 4;
+    const void *pSrc = nullptr;
+    uint32_t numEventsInWaitList = 0;
+    const ur_event_handle_t *phEventWaitList = nullptr;
+    ur_event_handle_t *phEvent = nullptr;
+    ur_enqueue_mem_buffer_write_params_t params = {
+        &hQueue, &hBuffer, &blockingWrite, &offset, &size, &pSrc,
+        &numEventsInWaitList, &phEventWaitList, &phEvent};
+
+    FieldKinds fields;
+    EXPECT_EQ(serializeFunctionParamFields(
+                  fields, UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE, &params),
+              0);
+    EXPECT_EQ(fields.kinds,
+              "hQueue:pointer hBuffer:pointer blockingWrite:boolean "
+              "offset:number size:number pSrc:text "
+              "numEventsInWaitList:number phEventWaitList:text "
+              "phEvent:text ");
+}
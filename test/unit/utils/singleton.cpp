@@ -0,0 +1,140 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: MIT
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ur_singleton.hpp"
+
+struct test_handle_t_;
+using test_handle_t = test_handle_t_ *;
+
+struct test_object_t {
+    test_object_t(test_handle_t _handle, int _tag)
+        : handle(_handle), tag(_tag) {}
+
+    test_handle_t handle;
+    int tag;
+};
+
+using test_factory_t = singleton_factory_t<test_object_t, test_handle_t>;
+
+static test_handle_t make_handle(size_t i) {
+    // mimic aligned heap addresses handed out by adapters
+    return reinterpret_cast<test_handle_t>((i + 1) * 64);
+}
+
+TEST(SlabPool, ReuseSlots) {
+    slab_pool_t<test_object_t, 4> pool;
+    std::vector<test_object_t *> objects;
+    for (int i = 0; i < 10; ++i) {
+        objects.push_back(pool.create(make_handle(i), i));
+        EXPECT_EQ(objects.back()->tag, i);
+    }
+
+    auto released = objects[5];
+    pool.destroy(released);
+    auto reused = pool.create(make_handle(42), 42);
+    EXPECT_EQ(reused, released);
+    EXPECT_EQ(reused->handle, make_handle(42));
+    EXPECT_EQ(objects[4]->tag, 4);
+}
+
+TEST(SingletonFactory, NullKey) {
+    test_factory_t factory;
+    EXPECT_EQ(factory.getInstance(test_handle_t(nullptr), 0), nullptr);
+}
+
+TEST(SingletonFactory, SameKeySameInstance) {
+    test_factory_t factory;
+    auto first = factory.getInstance(make_handle(0), 1);
+    auto second = factory.getInstance(make_handle(0), 2);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(first->handle, make_handle(0));
+    EXPECT_EQ(second->tag, 1);
+}
+
+TEST(SingletonFactory, Release) {
+    test_factory_t factory;
+    auto first = factory.acquire(make_handle(0), 1);
+    factory.release(make_handle(0));
+    auto second = factory.acquire(make_handle(0), 2);
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(second->tag, 2);
+    (void)first;
+}
+
+TEST(SingletonFactory, ReleaseLastReference) {
+    test_factory_t factory;
+    auto first = factory.acquire(make_handle(0), 1);
+    factory.acquire(make_handle(0), 2);
+    factory.retain(make_handle(0));
+
+    factory.release(make_handle(0));
+    factory.release(make_handle(0));
+    EXPECT_EQ(factory.getInstance(make_handle(0), 3), first);
+
+    factory.release(make_handle(0));
+    auto second = factory.acquire(make_handle(0), 4);
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(second->tag, 4);
+}
+
+TEST(SingletonFactory, LookupHoldsNoReference) {
+    test_factory_t factory;
+    auto first = factory.getInstance(make_handle(0), 1);
+    factory.getInstance(make_handle(0), 2);
+
+    // e.g. a root device, released by the application as often as it
+    // likes, but never destroyed
+    factory.retain(make_handle(0));
+    factory.release(make_handle(0));
+    factory.release(make_handle(0));
+    EXPECT_EQ(factory.getInstance(make_handle(0), 3), first);
+    EXPECT_EQ(first->tag, 1);
+
+    // an object returned by a create from then on is owned
+    EXPECT_EQ(factory.acquire(make_handle(0), 4), first);
+    factory.release(make_handle(0));
+    auto second = factory.getInstance(make_handle(0), 5);
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(second->tag, 5);
+}
+
+TEST(SingletonFactory, ConcurrentGetInstance) {
+    constexpr size_t numThreads = 8;
+    constexpr size_t numHandles = 4096;
+
+    test_factory_t factory;
+    std::vector<std::vector<test_object_t *>> results(numThreads);
+    std::atomic<bool> start = false;
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < numThreads; ++t) {
+        threads.emplace_back([&, t] {
+            while (!start) {
+                std::this_thread::yield();
+            }
+            for (size_t i = 0; i < numHandles; ++i) {
+                results[t].push_back(
+                    factory.getInstance(make_handle(i), static_cast<int>(t)));
+            }
+        });
+    }
+    start = true;
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (size_t i = 0; i < numHandles; ++i) {
+        ASSERT_NE(results[0][i], nullptr);
+        EXPECT_EQ(results[0][i]->handle, make_handle(i));
+        for (size_t t = 1; t < numThreads; ++t) {
+            EXPECT_EQ(results[0][i], results[t][i]);
+        }
+    }
+}
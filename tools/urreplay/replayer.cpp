@@ -0,0 +1,388 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file replayer.cpp
+ *
+ */
+
+#include "replayer.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+#include "ur_params.hpp"
+
+using namespace ur_tracing_layer;
+using ur_params::capture_param_t;
+using ur_params::param_kind_t;
+
+namespace urreplay {
+
+template <typename T>
+static bool read(const uint8_t *&data, const uint8_t *end, T &value) {
+    if (static_cast<size_t>(end - data) < sizeof(value)) {
+        return false;
+    }
+    std::memcpy(&value, data, sizeof(value));
+    data += sizeof(value);
+    return true;
+}
+
+static bool read_bytes(const uint8_t *&data, const uint8_t *end, void *dst,
+                       uint64_t size) {
+    if (static_cast<uint64_t>(end - data) < size) {
+        return false;
+    }
+    std::memcpy(dst, data, size);
+    data += size;
+    return true;
+}
+
+void *replayer_t::get_handle(uint64_t captured) const {
+    auto it = handles.find(captured);
+    return it == handles.end() ? nullptr : it->second;
+}
+
+bool replayer_t::replay(const std::string &path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        out << "cannot open " << path << "\n";
+        return false;
+    }
+    std::vector<uint8_t> capture((std::istreambuf_iterator<char>(file)),
+                                 std::istreambuf_iterator<char>());
+
+    const uint8_t *data = capture.data();
+    const uint8_t *end = data + capture.size();
+    capture_file_header_t header;
+    if (!read(data, end, header) ||
+        std::memcmp(header.magic, "URCAPTUR", sizeof(header.magic)) != 0 ||
+        header.version != 1) {
+        out << path << " is not a capture file\n";
+        return false;
+    }
+
+    capture_record_t record;
+    while (read(data, end, record)) {
+        if (static_cast<size_t>(end - data) < record.size) {
+            break;
+        }
+        stats_.records++;
+        replay_record(record, data);
+        data += record.size;
+    }
+
+    while (!enqueued.empty()) {
+        finish(enqueued.begin()->first);
+    }
+
+    if (data != end) {
+        out << path << " is truncated\n";
+        return false;
+    }
+    return true;
+}
+
+void replayer_t::replay_record(const capture_record_t &record,
+                               const uint8_t *data) {
+    auto name = ur_params::getFunctionName(record.function);
+    size_t count = 0;
+    auto descs = ur_params::getCaptureParams(record.function, &count);
+    if (nullptr == descs) {
+        out << "skipped an unknown function " << record.function << "\n";
+        stats_.skipped++;
+        return;
+    }
+
+    if (record.flags & CAPTURE_RECORD_INCOMPLETE) {
+        if (verbose) {
+            out << "skipped " << name
+                << ": the capture does not hold all of its arguments\n";
+        }
+        stats_.skipped++;
+        return;
+    }
+
+    std::vector<arg_t> args(count);
+    std::vector<void *> params(count);
+    const uint8_t *end = data + record.size;
+    for (size_t i = 0; i < count; ++i) {
+        params[i] = args[i].value;
+        if (!decode(descs[i], data, end, args[i])) {
+            out << "skipped " << name << ": " << error << "\n";
+            stats_.skipped++;
+            return;
+        }
+    }
+
+    // the enqueues and the queue functions take the queue first
+    void *queue = nullptr;
+    if (count > 0) {
+        std::memcpy(&queue, args[0].value, sizeof(queue));
+    }
+    if (record.function == UR_FUNCTION_QUEUE_RELEASE) {
+        finish(queue);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    ur_result_t result = ur_params::replayCall(record.function, params.data());
+    stats_.call_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          std::chrono::steady_clock::now() - start)
+                          .count();
+    stats_.replayed++;
+
+    if (verbose) {
+        out << name << "(";
+        ur_params::serializeFunctionParams(out, record.function,
+                                           params.data());
+        out << ") -> " << result << ";\n";
+    }
+
+    auto captured = static_cast<ur_result_t>(record.result);
+    if (result != captured) {
+        stats_.mismatched++;
+        out << name << " returned " << result << ", the capture returned "
+            << captured << "\n";
+    }
+
+    if (result == UR_RESULT_SUCCESS && captured == UR_RESULT_SUCCESS) {
+        update_mappings(record.function, descs, args);
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return;
+    }
+    if (record.function == UR_FUNCTION_QUEUE_FINISH) {
+        enqueued.erase(queue);
+    } else if (std::strncmp(name, "urEnqueue", 9) == 0) {
+        // moving the arguments keeps the memory they point to in place
+        enqueued[queue].push_back(std::move(args));
+    }
+}
+
+void replayer_t::finish(void *queue) {
+    auto it = enqueued.find(queue);
+    if (it == enqueued.end()) {
+        return;
+    }
+    urQueueFinish(static_cast<ur_queue_handle_t>(queue));
+    enqueued.erase(it);
+}
+
+bool replayer_t::decode(const capture_param_t &desc, const uint8_t *&data,
+                        const uint8_t *end, arg_t &arg) {
+    error = "truncated record";
+
+    switch (desc.kind) {
+    case param_kind_t::value:
+        if (desc.size > sizeof(arg.value)) {
+            error = "unsupported argument size";
+            return false;
+        }
+        return read_bytes(data, end, arg.value, desc.size);
+    case param_kind_t::handle: {
+        uint64_t handle = 0;
+        if (!read(data, end, handle)) {
+            return false;
+        }
+        void *replayed = get_handle(handle);
+        if (handle != 0 && nullptr == replayed) {
+            std::ostringstream msg;
+            msg << "unknown handle 0x" << std::hex << handle;
+            error = msg.str();
+            return false;
+        }
+        arg.set_pointer(replayed);
+        return true;
+    }
+    case param_kind_t::handle_array:
+    case param_kind_t::handle_out: {
+        uint64_t count = 0;
+        if (!read(data, end, count)) {
+            return false;
+        }
+        if (count == CAPTURE_NULL) {
+            arg.set_pointer(nullptr);
+            return true;
+        }
+        if (static_cast<uint64_t>(end - data) / sizeof(uint64_t) < count) {
+            return false;
+        }
+        arg.data.resize(count * sizeof(void *));
+        auto replayed = reinterpret_cast<void **>(arg.data.data());
+        for (uint64_t i = 0; i < count; ++i) {
+            uint64_t handle = 0;
+            read(data, end, handle);
+            if (desc.kind == param_kind_t::handle_out) {
+                arg.captured.push_back(handle);
+                continue;
+            }
+            replayed[i] = get_handle(handle);
+            if (handle != 0 && nullptr == replayed[i]) {
+                std::ostringstream msg;
+                msg << "unknown handle 0x" << std::hex << handle;
+                error = msg.str();
+                return false;
+            }
+        }
+        arg.set_pointer(arg.data.data());
+        return true;
+    }
+    case param_kind_t::data:
+    case param_kind_t::desc:
+    case param_kind_t::string: {
+        uint64_t count = 0;
+        if (!read(data, end, count)) {
+            return false;
+        }
+        if (count == CAPTURE_NULL) {
+            arg.set_pointer(nullptr);
+            return true;
+        }
+        uint64_t size = desc.kind == param_kind_t::string ? count
+                                                          : count * desc.size;
+        if (static_cast<uint64_t>(end - data) < size) {
+            return false;
+        }
+        // a string keeps the terminating null of the resize
+        arg.data.resize(desc.kind == param_kind_t::string ? size + 1 : size);
+        read_bytes(data, end, arg.data.data(), size);
+        arg.set_pointer(arg.data.data());
+        return true;
+    }
+    case param_kind_t::memory:
+    case param_kind_t::memory_out:
+        return decode_memory(data, end, arg);
+    case param_kind_t::alloc_out: {
+        uint64_t address = 0;
+        if (!read(data, end, address)) {
+            return false;
+        }
+        arg.captured.push_back(address);
+        arg.data.resize(sizeof(void *));
+        arg.set_pointer(arg.data.data());
+        return true;
+    }
+    case param_kind_t::out: {
+        uint64_t size = 0;
+        if (!read(data, end, size)) {
+            return false;
+        }
+        if (size == CAPTURE_NULL) {
+            arg.set_pointer(nullptr);
+            return true;
+        }
+        arg.data.resize(size ? size : 1);
+        arg.set_pointer(arg.data.data());
+        return true;
+    }
+    case param_kind_t::unsupported: {
+        uint8_t present = 0;
+        if (!read(data, end, present)) {
+            return false;
+        }
+        if (present) {
+            error = "unsupported argument";
+            return false;
+        }
+        arg.set_pointer(nullptr);
+        return true;
+    }
+    case param_kind_t::ignored:
+        arg.set_pointer(nullptr);
+        return true;
+    }
+
+    error = "unknown argument kind";
+    return false;
+}
+
+bool replayer_t::decode_memory(const uint8_t *&data, const uint8_t *end,
+                               arg_t &arg) {
+    uint8_t tag = 0;
+    if (!read(data, end, tag)) {
+        return false;
+    }
+
+    switch (tag) {
+    case CAPTURE_MEMORY_NULL:
+        arg.set_pointer(nullptr);
+        return true;
+    case CAPTURE_MEMORY_ALLOCATION: {
+        uint64_t address = 0;
+        uint64_t offset = 0;
+        if (!read(data, end, address) || !read(data, end, offset)) {
+            return false;
+        }
+        auto it = allocations.find(address);
+        if (it == allocations.end()) {
+            std::ostringstream msg;
+            msg << "unknown memory 0x" << std::hex << address;
+            error = msg.str();
+            return false;
+        }
+        arg.captured.push_back(address);
+        arg.set_pointer(static_cast<uint8_t *>(it->second) + offset);
+        return true;
+    }
+    case CAPTURE_MEMORY_HOST_DATA:
+    case CAPTURE_MEMORY_HOST_OUTPUT: {
+        uint64_t size = 0;
+        if (!read(data, end, size)) {
+            return false;
+        }
+        arg.data.resize(size ? size : 1);
+        if (tag == CAPTURE_MEMORY_HOST_DATA &&
+            !read_bytes(data, end, arg.data.data(), size)) {
+            return false;
+        }
+        arg.set_pointer(arg.data.data());
+        return true;
+    }
+    default:
+        error = "host memory of unknown size";
+        return false;
+    }
+}
+
+void replayer_t::update_mappings(uint32_t function,
+                                 const capture_param_t *descs,
+                                 std::vector<arg_t> &args) {
+    for (size_t i = 0; i < args.size(); ++i) {
+        auto &arg = args[i];
+        auto replayed = reinterpret_cast<void **>(arg.data.data());
+        switch (descs[i].kind) {
+        case param_kind_t::handle_out:
+        case param_kind_t::alloc_out:
+            for (size_t k = 0; k < arg.captured.size(); ++k) {
+                if (arg.captured[k] == 0 || nullptr == replayed[k]) {
+                    continue;
+                }
+                if (descs[i].kind == param_kind_t::handle_out) {
+                    handles[arg.captured[k]] = replayed[k];
+                } else {
+                    allocations[arg.captured[k]] = replayed[k];
+                }
+            }
+            break;
+        case param_kind_t::memory:
+            // the memory the call releases can be returned again
+            if (function == UR_FUNCTION_USM_FREE ||
+                function == UR_FUNCTION_ENQUEUE_MEM_UNMAP) {
+                for (auto address : arg.captured) {
+                    allocations.erase(address);
+                }
+            }
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+} // namespace urreplay
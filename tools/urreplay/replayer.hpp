@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file replayer.hpp
+ *
+ */
+
+#ifndef UR_REPLAYER_HPP
+#define UR_REPLAYER_HPP 1
+
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ur_api.h"
+#include "ur_capture.hpp"
+
+namespace urreplay {
+
+/// outcome of the replay of a capture
+struct replay_stats_t {
+    uint64_t records = 0;    ///< calls in the capture
+    uint64_t replayed = 0;   ///< calls issued again
+    uint64_t skipped = 0;    ///< calls that could not be issued
+    uint64_t mismatched = 0; ///< replayed calls with another result
+    uint64_t call_ns = 0;    ///< time spent in the replayed calls
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// issues the calls of a capture file again, in the order they returned
+///
+/// the handles and the memory returned by the calls are mapped to those
+/// returned when they are replayed, the calls that use a handle or memory
+/// the replay does not know of are skipped
+class replayer_t {
+  public:
+    explicit replayer_t(std::ostream &out, bool verbose = false)
+        : out(out), verbose(verbose) {}
+
+    /// replays the calls of a capture file, returns false if the file cannot
+    /// be read to its end
+    bool replay(const std::string &path);
+
+    const replay_stats_t &stats() const { return stats_; }
+
+    /// the handle a handle of the capture was replayed as, nullptr if none
+    void *get_handle(uint64_t captured) const;
+
+  private:
+    /// storage of an argument of a replayed call
+    struct arg_t {
+        alignas(8) uint8_t value[32] = {}; ///< the argument
+        std::vector<uint8_t> data;         ///< what it points to
+        /// the values of the capture the call returns through the argument,
+        /// or the address of the allocation it points into
+        std::vector<uint64_t> captured;
+
+        void set_pointer(const void *ptr) {
+            std::memcpy(value, &ptr, sizeof(ptr));
+        }
+    };
+
+    void replay_record(const ur_tracing_layer::capture_record_t &record,
+                       const uint8_t *data);
+    bool decode(const ur_params::capture_param_t &desc, const uint8_t *&data,
+                const uint8_t *end, arg_t &arg);
+    bool decode_memory(const uint8_t *&data, const uint8_t *end, arg_t &arg);
+    void update_mappings(uint32_t function,
+                         const ur_params::capture_param_t *descs,
+                         std::vector<arg_t> &args);
+    /// waits for the commands enqueued to a queue and frees their arguments
+    void finish(void *queue);
+
+    std::ostream &out;
+    bool verbose;
+    replay_stats_t stats_;
+    /// why the arguments of the current record could not be decoded
+    std::string error;
+    /// handles of the capture to the handles of the replay
+    std::unordered_map<uint64_t, void *> handles;
+    /// addresses of the memory returned in the capture to those of the
+    /// replay
+    std::map<uint64_t, void *> allocations;
+    /// the arguments of the commands enqueued to a queue since it was last
+    /// finished, a non-blocking command may still read or write the host
+    /// memory they hold
+    std::unordered_map<void *, std::vector<std::vector<arg_t>>> enqueued;
+};
+
+} // namespace urreplay
+
+#endif /* UR_REPLAYER_HPP */
@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file urreplay.cpp
+ *
+ * Replays the Unified Runtime calls of a capture file, written by the tracing
+ * layer when UR_CAPTURE_FILE is set, against the adapters the loader finds.
+ */
+
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include "replayer.hpp"
+
+static void usage(const char *argv0) {
+    std::cerr << "usage: " << argv0 << " [--verbose] <capture file>\n"
+              << "\n"
+              << "  --verbose  print every replayed call with its arguments\n";
+}
+
+int main(int argc, char *argv[]) {
+    bool verbose = false;
+    const char *path = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--verbose") == 0) {
+            verbose = true;
+        } else if (argv[i][0] != '-' && nullptr == path) {
+            path = argv[i];
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (nullptr == path) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    urreplay::replayer_t replayer(std::cout, verbose);
+    bool complete = replayer.replay(path);
+
+    auto &stats = replayer.stats();
+    std::cout << "replayed " << stats.replayed << " of " << stats.records
+              << " calls in " << stats.call_ns / 1000 << "us, "
+              << stats.skipped << " skipped, " << stats.mismatched
+              << " with another result\n";
+
+    return complete ? 0 : 1;
+}
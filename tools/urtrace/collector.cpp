@@ -10,7 +10,17 @@
  * execution time.
  */
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bitset>
 #include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <iomanip>
+#include <iterator>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <regex>
 #include <sstream>
@@ -19,6 +29,16 @@
 #include <string_view>
 #include <vector>
 
+#ifdef _WIN32
+#include <process.h>
+// keeps windows.h from defining the min and max macros
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 #include "logger/ur_logger.hpp"
 #include "ur_api.h"
 #include "ur_params.hpp"
@@ -85,6 +105,46 @@ std::string time_to_str(std::chrono::nanoseconds dur, enum time_unit unit) {
     return ostr.str();
 }
 
+enum output_format {
+    OUTPUT_FORMAT_TEXT,
+    OUTPUT_FORMAT_JSONL,
+    OUTPUT_FORMAT_CSV,
+    MAX_OUTPUT_FORMAT,
+};
+
+const char *output_format_str[MAX_OUTPUT_FORMAT] = {"text", "jsonl", "csv"};
+
+/*
+ * The filter regex, matched once against the names of all the known
+ * functions. Checking an event is then a single bit test on its function id.
+ * Functions unknown to the collector, for example from a newer loader, are
+ * still matched against the regex.
+ */
+class function_filter {
+    static constexpr uint32_t max_function_id = 256;
+
+    std::regex regex;
+    std::bitset<max_function_id> known;
+    std::bitset<max_function_id> matching;
+
+  public:
+    explicit function_filter(const std::string &pattern) : regex(pattern) {
+        for (uint32_t id = 0; id < max_function_id; ++id) {
+            if (auto name = ur_params::getFunctionName(id)) {
+                known[id] = true;
+                matching[id] = std::regex_match(name, regex);
+            }
+        }
+    }
+
+    bool matches(uint32_t function_id, const char *function_name) const {
+        if (function_id < max_function_id && known[function_id]) {
+            return matching[function_id];
+        }
+        return std::regex_match(function_name, regex);
+    }
+};
+
 /*
  * Since this is a library that gets loaded alongside the traced program, it
  * can't just accept arguments from the trace CLI tool directly. Instead, the
@@ -96,6 +156,10 @@ std::string time_to_str(std::chrono::nanoseconds dur, enum time_unit unit) {
  * - "profiling"
  * - "time_unit:<auto,ns, ...>"
  * - "filter:<regex>"
+ * - "chrome_trace:<path>"
+ * - "stats"
+ * - "device_timing"
+ * - "format:<text,jsonl,csv>"
  */
 static class cli_args {
     std::optional<std::string>
@@ -115,10 +179,14 @@ static class cli_args {
     cli_args() {
         print_begin = false;
         profiling = false;
+        stats = false;
+        device_timing = false;
         time_unit = TIME_UNIT_AUTO;
+        format = OUTPUT_FORMAT_TEXT;
         no_args = false;
         filter = std::nullopt;
         filter_str = std::nullopt;
+        chrome_trace = std::nullopt;
         if (auto args = getenv_to_map(ARGS_ENV, false)) {
             for (auto [arg_name, arg_values] : *args) {
                 if (arg_name == "print_begin") {
@@ -127,6 +195,10 @@ static class cli_args {
                     profiling = true;
                 } else if (arg_name == "no_args") {
                     no_args = true;
+                } else if (arg_name == "stats") {
+                    stats = true;
+                } else if (arg_name == "device_timing") {
+                    device_timing = true;
                 } else if (auto unit = arg_with_value("time_unit", arg_name,
                                                       arg_values)) {
                     for (int i = 0; i < MAX_TIME_UNIT; ++i) {
@@ -135,37 +207,70 @@ static class cli_args {
                             break;
                         }
                     }
+                } else if (auto fmt =
+                               arg_with_value("format", arg_name, arg_values)) {
+                    for (int i = 0; i < MAX_OUTPUT_FORMAT; ++i) {
+                        if (output_format_str[i] == fmt) {
+                            format = (enum output_format)i;
+                            break;
+                        }
+                    }
                 } else if (auto filter_str =
                                arg_with_value("filter", arg_name, arg_values)) {
                     try {
-                        filter = filter_str;
+                        filter.emplace(*filter_str);
                     } catch (const std::regex_error &err) {
                         out.warn("invalid filter regex {} {}", *filter_str,
                                  err.what());
                     }
+                } else if (auto path = arg_with_value("chrome_trace", arg_name,
+                                                      arg_values)) {
+                    chrome_trace = path;
                 } else {
                     out.warn("unknown {} argument {}.", ARGS_ENV, arg_name);
                 }
             }
         }
         out.debug("collector args (.print_begin = {}, .profiling = {}, "
-                  ".time_unit = {}, .filter = {})",
-                  print_begin, profiling, time_unit_str[time_unit],
-                  filter_str.has_value() ? *filter_str : "none");
+                  ".stats = {}, .device_timing = {}, .time_unit = {}, "
+                  ".format = {}, .filter = {}, .chrome_trace = {})",
+                  print_begin, profiling, stats, device_timing,
+                  time_unit_str[time_unit], output_format_str[format],
+                  filter_str.has_value() ? *filter_str : "none",
+                  chrome_trace.has_value() ? *chrome_trace : "none");
     }
 
     enum time_unit time_unit;
+    enum output_format format;
     bool print_begin;
     bool profiling;
+    bool stats;
+    bool device_timing;
     bool no_args;
     std::optional<std::string>
         filter_str; //the filter_str is kept primarly for printing.
-    std::optional<std::regex> filter;
+    std::optional<function_filter> filter;
+    std::optional<std::string> chrome_trace;
 } cli_args;
 
 using namespace ur_params;
 
-typedef std::chrono::high_resolution_clock Clock;
+typedef std::chrono::steady_clock Clock;
+
+/*
+ * The tracing layer passes the time of a trace point in the user data of the
+ * payload when it notifies it late, as it does for the calls picked by the
+ * slow call sampling, as steady clock nanoseconds.
+ */
+std::optional<std::chrono::time_point<Clock>>
+trace_point_time(const xpti::function_with_args_t *args) {
+    if (!args->user_data) {
+        return std::nullopt;
+    }
+    return std::chrono::time_point<Clock>(
+        std::chrono::duration_cast<Clock::duration>(std::chrono::nanoseconds(
+            *static_cast<const uint64_t *>(args->user_data))));
+}
 
 struct fn_context {
     uint64_t instance;
@@ -191,9 +296,631 @@ std::optional<fn_context> pop_instance_data(uint64_t instance) {
     return data;
 }
 
+/// appends a string to a JSON string literal
+void append_json_escaped(std::string &str, std::string_view value) {
+    for (char c : value) {
+        if (c == '"' || c == '\\') {
+            str += '\\';
+            str += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char esc[8];
+            snprintf(esc, sizeof(esc), "\\u%04x", c);
+            str += esc;
+        } else {
+            str += c;
+        }
+    }
+}
+
+/*
+ * Writes the traced calls as pairs of begin ("ph":"B") and end ("ph":"E")
+ * events of the Trace Event Format, a JSON timeline that Perfetto and
+ * chrome://tracing can open. The events carry the id the operating system
+ * gives the calling thread, the end event also the result and parameters.
+ *
+ * The events are formatted into per-thread buffers, which are appended to the
+ * file once they grow large, when their thread exits and when the trace is
+ * closed, so that the traced threads do not contend on the file. The events
+ * of a thread are therefore in the order the thread emitted them, nested
+ * calls end before the calls they are nested in.
+ */
+static class chrome_trace {
+    struct thread_buffer {
+        std::mutex mut;
+        std::string events;
+        uint64_t tid = 0; ///< id of the thread in the operating system
+    };
+
+    /// flushes the buffer of a thread when the thread exits
+    struct buffer_owner {
+        chrome_trace *trace = nullptr;
+        thread_buffer *buffer = nullptr;
+        ~buffer_owner() {
+            if (buffer) {
+                std::scoped_lock<std::mutex> lock(buffer->mut);
+                trace->flush(*buffer);
+            }
+        }
+    };
+
+    static constexpr size_t flush_threshold = 64 * 1024;
+
+    std::mutex mut; ///< guards the file and the list of buffers
+    FILE *file = nullptr;
+    std::vector<std::unique_ptr<thread_buffer>> buffers;
+    std::atomic<bool> active = false;
+    Clock::time_point epoch;
+    uint64_t pid = 0;
+
+    thread_buffer *get_buffer() {
+        static thread_local buffer_owner owner;
+        if (!owner.buffer) {
+            std::scoped_lock<std::mutex> lock(mut);
+            auto &buffer = buffers.emplace_back(new thread_buffer);
+            buffer->tid = get_thread_id();
+            owner.trace = this;
+            owner.buffer = buffer.get();
+        }
+        return owner.buffer;
+    }
+
+    void flush(thread_buffer &buffer) {
+        std::scoped_lock<std::mutex> lock(mut);
+        if (file && !buffer.events.empty()) {
+            fwrite(buffer.events.data(), 1, buffer.events.size(), file);
+        }
+        buffer.events.clear();
+    }
+
+    /// the format's timestamps are in microseconds, the fraction keeps
+    /// the nanoseconds
+    void append_us(std::string &str, std::chrono::nanoseconds time) {
+        char us[32];
+        snprintf(us, sizeof(us), "%lld.%03lld",
+                 static_cast<long long>(time.count() / 1000),
+                 static_cast<long long>(time.count() % 1000));
+        str += us;
+    }
+
+    static uint64_t get_thread_id() {
+#ifdef _WIN32
+        return GetCurrentThreadId();
+#else
+        return static_cast<uint64_t>(syscall(SYS_gettid));
+#endif
+    }
+
+    /// starts an event of the calling thread, which the caller completes
+    std::string &append_event(thread_buffer &buffer, const char *phase,
+                              const char *name,
+                              std::chrono::time_point<Clock> time) {
+        auto &str = buffer.events;
+        str += ",\n{\"name\":\"";
+        append_json_escaped(str, name);
+        str += "\",\"cat\":\"ur\",\"ph\":\"";
+        str += phase;
+        str += "\",\"ts\":";
+        append_us(str, time - epoch);
+        str += ",\"pid\":" + std::to_string(pid);
+        str += ",\"tid\":" + std::to_string(buffer.tid);
+        return str;
+    }
+
+  public:
+    bool open(const std::string &path) {
+        std::scoped_lock<std::mutex> lock(mut);
+        file = fopen(path.c_str(), "w");
+        if (!file) {
+            return false;
+        }
+#ifdef _WIN32
+        pid = _getpid();
+#else
+        pid = getpid();
+#endif
+        epoch = Clock::now();
+        // the process name comes first, so that every event that follows can
+        // be separated from the previous one with a comma
+        fprintf(file,
+                "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"
+                "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%llu,"
+                "\"args\":{\"name\":\"urtrace\"}}",
+                static_cast<unsigned long long>(pid));
+        active = true;
+        return true;
+    }
+
+    bool is_open() const { return active.load(std::memory_order_relaxed); }
+
+    /// the begin event only carries what is known when the call starts, so
+    /// that formatting it adds little to the traced call
+    void begin(const xpti::function_with_args_t *args,
+               std::chrono::time_point<Clock> start) {
+        auto buffer = get_buffer();
+        std::scoped_lock<std::mutex> lock(buffer->mut);
+        append_event(*buffer, "B", args->function_name, start) += '}';
+    }
+
+    void end(const xpti::function_with_args_t *args, uint64_t instance,
+             std::chrono::time_point<Clock> end) {
+        auto buffer = get_buffer();
+        std::scoped_lock<std::mutex> lock(buffer->mut);
+        auto &str = append_event(*buffer, "E", args->function_name, end);
+        str += ",\"args\":{\"instance\":" + std::to_string(instance);
+
+        std::ostringstream result;
+        result << *static_cast<const ur_result_t *>(args->ret_data);
+        str += ",\"result\":\"";
+        append_json_escaped(str, result.str());
+        str += '"';
+
+        if (!cli_args.no_args) {
+            std::ostringstream params;
+            ur_params::serializeFunctionParams(params, args->function_id,
+                                               args->args_data);
+            str += ",\"params\":\"";
+            append_json_escaped(str, params.str());
+            str += '"';
+        }
+        str += "}}";
+
+        if (str.size() >= flush_threshold) {
+            flush(*buffer);
+        }
+    }
+
+    void close() {
+        if (!active.exchange(false)) {
+            return;
+        }
+
+        std::vector<thread_buffer *> pending;
+        {
+            std::scoped_lock<std::mutex> lock(mut);
+            for (auto &buffer : buffers) {
+                pending.push_back(buffer.get());
+            }
+        }
+        for (auto buffer : pending) {
+            std::scoped_lock<std::mutex> lock(buffer->mut);
+            flush(*buffer);
+        }
+
+        std::scoped_lock<std::mutex> lock(mut);
+        fprintf(file, "\n]}\n");
+        fclose(file);
+        file = nullptr;
+    }
+
+    ~chrome_trace() { close(); }
+} chrome_trace;
+
+/*
+ * Latency distribution of a function on a single thread.
+ *
+ * The buckets are log-linear: each power of two is split into 8 linear
+ * sub-buckets, so that a reported percentile is off by at most 12.5% while
+ * the whole range of uint64_t nanoseconds fits into 496 buckets.
+ *
+ * Only the owning thread writes the counters. They are relaxed atomics, and
+ * updated with plain loads and stores rather than read-modify-write
+ * operations, so that the summary may read them while the thread still runs.
+ */
+struct latency_histogram {
+    static constexpr unsigned sub_bucket_bits = 3;
+    static constexpr uint64_t sub_buckets = 1 << sub_bucket_bits;
+    static constexpr size_t num_buckets = (64 - sub_bucket_bits + 1) *
+                                          sub_buckets;
+
+    const char *name = nullptr;
+    std::atomic<uint64_t> count = 0;
+    std::atomic<uint64_t> total = 0;
+    std::atomic<uint64_t> min = UINT64_MAX;
+    std::atomic<uint64_t> max = 0;
+    std::array<std::atomic<uint64_t>, num_buckets> buckets = {};
+
+    static size_t bucket_index(uint64_t ns) {
+        if (ns < sub_buckets) {
+            return ns;
+        }
+        unsigned exp = 63;
+        while (!(ns >> exp)) {
+            --exp;
+        }
+        unsigned shift = exp - sub_bucket_bits;
+        return ((shift + 1) << sub_bucket_bits) |
+               ((ns >> shift) & (sub_buckets - 1));
+    }
+
+    /// the largest value that falls into the bucket
+    static uint64_t bucket_max(size_t index) {
+        if (index < sub_buckets) {
+            return index;
+        }
+        unsigned shift = static_cast<unsigned>(index >> sub_bucket_bits) - 1;
+        uint64_t lower = (sub_buckets + (index & (sub_buckets - 1))) << shift;
+        return lower + ((uint64_t(1) << shift) - 1);
+    }
+
+    static void increment(std::atomic<uint64_t> &counter, uint64_t value) {
+        counter.store(counter.load(std::memory_order_relaxed) + value,
+                      std::memory_order_relaxed);
+    }
+
+    void add(uint64_t ns) {
+        increment(count, 1);
+        increment(total, ns);
+        if (ns < min.load(std::memory_order_relaxed)) {
+            min.store(ns, std::memory_order_relaxed);
+        }
+        if (ns > max.load(std::memory_order_relaxed)) {
+            max.store(ns, std::memory_order_relaxed);
+        }
+        increment(buckets[bucket_index(ns)], 1);
+    }
+};
+
+/*
+ * Per-function latency statistics of the traced calls, collected with
+ * "stats" and printed as a summary table when the trace finishes.
+ *
+ * Every thread records into its own histograms, which are merged only for
+ * the summary, so the traced calls neither lock nor format anything. A thread
+ * registers its histograms on its first call, and they are kept after the
+ * thread exits.
+ */
+static class call_stats {
+    /// function ids past this one are not recorded
+    static constexpr uint32_t max_function_id = 256;
+
+    struct thread_stats {
+        std::array<std::atomic<latency_histogram *>, max_function_id>
+            functions = {};
+
+        ~thread_stats() {
+            for (auto &histogram : functions) {
+                delete histogram.load();
+            }
+        }
+    };
+
+    std::mutex mut; ///< guards the list of threads
+    std::vector<std::unique_ptr<thread_stats>> threads;
+
+    thread_stats *get_thread_stats() {
+        static thread_local thread_stats *stats = nullptr;
+        if (!stats) {
+            std::scoped_lock<std::mutex> lock(mut);
+            stats = threads.emplace_back(new thread_stats).get();
+        }
+        return stats;
+    }
+
+    struct summary {
+        const char *name = nullptr;
+        uint64_t count = 0;
+        uint64_t total = 0;
+        uint64_t min = UINT64_MAX;
+        uint64_t max = 0;
+        std::array<uint64_t, latency_histogram::num_buckets> buckets = {};
+
+        uint64_t percentile(double p) const {
+            auto rank = static_cast<uint64_t>(std::ceil(p * count));
+            uint64_t seen = 0;
+            for (size_t i = 0; i < buckets.size(); ++i) {
+                seen += buckets[i];
+                if (seen >= rank && seen > 0) {
+                    return std::clamp(latency_histogram::bucket_max(i), min,
+                                      max);
+                }
+            }
+            return max;
+        }
+    };
+
+  public:
+    void add(uint32_t function_id, const char *name,
+             std::chrono::nanoseconds duration) {
+        if (function_id >= max_function_id) {
+            return;
+        }
+        auto &slot = get_thread_stats()->functions[function_id];
+        auto histogram = slot.load(std::memory_order_relaxed);
+        if (!histogram) {
+            histogram = new latency_histogram;
+            histogram->name = name;
+            slot.store(histogram, std::memory_order_release);
+        }
+        histogram->add(static_cast<uint64_t>(duration.count()));
+    }
+
+    void print_summary() {
+        std::vector<summary> functions(max_function_id);
+        {
+            std::scoped_lock<std::mutex> lock(mut);
+            for (auto &thread : threads) {
+                for (uint32_t id = 0; id < max_function_id; ++id) {
+                    auto histogram =
+                        thread->functions[id].load(std::memory_order_acquire);
+                    if (!histogram) {
+                        continue;
+                    }
+                    auto &merged = functions[id];
+                    merged.name = histogram->name;
+                    merged.count += histogram->count;
+                    merged.total += histogram->total;
+                    merged.min = std::min<uint64_t>(merged.min, histogram->min);
+                    merged.max = std::max<uint64_t>(merged.max, histogram->max);
+                    for (size_t i = 0; i < merged.buckets.size(); ++i) {
+                        merged.buckets[i] += histogram->buckets[i];
+                    }
+                }
+            }
+        }
+
+        functions.erase(std::remove_if(functions.begin(), functions.end(),
+                                       [](auto &f) { return f.count == 0; }),
+                        functions.end());
+        std::sort(functions.begin(), functions.end(),
+                  [](auto &a, auto &b) { return a.total > b.total; });
+
+        auto time = [](uint64_t ns) {
+            return time_to_str(std::chrono::nanoseconds(ns),
+                               cli_args.time_unit);
+        };
+
+        std::ostringstream table;
+        table << std::left << std::setw(40) << "function" << std::right
+              << std::setw(12) << "count" << std::setw(12) << "total"
+              << std::setw(12) << "min" << std::setw(12) << "p50"
+              << std::setw(12) << "p99" << std::setw(12) << "p99.9"
+              << std::setw(12) << "max";
+        out.info("{}", table.str());
+        for (auto &f : functions) {
+            table.str("");
+            table << std::left << std::setw(40) << f.name << std::right
+                  << std::setw(12) << f.count << std::setw(12)
+                  << time(f.total) << std::setw(12) << time(f.min)
+                  << std::setw(12) << time(f.percentile(0.5)) << std::setw(12)
+                  << time(f.percentile(0.99)) << std::setw(12)
+                  << time(f.percentile(0.999)) << std::setw(12)
+                  << time(f.max);
+            out.info("{}", table.str());
+        }
+    }
+} call_stats;
+
+/*
+ * Device-side timing of the enqueued commands, collected with
+ * "device_timing".
+ *
+ * The event returned by every successful enqueue call is retained and gets a
+ * completion callback, which queries the profiling info of the command and
+ * prints, next to the host time of the call, how long the command took to be
+ * submitted, how long it then waited before it started on the device, and
+ * how long it ran. The queue needs UR_QUEUE_FLAG_PROFILING_ENABLE for the
+ * adapter to record the times.
+ */
+struct device_timing_request {
+    /// the callback gets the adapter's handle of the event, the collector's
+    /// calls need the one the loader returned
+    ur_event_handle_t event;
+    const char *name;
+    uint64_t instance;
+    std::optional<std::chrono::nanoseconds> host;
+};
+
+/// set while the collector itself calls into UR, the calls then reach the
+/// collector through the tracing layer and are not traced
+static thread_local bool collector_call = false;
+
+struct collector_call_guard {
+    bool previous;
+    collector_call_guard() : previous(collector_call) { collector_call = true; }
+    ~collector_call_guard() { collector_call = previous; }
+};
+
+void device_timing_cb(ur_event_handle_t, ur_execution_info_t,
+                      void *user_data) {
+    collector_call_guard guard;
+    std::unique_ptr<device_timing_request> request(
+        static_cast<device_timing_request *>(user_data));
+    auto event = request->event;
+
+    const ur_profiling_info_t props[] = {
+        UR_PROFILING_INFO_COMMAND_QUEUED, UR_PROFILING_INFO_COMMAND_SUBMIT,
+        UR_PROFILING_INFO_COMMAND_START, UR_PROFILING_INFO_COMMAND_END};
+    uint64_t times[std::size(props)] = {};
+    ur_result_t result = UR_RESULT_SUCCESS;
+    for (size_t i = 0; i < std::size(props) && result == UR_RESULT_SUCCESS;
+         ++i) {
+        result = urEventGetProfilingInfo(event, props[i], sizeof(times[i]),
+                                         &times[i], nullptr);
+    }
+    urEventRelease(event);
+
+    std::string host = request->host
+                           ? time_to_str(*request->host, cli_args.time_unit)
+                           : "n/a";
+    if (result != UR_RESULT_SUCCESS) {
+        out.info("device({}) - {}: host {}, device times not available ({})",
+                 request->instance, request->name, host, result);
+        return;
+    }
+
+    auto time = [](uint64_t from, uint64_t to) {
+        return time_to_str(std::chrono::nanoseconds(to - from),
+                           cli_args.time_unit);
+    };
+    out.info("device({}) - {}: host {}, submission {}, queue latency {}, "
+             "execution {}",
+             request->instance, request->name, host, time(times[0], times[1]),
+             time(times[1], times[2]), time(times[2], times[3]));
+}
+
+void request_device_timing(const xpti::function_with_args_t *args,
+                           uint64_t instance,
+                           std::optional<std::chrono::nanoseconds> host) {
+    auto event = getEnqueuedEvent(args->function_id, args->args_data);
+    if (!event) {
+        return;
+    }
+
+    collector_call_guard guard;
+    if (urEventRetain(event) != UR_RESULT_SUCCESS) {
+        return;
+    }
+    auto request =
+        new device_timing_request{event, args->function_name, instance, host};
+    auto result =
+        urEventSetCallback(event, UR_EXECUTION_INFO_EXECUTION_INFO_COMPLETE,
+                           device_timing_cb, request);
+    if (result != UR_RESULT_SUCCESS) {
+        out.debug("unable to set the callback of the event of {}({}) {}",
+                  args->function_name, instance, result);
+        urEventRelease(event);
+        delete request;
+    }
+}
+
+/// a number identifying the calling thread, in the order the threads first
+/// made a traced call
+uint64_t thread_number() {
+    static std::atomic<uint64_t> next = 1;
+    static thread_local uint64_t number = next++;
+    return number;
+}
+
+/*
+ * Formats the parameters of a call as the members of a JSON object, for
+ * ur_params::serializeFunctionParamFields. Integers and bools keep their
+ * type, null pointers and handles are null, the other handles are strings
+ * holding their address, and every other parameter is the string the text
+ * format prints for it.
+ */
+class json_fields {
+    std::string &str;
+    bool first = true;
+
+    void key(const char *name) {
+        str += first ? "\"" : ",\"";
+        first = false;
+        str += name;
+        str += "\":";
+    }
+
+  public:
+    explicit json_fields(std::string &str) : str(str) {}
+
+    template <typename T> void number(const char *name, T value) {
+        key(name);
+        str += std::to_string(value);
+    }
+
+    void boolean(const char *name, bool value) {
+        key(name);
+        str += value ? "true" : "false";
+    }
+
+    void pointer(const char *name, const void *ptr) {
+        key(name);
+        if (!ptr) {
+            str += "null";
+            return;
+        }
+        std::ostringstream os;
+        os << ptr;
+        str += '"' + os.str() + '"';
+    }
+
+    template <typename F> void text(const char *name, F &&serialize) {
+        std::ostringstream os;
+        serialize(os);
+        key(name);
+        if (os.str() == "nullptr") {
+            str += "null";
+            return;
+        }
+        str += '"';
+        append_json_escaped(str, os.str());
+        str += '"';
+    }
+};
+
+/// the columns of the records of the csv format
+constexpr const char *CSV_HEADER =
+    "function,thread,instance,duration_ns,result,params";
+
+/// appends a field to a csv record, quoted if it has to be
+void append_csv_field(std::string &str, std::string_view value) {
+    if (value.find_first_of(",\"\r\n") == std::string_view::npos) {
+        str += value;
+        return;
+    }
+    str += '"';
+    for (char c : value) {
+        if (c == '"') {
+            str += '"';
+        }
+        str += c;
+    }
+    str += '"';
+}
+
+/*
+ * Prints a traced call as a single record of the jsonl or csv format, with
+ * the same fields in both: the function, the thread, the instance, the
+ * duration in nanoseconds, the result, and the parameters. In the csv format,
+ * the parameters are a single column holding the JSON object of the jsonl
+ * format.
+ */
+void trace_record(const xpti::function_with_args_t *args, uint64_t instance,
+                  fn_context ctx, std::chrono::time_point<Clock> time) {
+    std::string duration;
+    if (ctx.start) {
+        auto dur = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            time - *ctx.start);
+        duration = std::to_string(dur.count());
+    }
+    std::ostringstream result;
+    result << *static_cast<const ur_result_t *>(args->ret_data);
+
+    std::string params;
+    if (!cli_args.no_args) {
+        params += '{';
+        json_fields fields(params);
+        ur_params::serializeFunctionParamFields(fields, args->function_id,
+                                                args->args_data);
+        params += '}';
+    }
+
+    std::string record;
+    if (cli_args.format == OUTPUT_FORMAT_JSONL) {
+        record += "{\"function\":\"";
+        append_json_escaped(record, args->function_name);
+        record += "\",\"thread\":" + std::to_string(thread_number());
+        record += ",\"instance\":" + std::to_string(instance);
+        record += ",\"duration_ns\":" + (ctx.start ? duration : "null");
+        record += ",\"result\":\"" + result.str() + '"';
+        if (!cli_args.no_args) {
+            record += ",\"params\":" + params;
+        }
+        record += '}';
+    } else {
+        record += args->function_name;
+        record += ',' + std::to_string(thread_number());
+        record += ',' + std::to_string(instance);
+        record += ',' + duration;
+        record += ',' + result.str() + ',';
+        append_csv_field(record, params);
+    }
+    out.info("{}", record);
+}
+
 void trace_begin(const xpti::function_with_args_t *args, uint64_t instance,
                  fn_context *ctx) {
-    if (cli_args.print_begin) {
+    if (cli_args.print_begin && cli_args.format == OUTPUT_FORMAT_TEXT &&
+        !chrome_trace.is_open() && !cli_args.stats) {
         std::ostringstream args_str;
         if (cli_args.no_args) {
             args_str << "...";
@@ -205,9 +932,15 @@ void trace_begin(const xpti::function_with_args_t *args, uint64_t instance,
                  args_str.str());
     }
     // start the clock as the very last thing this function does to minimize
-    // tracing overheads
-    if (cli_args.profiling) {
-        ctx->start = Clock::now();
+    // tracing overheads, only the short begin event of the chrome trace
+    // needs the start time
+    if (cli_args.profiling || cli_args.stats || cli_args.device_timing ||
+        cli_args.format != OUTPUT_FORMAT_TEXT || chrome_trace.is_open()) {
+        auto time = trace_point_time(args);
+        ctx->start = time ? *time : Clock::now();
+        if (chrome_trace.is_open()) {
+            chrome_trace.begin(args, *ctx->start);
+        }
     }
 }
 
@@ -245,18 +978,24 @@ XPTI_CALLBACK_API void trace_cb(uint16_t trace_type,
     auto time = Clock::now();
     auto *args = static_cast<const xpti::function_with_args_t *>(user_data);
 
-    if (auto regex = cli_args.filter) {
-        if (!std::regex_match(args->function_name, *regex)) {
-            out.debug("function {} does not match regex filter, skipping...",
-                      args->function_name);
-            return;
-        }
+    if (collector_call) {
+        return;
+    }
+
+    if (cli_args.filter &&
+        !cli_args.filter->matches(args->function_id, args->function_name)) {
+        out.debug("function {} does not match regex filter, skipping...",
+                  args->function_name);
+        return;
     }
 
     if (trace_type == TRACE_FN_BEGIN) {
         auto ctx = push_instance_data(instance);
         trace_begin(args, instance, ctx);
     } else if (trace_type == TRACE_FN_END) {
+        if (auto end = trace_point_time(args)) {
+            time = *end;
+        }
         auto ctx = pop_instance_data(instance);
         if (!ctx) {
             out.error("Received TRACE_FN_END without corresponding "
@@ -264,7 +1003,32 @@ XPTI_CALLBACK_API void trace_cb(uint16_t trace_type,
                       instance);
             return;
         }
-        trace_end(args, instance, *ctx, time);
+        if (cli_args.stats && ctx->start) {
+            call_stats.add(
+                args->function_id, args->function_name,
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    time - *ctx->start));
+        }
+        if (chrome_trace.is_open() && ctx->start) {
+            chrome_trace.end(args, instance, time);
+        }
+        if (!cli_args.stats && !chrome_trace.is_open()) {
+            if (cli_args.format == OUTPUT_FORMAT_TEXT) {
+                trace_end(args, instance, *ctx, time);
+            } else {
+                trace_record(args, instance, *ctx, time);
+            }
+        }
+        if (cli_args.device_timing &&
+            *static_cast<const ur_result_t *>(args->ret_data) ==
+                UR_RESULT_SUCCESS) {
+            std::optional<std::chrono::nanoseconds> host;
+            if (ctx->start) {
+                host = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    time - *ctx->start);
+            }
+            request_device_timing(args, instance, host);
+        }
     } else {
         out.warn("unsupported trace type");
     }
@@ -299,6 +1063,17 @@ XPTI_CALLBACK_API void xptiTraceInit(unsigned int major_version,
     out.debug("Registered stream {} ({}.{}).", stream_name, major_version,
               minor_version);
 
+    if (cli_args.chrome_trace && !chrome_trace.is_open() &&
+        !chrome_trace.open(*cli_args.chrome_trace)) {
+        out.error("unable to open the chrome trace file {}",
+                  *cli_args.chrome_trace);
+    }
+
+    if (cli_args.format == OUTPUT_FORMAT_CSV && !cli_args.stats &&
+        !chrome_trace.is_open()) {
+        out.info("{}", CSV_HEADER);
+    }
+
     xptiRegisterCallback(stream_id, TRACE_FN_BEGIN, trace_cb);
     xptiRegisterCallback(stream_id, TRACE_FN_END, trace_cb);
 }
@@ -306,5 +1081,11 @@ XPTI_CALLBACK_API void xptiTraceInit(unsigned int major_version,
 /**
  * @brief Subscriber finish function called by the XPTI dispatcher.
  */
-XPTI_CALLBACK_API void xptiTraceFinish(const char *stream_name) { /* noop */
+XPTI_CALLBACK_API void xptiTraceFinish(const char *stream_name) {
+    if (stream_name && std::string_view(stream_name) == UR_STREAM_NAME) {
+        chrome_trace.close();
+        if (cli_args.stats) {
+            call_stats.print_summary();
+        }
+    }
 }